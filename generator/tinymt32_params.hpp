@@ -0,0 +1,1067 @@
+// Parameter sets of tinymt32 for one parameter set per PRNG instance (see
+// clrand_set_instance_params), written by src/tinymt_dc. The characteristic
+// polynomial of the recursion of each set (mat1, mat2) is irreducible of
+// degree 127, so that every instance has the full period 2^127-1, and
+// differs from those of the other sets, so that every instance runs its own
+// recursion. tmat is tuned so that the outputs are equidistributed up to the
+// upper bound in every dimension. The comment on each row gives the weight
+// and delta of the set, as in the output of TinyMTDC.
+// The table is split over several literals to stay within the length
+// limits of some compilers.
+const char * tinymt32_params_kernel =
+R"EOK(
+/**
+Parameter sets of tinymt32, one per PRNG instance. Streams with more
+instances than sets are rejected when they are readied.
+*/
+#define TINYMT32_NUM_PARAMS 1024
+
+__constant uint tinymt32_params[TINYMT32_NUM_PARAMS * 3] = {
+// mat1, mat2, tmat, // weight delta
+0xb4f193b5U,0x4fa28947U,0x30308cc5U, // 61 0
+0x19006950U,0xb1c1b24dU,0xdc658155U, // 65 0
+0xffa9ba11U,0x2f3e805fU,0xda584031U, // 65 0
+0x193f170cU,0x5bcb25ebU,0x18856b6fU, // 63 0
+0x7077d13cU,0x570d23cdU,0xc050f911U, // 63 0
+0x78f2640aU,0xd3daf843U,0x034b44e5U, // 65 0
+0xba1f9a56U,0x88b59e43U,0x79225bb8U, // 59 0
+0xe1e93e59U,0x6d145f2fU,0x0c4bf2c9U, // 71 0
+0x43a421c6U,0x35772e2dU,0x91a02b04U, // 59 0
+0xd0ec34ecU,0xe63ac799U,0xb976a23fU, // 61 0
+0x84f7206eU,0x8710a625U,0x01a6716fU, // 61 0
+0xc5e3cf77U,0x9c0f6af9U,0x0ea36a25U, // 65 0
+0xe6cfb0ccU,0x4c6480a3U,0x0c51d50bU, // 67 0
+0x20e971faU,0xec7dfad1U,0x7ee7f7d3U, // 69 0
+0x8726c34eU,0x81a582d3U,0xe0f7ae57U, // 61 0
+0x9f416d29U,0x3719fad1U,0x67f4f96cU, // 65 0
+0xdce09cf4U,0xd7b61315U,0x195f4d00U, // 71 0
+0xd5a653ebU,0xafc3055fU,0x608a3b24U, // 71 0
+0x0d48adc6U,0xd829d7fbU,0x75a2bab7U, // 61 0
+0x0ff575a0U,0xf208f1e7U,0x6d28099cU, // 69 0
+0x81c13423U,0x44421e83U,0x769c5becU, // 69 0
+0xd47e2157U,0xc02a76b3U,0x07fb49a5U, // 65 0
+0x0810e6b7U,0x7b307cb3U,0x2a04f005U, // 63 0
+0xddbb2f16U,0x46b15241U,0x28d997c1U, // 69 0
+0xa2476b9aU,0x90222c6fU,0xd459504bU, // 67 0
+0x70810bceU,0xfd8fc7b9U,0xf44965fcU, // 75 0
+0x2afbcb73U,0x50ac95f3U,0xaa74b172U, // 59 0
+0x1cae63c5U,0xf595a30dU,0x1eac488bU, // 73 0
+0x48d8cd73U,0xa37d2d65U,0xd98be1c1U, // 65 0
+0xead41a0eU,0x7d4cfb6fU,0x00700c51U, // 57 0
+0x9938d4b0U,0xbb1dcac5U,0x0ab8431eU, // 65 0
+0x568c3934U,0x669ac379U,0x77da170bU, // 71 0
+0xb36213dbU,0x0ef8658bU,0xafad5feaU, // 71 0
+0x415c6913U,0xdd168e17U,0x9af3e545U, // 67 0
+0xed0c2f44U,0x9c6147cfU,0xaf582856U, // 65 0
+0x89bbb337U,0x81f771f9U,0x1c827470U, // 71 0
+0x49dbb9c1U,0xe768a25fU,0x52ee51ffU, // 61 0
+0xb603051fU,0x9629c1cdU,0x4e031afeU, // 55 0
+0x7fcdb29aU,0xdc97f40fU,0x56132476U, // 71 0
+0x397e258fU,0x0c7ba413U,0x8603e579U, // 69 0
+0xda37eb4bU,0xb2fa7727U,0x9670278bU, // 67 0
+0xc00bae7fU,0x21c217f7U,0x591e6e2cU, // 71 0
+0x4f59acf2U,0x6345dd77U,0xb49a11caU, // 63 0
+0xae7af25eU,0x2d482bcbU,0x8c1a5899U, // 57 0
+0xc0b7dee6U,0xd03e8d49U,0x975b4ab7U, // 57 0
+0xd0334be2U,0x5445bf29U,0xa2aca9f7U, // 65 0
+0xbffd1f6eU,0xe1414753U,0xdc8a05b7U, // 67 0
+0xe9edc6cdU,0x4009df09U,0xb5900830U, // 59 0
+0xcae92730U,0x4478bdebU,0x7781a6b5U, // 69 0
+0x5d30ecaaU,0x92d6d125U,0x4e51ad05U, // 55 0
+0x37d119a9U,0xf98cd837U,0xb80c0290U, // 65 0
+0x92b957c3U,0x66b8ea61U,0x554f921dU, // 57 0
+0xf5097c33U,0x3c9eedfdU,0xf0cea560U, // 63 0
+0xfa65905bU,0xd9ff8535U,0x125d7006U, // 65 0
+0x4bef5a86U,0xcff52f8fU,0x13ce590cU, // 65 0
+0xee6a0007U,0x39a17ffdU,0x62731845U, // 61 0
+0x9ad8f26fU,0xed7bbe9fU,0xfe8e016aU, // 61 0
+0x11a7654dU,0x42f816a5U,0x0d8e963eU, // 57 0
+0x3541c5d0U,0x4a8ca61dU,0x3f675f11U, // 67 0
+0xa5b3f92cU,0xaf560179U,0x9af72c12U, // 69 0
+0xe193162fU,0x95567b59U,0x0bcefbb8U, // 63 0
+0x03cd1448U,0xda05a857U,0xc044d3c7U, // 61 0
+0x9b2be8a7U,0xac51260dU,0x0815c98aU, // 69 0
+0x87efd555U,0x8fea9cafU,0x133cecebU, // 69 0
+0x9d84e7c3U,0xe1c073fbU,0x22780f7aU, // 69 0
+0x6f45ad1eU,0xe2499753U,0xd282fdc8U, // 59 0
+0x4a466e22U,0xbb717937U,0x219b0d08U, // 63 0
+0xfe766af1U,0x5616442dU,0xa0ed9884U, // 69 0
+0x1a8d914bU,0x3ea86895U,0x88e90822U, // 57 0
+0xc5c7b1d8U,0x06bdcdc1U,0x6dc7e7daU, // 67 0
+0x9e245e49U,0x5290a779U,0x37d9eb60U, // 63 0
+0x433f08afU,0xb7b6adfdU,0x3baf692eU, // 63 0
+0x19767defU,0x74b2a907U,0x37776ba0U, // 67 0
+0x8ce99b68U,0x4ec5785bU,0x0f1e8a94U, // 71 0
+0xc64b35c6U,0x80917c63U,0x28eee3eaU, // 63 0
+0x7a5177f3U,0xd123625bU,0x00e83fa8U, // 61 0
+0x21d2b1a9U,0x7ef9f5f3U,0xd01f1cc3U, // 53 0
+0x489adde8U,0x8ad75e73U,0x986f8fceU, // 67 0
+0x2722b317U,0xa950d551U,0x3085d5dcU, // 77 0
+0xb00df41aU,0x48b9e041U,0xde99e318U, // 59 0
+0xb044eb99U,0x0d95c827U,0x2296a598U, // 63 0
+0x36bfc6dbU,0x3ea1940dU,0x8fcce961U, // 59 0
+0x74adf8b6U,0x56bb6057U,0x5fdc2bbcU, // 79 0
+0x4e1a26dcU,0xc54ad8bfU,0xb1c99185U, // 59 0
+0x12b3e187U,0x2ca4d07fU,0x80990375U, // 59 0
+0x10fd10fbU,0xf71ad3dfU,0x0a8a80c3U, // 73 0
+0x6ad00950U,0x1897d67dU,0x68e53236U, // 59 0
+0x9f1f5486U,0x68070527U,0xf2de1e4cU, // 69 0
+0x3886b92bU,0x0f7260e1U,0x371dc965U, // 67 0
+0xd42c6bd3U,0x0e570aa7U,0x63412ab0U, // 59 0
+0xb36a46d7U,0x1096f59bU,0x295941dfU, // 69 0
+0xd780bdc0U,0x521ba02bU,0x7c049044U, // 67 0
+0xa86b5263U,0xa9a76049U,0xa28a466aU, // 69 0
+0xd4b82e00U,0x6f3b6101U,0x0e79f8d0U, // 67 0
+0x3e5594a3U,0x2f179473U,0x5175aa41U, // 55 0
+0xf8b77ab4U,0x662fe9fdU,0x63e2c289U, // 59 0
+0xec308fd1U,0xcb844b9fU,0x9f33aac5U, // 65 0
+0x9477cc85U,0x0d93b031U,0xfbc9c3fcU, // 67 0
+0xb9951be2U,0x44d0a409U,0x6f92f4ccU, // 59 0
+0xb1830112U,0x4ade585dU,0x2a0f9ebdU, // 61 0
+0xc0826375U,0xa4f6844bU,0xd5e06e47U, // 57 0
+0x70197d6bU,0x7d6fb535U,0xd814f7a1U, // 65 0
+0xda061e7aU,0x42506c2dU,0x30692e84U, // 71 0
+0x17b97822U,0xada3aa67U,0x86672613U, // 59 0
+0xac993eb0U,0xa23fbb35U,0xe7f5d664U, // 63 0
+0x90a084e8U,0x01fd4f8dU,0xe53f9e55U, // 63 0
+0xbc88cc53U,0x825a0e85U,0x3cc2c395U, // 65 0
+0xe634d345U,0xa85d0db9U,0x5a12aad8U, // 67 0
+0x9d8b136cU,0x1d93d987U,0x910ead55U, // 65 0
+0x524483f3U,0x7e6761d1U,0x6824d6fbU, // 65 0
+0xe5ae9345U,0x297b89b7U,0x542aa0ccU, // 65 0
+0xa50f89d5U,0xdf1e948dU,0xd31fa505U, // 65 0
+0x920cb3dcU,0xc7a1c0b7U,0x1ef4dcd6U, // 69 0
+0x2ff8a94aU,0xaabaf0b9U,0x8184c155U, // 67 0
+0x74617c63U,0x82a377dfU,0x31057801U, // 57 0
+0x04e9f424U,0x8dbe7b9dU,0x1fa480d2U, // 79 0
+0xc78c3f09U,0xda23faa5U,0x6df14fa2U, // 59 0
+0x7354829cU,0xfcc87b4dU,0xe8182d13U, // 73 0
+0x9f0ff289U,0xac0ed617U,0x4e3f7ac9U, // 69 0
+0xe2aa548aU,0x383d3d35U,0x7b33a9d7U, // 59 0
+0x5fa042e9U,0xef9fcaabU,0xc7b9a056U, // 69 0
+0x11110bf9U,0x7c4a83d5U,0x5f464d8fU, // 73 0
+0xbecd0fb6U,0x5e8d7e63U,0xfbaf38a3U, // 73 0
+0xb7eec3ecU,0x16969e0dU,0xa6dcbdaaU, // 65 0
+0x471ab174U,0x6e2a979bU,0x10c456cbU, // 61 0
+0x0fdf7571U,0xd9571511U,0x1631e103U, // 61 0
+0xc0bba47aU,0xeb8e0545U,0x3ffe415dU, // 61 0
+0x5850e522U,0xa4603065U,0xcb20517fU, // 79 0
+0x500405efU,0x7202b869U,0x983df774U, // 55 0
+0xee506e6bU,0x9062912dU,0xb6ad5d34U, // 63 0
+0xf4e46a95U,0xac8f39a7U,0x326534c3U, // 69 0
+0xa909d4c5U,0xda43c483U,0xe79b6ec2U, // 65 0
+0xa45dd796U,0x10423915U,0x0abe14baU, // 65 0
+0xea62216dU,0x5cae9555U,0xdcd7cde5U, // 67 0
+0x7f276398U,0xf94d7f93U,0x6a4ce735U, // 63 0
+0x0be79bbfU,0xa0d2fccdU,0x51aa09f8U, // 53 0
+0x85e67858U,0x94b2f6e1U,0x6448f0b7U, // 73 0
+0x53b42b5dU,0x727887a1U,0xf4c25cfeU, // 61 0
+0x4ba2264fU,0x69360f2fU,0x78b1dc34U, // 69 0
+0x1c423a36U,0x67d96d6dU,0xc099556dU, // 65 0
+0x68c9fe9aU,0x8d8ecbb7U,0x432d0e85U, // 67 0
+0xc0fdf1b5U,0x05e67b25U,0x7706dc98U, // 67 0
+0x30b2f132U,0xb91a30c3U,0xf483cc82U, // 71 0
+0xf305f055U,0xc3135bf9U,0xfe3a4052U, // 67 0
+0x9dcc3de5U,0xb8df615bU,0xbee7c4f6U, // 63 0
+0xb5dbe73aU,0xf8c0082bU,0x20e5b65bU, // 59 0
+0xac548f80U,0xae46d04bU,0xbb8d5d87U, // 63 0
+0xef76efceU,0x7f5a7d69U,0x38509829U, // 57 0
+0x484d79c3U,0x6b8e4229U,0x7103975cU, // 71 0
+0xff98651bU,0x7e9f8d85U,0x64dcdd42U, // 65 0
+0x17141736U,0xaceaa8a5U,0x83839210U, // 63 0
+0x50e163b4U,0x9e55dd7bU,0x35c3b43aU, // 71 0
+0xe19a1432U,0x48cb51a1U,0xca6e8c68U, // 57 0
+0x8ebb6c29U,0xd5fbf651U,0xacbaa705U, // 55 0
+0xf708df63U,0xd620c779U,0x036c4437U, // 69 0
+0x96b2259eU,0xb2acee97U,0x9fd15df6U, // 63 0
+0x3ce89945U,0x15eca577U,0x81558056U, // 63 0
+0xa4d7db55U,0x372d5ab1U,0x407c8ecaU, // 63 0
+0x9b773481U,0xf1360e69U,0xb466ad12U, // 63 0
+0xebd45667U,0xf9f3b6a7U,0x07544a83U, // 67 0
+0x9b573fecU,0x44fff5bbU,0xd2df3123U, // 63 0
+0xd81bb4f2U,0xcbd1715fU,0x113bbfd7U, // 67 0
+0xf7b0a3d2U,0xdcc95e83U,0x9b9d9cc6U, // 67 0
+0xeddb1f24U,0x2787ae39U,0x867c03f8U, // 65 0
+0x163f89fcU,0xf2a7d099U,0x9df27862U, // 65 0
+0xc94dbe66U,0x88a40e55U,0x97eb69e2U, // 71 0
+0xfe7776d4U,0x0012de25U,0xa0a3defdU, // 71 0
+0x427cf9b5U,0xc52ee1e7U,0x750d4c45U, // 73 0
+0xb6501c31U,0xf2b5a083U,0x5aca1dfdU, // 73 0
+0x375376faU,0xeb87a393U,0x3e6ae946U, // 59 0
+0x6736d5b8U,0x446d629bU,0xa3d6f7cbU, // 67 0
+0xfa857795U,0x30ca608bU,0x74bd3fc5U, // 73 0
+0x4097e453U,0x7959c1bfU,0x1991592fU, // 65 0
+0xf3dd9a08U,0xc34b04e9U,0x5f7350a7U, // 59 0
+0xfb766d30U,0x69cafb63U,0x5aafd56dU, // 61 0
+0x3886bacfU,0x7e4795edU,0x9a9f58e2U, // 67 0
+0xe115819dU,0xcb6d3bb9U,0x50e00a32U, // 61 0
+0x9f893de2U,0x1b805b7dU,0x638d682dU, // 69 0
+0xe471a8d3U,0x6868f65fU,0x458d54eaU, // 55 0
+0xba86c2deU,0xc24e8819U,0x00774f1dU, // 67 0
+0x6fbdd5c9U,0xbc9f1f65U,0xc78ad75dU, // 63 0
+0xf02f3828U,0x91edebafU,0xacff0544U, // 71 0
+0x3456d374U,0xe6365b67U,0x177aa1c0U, // 61 0
+0xa7e40235U,0x7be0839dU,0x2f5633d9U, // 69 0
+0x5bbbf3d4U,0x38e6dd19U,0x88b3c50cU, // 61 0
+0xd86a7828U,0x06f7ed69U,0xd2edfa74U, // 63 0
+0xb2dd43adU,0xf677dc3dU,0xf875e216U, // 55 0
+0x2359d7ceU,0x270f2639U,0x0a68aedcU, // 67 0
+0xbf921075U,0xbad881a7U,0x778c6293U, // 77 0
+0xa329c4fcU,0x187913b5U,0x9a73652bU, // 65 0
+0xf11049f6U,0x5125d059U,0x447fa8acU, // 69 0
+0xfbf6a031U,0xe8baa3e7U,0x55aafdaeU, // 59 0
+0x6eb4c131U,0x79f60c67U,0x1cba0ad1U, // 73 0
+0x363f6c08U,0x85ba8855U,0xf3d4ad54U, // 71 0
+0xc40cc6c6U,0xe7c12b6dU,0x9dd0f3acU, // 63 0
+0xf96cc453U,0xa2fae049U,0x59b86078U, // 69 0
+0x0e00f49fU,0xfe898189U,0xf83a91f5U, // 67 0
+0x9149b45aU,0x9f7833e9U,0x80c194c8U, // 67 0
+0x127cddb4U,0xf81b2d49U,0xd2a23483U, // 65 0
+0x5a8df3a7U,0x70bb7693U,0xc02cac6eU, // 65 0
+0x53fda85eU,0x16e16209U,0xcfc56e2cU, // 61 0
+0x83a83bc2U,0xb50b692fU,0x1e56c7cbU, // 51 0
+0xa21cc1a6U,0x55622fe1U,0x37e7c4c9U, // 71 0
+0xacd3579bU,0xc8cb602bU,0x40cfbf78U, // 59 0
+0xd6803191U,0x1d77d1e3U,0x689793ddU, // 73 0
+0xf96898a7U,0x28292a0dU,0x1724e9bbU, // 63 0
+0x5ccd9b55U,0x17385661U,0x0455f2a5U, // 69 0
+0xa618d05cU,0x9a7f7bc5U,0x80a4a8baU, // 67 0
+0x0c0ce5dcU,0x8d475da1U,0xb9810b84U, // 57 0
+0x408075c4U,0x62db1837U,0x1545f829U, // 71 0
+0x27a2b8cdU,0xc95f1fe3U,0x7a5c0aa0U, // 73 0
+0xbf895a53U,0xaeb65c6fU,0x52661598U, // 57 0
+0x9ec224e7U,0xc994fb99U,0xd7e81da2U, // 53 0
+0xc7f9ee3aU,0x3784bf41U,0xe857f251U, // 71 0
+0xf88b2062U,0x58b877b1U,0x28dfd217U, // 63 0
+0x0e286ab9U,0xcc965ffdU,0x39adf5ddU, // 79 0
+0xa45e225fU,0x68a754d7U,0x71a44b33U, // 67 0
+0x74d922f9U,0xfb27a3e9U,0x0cc905f3U, // 63 0
+0x9e7f7af9U,0xc1035717U,0xebd050d7U, // 65 0
+0xed909055U,0x4b878b8dU,0xc0f92911U, // 65 0
+0xd8e95908U,0x521cc733U,0x96facf2cU, // 59 0
+0x939f5d92U,0xab1cbc7fU,0x12c8a2a4U, // 67 0
+0xdcf10bbdU,0xb147cd85U,0x90c53759U, // 67 0
+0x8a3a8649U,0x4426e593U,0x829c904dU, // 65 0
+0x51ce46caU,0xda901819U,0xdf235d9fU, // 57 0
+0xf3e2b119U,0xd3a19affU,0x650a25f3U, // 65 0
+0x5d627257U,0x68375c7bU,0xd581ae7cU, // 69 0
+0xd9bc6fa3U,0x8da712b3U,0x63c09ad8U, // 65 0
+0xe7b04ac9U,0x7f45d313U,0xa62367f6U, // 71 0
+0x2724b485U,0x6c54305dU,0x8ba062abU, // 59 0
+0xaedd54a1U,0x4cecc0cbU,0x55a491c9U, // 53 0
+0xf3ba784fU,0xd70ef0f5U,0x22ec8e8dU, // 67 0
+0x5d6f658cU,0x0d71db8fU,0xe85a0fe6U, // 63 0
+0xcb49f74cU,0xe968915fU,0x1b4f3af7U, // 69 0
+0x57cb27d8U,0xdc7edfcfU,0xc85480e2U, // 57 0
+0xc0f516c2U,0x0a68eebfU,0x6776ca09U, // 65 0
+0xaa5f6673U,0x223c765fU,0xfa54417dU, // 69 0
+0xf8694871U,0x0f8eb133U,0x25f351f1U, // 67 0
+0x9a932d38U,0x8fa1f907U,0x1d681a58U, // 75 0
+0x0d66b02bU,0x65484d75U,0x89b36d99U, // 71 0
+0x1f15fdc0U,0x5037b839U,0x81649911U, // 63 0
+0x9846f458U,0x962b332bU,0x445fd633U, // 65 0
+0x74931f9bU,0xf2efa0dbU,0xc998b2e0U, // 57 0
+0x25464d09U,0xb1e94093U,0x8f17f06eU, // 69 0
+0x21d0fb74U,0xe96f872fU,0xfe26b58bU, // 69 0
+0xbbf0df3eU,0x29289a91U,0x7c43b7b3U, // 73 0
+0xaa603292U,0xaf44bc0fU,0x009bde67U, // 67 0
+0x360e8d68U,0x26da6eebU,0x4e85e365U, // 73 0
+0x2ec013d0U,0x60ffc069U,0x4bfdde8aU, // 73 0
+0xc1bb75eeU,0xa2bbc5b7U,0x52ae7b88U, // 67 0
+0x173ed080U,0x7034654dU,0x5d10946fU, // 63 0
+0x00da294fU,0x15e99331U,0x7a4fe179U, // 73 0
+0x4d67ff5bU,0x05880d8dU,0x84c52604U, // 73 0
+0xd8748d9dU,0x9cdaef53U,0x5a01323fU, // 73 0
+0x7115e3a9U,0x2f35ba27U,0xcd15434aU, // 67 0
+0x49fa3787U,0xb794e1d5U,0x8e00d817U, // 67 0
+)EOK"
+R"EOK(
+0xfe456c1eU,0x15a78451U,0x719129d0U, // 69 0
+0x7877a5f1U,0x86b77bc5U,0x227c49faU, // 63 0
+0x0ac50c31U,0xd6d54cd7U,0x6c69f10cU, // 65 0
+0xc2daf16cU,0x91321fc7U,0xca5f2994U, // 59 0
+0xc9b00955U,0x4aea5b65U,0x12b7f162U, // 55 0
+0x16956d22U,0x666b09c3U,0x385b8aa6U, // 71 0
+0x053237f9U,0x95d221afU,0x1a1da7abU, // 67 0
+0x934f2eb4U,0x5058b9dfU,0xa3cb66d9U, // 61 0
+0x2b18c586U,0xe1ec8355U,0x92fe1a45U, // 65 0
+0x3157c090U,0xe52bb779U,0x03780ec2U, // 63 0
+0x7489efcdU,0x5226ea05U,0x68c6450aU, // 53 0
+0x499a2fd1U,0xa25c463dU,0x10addf06U, // 53 0
+0x16508195U,0xf1661da5U,0x5d8d066bU, // 63 0
+0x8c6a474aU,0xf0009627U,0xb3de3429U, // 65 0
+0x9e5f96feU,0x35d16c13U,0x05b72771U, // 71 0
+0xa63db60cU,0x4bf5bf95U,0x592102d9U, // 75 0
+0x78a8d495U,0xe8c4209fU,0x3c146744U, // 61 0
+0xff18a1e7U,0x0e3d8581U,0xbc9718d7U, // 65 0
+0x1bb3d99bU,0x4a9bb125U,0xe06d4f6cU, // 63 0
+0x482a1a6aU,0x3b4721e3U,0xa3c16ea9U, // 71 0
+0xfabbe7b2U,0x841f29b5U,0x87fc3187U, // 75 0
+0x473ffd51U,0xb67df6e5U,0x43ddb548U, // 63 0
+0x48874d53U,0xc1626f77U,0xdb5b8466U, // 59 0
+0xde59cd1aU,0x71863addU,0x92eb13a5U, // 61 0
+0x2942ab8bU,0x2a5ffec9U,0xff1e43ffU, // 63 0
+0xacc3420fU,0x498d4ccdU,0xbafda46eU, // 67 0
+0x2312a45eU,0x2cd1fde1U,0x74963b1fU, // 73 0
+0x44e47f0dU,0xb75526d9U,0xd74f0d66U, // 67 0
+0xd9f908a9U,0xb7a6a8ffU,0x4d620357U, // 63 0
+0x4a2b71c3U,0xdaf8bf8fU,0xf37e595dU, // 67 0
+0xa217cc1dU,0x7f646fc9U,0x152b7c7eU, // 65 0
+0x12bad813U,0x7aeba58bU,0x2a140c14U, // 57 0
+0x1ae62c24U,0x901d2b4bU,0x0236f074U, // 61 0
+0x63ce66e2U,0x96760a53U,0xfa7645b1U, // 59 0
+0x96886b2bU,0xe84d2febU,0x367a819aU, // 53 0
+0x95d611e1U,0xcde39eedU,0xcc97267cU, // 59 0
+0x66d5b5eeU,0x704162dfU,0xf0427063U, // 73 0
+0x3183a28cU,0x98735079U,0xda85e071U, // 63 0
+0xdc2503ccU,0x9c124427U,0x2f8fe7f4U, // 69 0
+0x962959ccU,0xaae3545bU,0x47d09c8cU, // 65 0
+0x8cab1bf5U,0x214c5727U,0x3d1c3eb0U, // 61 0
+0xc7841232U,0xb660cfe5U,0x31df0278U, // 67 0
+0x08799641U,0xef167aafU,0x42ec79f1U, // 69 0
+0x7f46bbbcU,0x9d33a7a3U,0x2e3f2c9eU, // 65 0
+0x40d4d8a0U,0xb7092063U,0x30398558U, // 61 0
+0x69bd6ae8U,0xb5273431U,0x72d538c9U, // 53 0
+0xe7b8b3dfU,0x364d3517U,0x41842275U, // 67 0
+0x32c5f37bU,0xb1cd4bc9U,0xa64b78e3U, // 57 0
+0xaeee800dU,0x5c453197U,0xc8486c6dU, // 61 0
+0x79a34783U,0x791157adU,0x6d672b64U, // 69 0
+0x65c7bdaeU,0x49695e59U,0xbffdb511U, // 63 0
+0xa595019fU,0x36f6da43U,0xf02ac9ddU, // 61 0
+0xf86e0be6U,0xdc6d84b5U,0x8efdb1f4U, // 67 0
+0xcced4c92U,0x3098f897U,0xaecdf4b3U, // 61 0
+0x043352f9U,0x073944c7U,0x97d4aff7U, // 67 0
+0x3d8edc29U,0xa1493545U,0x15d34f62U, // 63 0
+0x2fb55614U,0x507b148fU,0xa2fe87aeU, // 69 0
+0x58ea57a7U,0x758bcee7U,0xf27c5738U, // 59 0
+0x7a7d9e4aU,0x22f890adU,0xcb06b843U, // 65 0
+0x72f9b9cfU,0xd2bcde8fU,0xa14391f9U, // 55 0
+0xf2a3933eU,0xc4e2f3a1U,0x64b312d7U, // 69 0
+0x063b9680U,0xf130d4e5U,0xfdd84494U, // 65 0
+0xb2553e83U,0xc0fd9c1fU,0xbf3d2c0cU, // 63 0
+0xfdb4f262U,0x45b378bdU,0xae915ec5U, // 69 0
+0xf9bb0845U,0xa6f8d97bU,0x9c70890eU, // 73 0
+0xd235bee4U,0x6d6032abU,0xff7480b6U, // 65 0
+0xc94cdaebU,0xa95cc5d7U,0x4eb97e56U, // 55 0
+0xb6e71253U,0x40d9267fU,0xe7960933U, // 63 0
+0xb1afd57eU,0x5c7be263U,0xdaeb08c6U, // 67 0
+0x7d48ef03U,0x0e79a025U,0x26835677U, // 53 0
+0x54824453U,0x1f40a529U,0x84b61a40U, // 73 0
+0x3f75add7U,0x23044415U,0xe499be2cU, // 69 0
+0xbc810a17U,0x33dded9fU,0xb8ebb5e8U, // 53 0
+0x5e5199adU,0x7a406e3dU,0xa9909dcbU, // 61 0
+0x7d5561d7U,0x6d2f7eabU,0x3122777bU, // 61 0
+0x5e8b96b2U,0xf68389a7U,0xa47f0140U, // 69 0
+0xf5be87d6U,0x2ed371bdU,0xdd70a9a8U, // 69 0
+0xafd4d865U,0xaf69ad99U,0x0bf09f7cU, // 59 0
+0x11fa7734U,0x08b8fd35U,0x3b0fa427U, // 59 0
+0x820383edU,0xc5d2835bU,0x43a44cd0U, // 71 0
+0xec7450ccU,0x04b056b5U,0x7f0a4715U, // 71 0
+0xe5daafd4U,0xe66b5267U,0x58ea9eb1U, // 63 0
+0x6fc7380aU,0x0a1b3c47U,0x255f0f80U, // 63 0
+0xf4573676U,0x6b81ec17U,0x1303b378U, // 75 0
+0x21d0bf84U,0xe9e37573U,0xd57ffb79U, // 65 0
+0x21d8d342U,0x124facf9U,0x048d09b8U, // 73 0
+0x637e1713U,0x69a85c21U,0xd3fb00cbU, // 65 0
+0xe63b3ee1U,0x5dabfa71U,0x4bb2f18dU, // 65 0
+0x54a8a558U,0xbe036d31U,0x51ef0824U, // 67 0
+0x79785c55U,0x0c7f71b1U,0x73838605U, // 59 0
+0xdd94e159U,0x53f93abdU,0x75b2b894U, // 59 0
+0xd09ba028U,0xf70bec55U,0x2785870eU, // 71 0
+0x27c1db8bU,0x301053c1U,0x762ff083U, // 61 0
+0xf4864820U,0x6a7a0169U,0x38a9db73U, // 69 0
+0x0d07057aU,0x0da23189U,0xebc01ed3U, // 65 0
+0x4456d0bfU,0x9865207bU,0x3dd35107U, // 71 0
+0xa7b892f9U,0x074aae63U,0x88d6ba2fU, // 77 0
+0xa1a19e92U,0x3cf5b28bU,0x8a98a523U, // 65 0
+0x37f1fdd3U,0xb178204bU,0x2fcd5d4eU, // 63 0
+0xac5cef37U,0x9aca8cd7U,0x19fed543U, // 63 0
+0x5b90a46aU,0x4948980bU,0x2b45e451U, // 75 0
+0x4c93b9b3U,0x1ced413bU,0xd8957465U, // 61 0
+0xa81f5096U,0x55663d21U,0xce92ea64U, // 59 0
+0x823c7cd3U,0xa3a9cb51U,0x2115f11eU, // 63 0
+0x52f777b3U,0xf5cbe069U,0x73a72d29U, // 61 0
+0x08f3785bU,0xe5209d99U,0x36a5a3c2U, // 63 0
+0xe49288baU,0xe2af2d33U,0x461de911U, // 65 0
+0x5ef7c30cU,0x4562f003U,0x91fc419bU, // 69 0
+0x3e6d9574U,0xf732255bU,0xb32ab0c8U, // 61 0
+0x73b6a878U,0xea484ae7U,0xf783caa8U, // 71 0
+0x4762b227U,0x79586e05U,0x6c1b8525U, // 69 0
+0xb8c3660dU,0xdb765ca5U,0x678c9ab3U, // 61 0
+0x8d6fa969U,0x8d387dd9U,0x973fe28aU, // 63 0
+0xc6330554U,0x1a561323U,0xcea13158U, // 65 0
+0x0b7254c7U,0x6a4fba23U,0x22c075d0U, // 61 0
+0x1e36aa18U,0x3ffe8463U,0x5c18852eU, // 67 0
+0xcd45c645U,0x695a5dc9U,0xc1524ef8U, // 63 0
+0xe433c667U,0xdca2826fU,0x32b2fcf9U, // 63 0
+0x94b16a17U,0x318ecbe7U,0x087f680fU, // 53 0
+0xa93c940dU,0x863a9fefU,0x0f5eb9eeU, // 69 0
+0x747dcec3U,0xc6cc0297U,0xa4cf986cU, // 65 0
+0x76472580U,0x64cd4e83U,0x12796e72U, // 65 0
+0xed39c51cU,0xe5d5abebU,0x559cfaf8U, // 69 0
+0x7c4cc0ceU,0x571eee57U,0xa05ceef8U, // 65 0
+0x72ebbf38U,0x8d2cf41dU,0x86621bb9U, // 63 0
+0x6548dd25U,0xb47d9bf5U,0x3843e056U, // 63 0
+0x7954ae2eU,0x90750d5bU,0x51c2c622U, // 71 0
+0x72a805d0U,0x3380060dU,0x89eed730U, // 65 0
+0x3716f38aU,0x7e65a9dbU,0x8baebc3fU, // 73 0
+0x06b54c8aU,0xbcfc5207U,0x8ef1d784U, // 59 0
+0x562ebef5U,0xb2c04bc1U,0xb3eb8bceU, // 59 0
+0xd7e027beU,0x05d30a97U,0x1f0a9912U, // 67 0
+0x5bfa468bU,0xcf53779bU,0x458bb4ebU, // 61 0
+0x9e964761U,0xa41b36c5U,0x73be6695U, // 73 0
+0x230af984U,0x44fa361fU,0x8f72b0ccU, // 55 0
+0xcfc61691U,0x128aebedU,0x4c84b42bU, // 73 0
+0xf4ef5914U,0x5ba012bfU,0xfb681ffeU, // 59 0
+0x065bcd9eU,0xc5b3ceb5U,0xad2da165U, // 73 0
+0xd3994988U,0x651f2e71U,0x1b216677U, // 61 0
+0x6d0f48dfU,0x748e57ebU,0x5c3f5212U, // 67 0
+0x31e78f0eU,0xa23fbec1U,0xfd936e2aU, // 67 0
+0x55cf7777U,0x15a8e183U,0xad3c148eU, // 61 0
+0x97363164U,0x4413ed31U,0xd446cffbU, // 69 0
+0x28a22307U,0x858d0b75U,0x3c097761U, // 61 0
+0x314f31d3U,0x7da83185U,0x7cb74c54U, // 71 0
+0xda3b630aU,0xc213f9fbU,0xe9e87dd5U, // 71 0
+0xe7716b85U,0xe929e4dfU,0x3f830591U, // 65 0
+0x6fe86ed3U,0xd39eb907U,0x01da0c27U, // 67 0
+0xb7a2cffeU,0xd92f5fbbU,0xb8f5799fU, // 59 0
+0x3f8add44U,0x4f89d47fU,0x8591284eU, // 65 0
+0x7c9d78eeU,0x0bcfb0f9U,0xd146d0c2U, // 63 0
+0x61a1974cU,0xc62cbc8fU,0xa17cf1adU, // 65 0
+0x17d7bd5dU,0xfbd118ebU,0x9b7df837U, // 69 0
+0x95562be9U,0x2eccd709U,0x95f991b0U, // 67 0
+0xcbc8a490U,0x74cd928dU,0x2b51e556U, // 63 0
+0xe8af4df5U,0xedc11287U,0x8fd89376U, // 61 0
+0x7256cd0dU,0x81a4f931U,0x7ecbb46cU, // 69 0
+0x2a8bbe23U,0x4cc37761U,0x5ba95db9U, // 65 0
+0x7f20ba8fU,0x58c3347dU,0xf9897675U, // 69 0
+0x34ee4008U,0x78b1ae9dU,0xf8c98c1eU, // 53 0
+0xc4f43380U,0xca75b3c5U,0x6e60294dU, // 75 0
+0xee9a13caU,0x2bfd76d3U,0x9cb7a50cU, // 71 0
+0x645b7e6cU,0xdbcfefb5U,0xe17f00e8U, // 75 0
+0x97a62dc1U,0xe4e8e93dU,0xef22469dU, // 61 0
+0x19304481U,0xc6ca40dfU,0x9f034129U, // 65 0
+0xd975f8e5U,0xc0b08101U,0x548c40b8U, // 65 0
+0x558e4deeU,0xe4a6fee3U,0x36caf5e4U, // 61 0
+0x2a00fd19U,0xe6f4c215U,0xd52c7898U, // 53 0
+0x7e267e96U,0x5b67ab91U,0x8c9406c4U, // 65 0
+0xc65c56c5U,0xdf0a12adU,0xfe3c2c64U, // 53 0
+0x935d0a49U,0xa7dc2899U,0x8738f20cU, // 69 0
+0x5bdd9b7eU,0xc9a3db5fU,0x29ad6bf5U, // 63 0
+0x8ed19335U,0x6ebc8f87U,0x699a251dU, // 63 0
+0x68bb20ccU,0x0fb20cb9U,0xe582c966U, // 65 0
+0xaf882817U,0xc4e25863U,0xf607ca0fU, // 71 0
+0xfed87936U,0x228ad68fU,0xe9f79681U, // 71 0
+0x1558b4d3U,0xb0e93985U,0xdb6395cdU, // 65 0
+0x744284a9U,0x67b57eedU,0x65fb8940U, // 61 0
+0xdd319d23U,0x66c44f57U,0x6b948f82U, // 73 0
+0x2fa3de9dU,0x476a9cc9U,0x93a710d8U, // 61 0
+0x9a8773ddU,0xe31de53dU,0xed384417U, // 53 0
+0xdea777f5U,0x7428673dU,0x195d88baU, // 61 0
+0x27d815b6U,0xd501c91fU,0x9f52868aU, // 63 0
+0x6d67670bU,0x0f7d7363U,0x0bfe3cd1U, // 63 0
+0xc0849978U,0x65e88b1bU,0xc6991330U, // 69 0
+0xac723a8dU,0x648261d9U,0x41c51407U, // 61 0
+0x2ba1f1aeU,0xc45d62f5U,0x2928b43cU, // 67 0
+0xb4bd67faU,0xc60ed693U,0x5f60f061U, // 65 0
+0x03663408U,0x9ecf77b9U,0x5f5fb31cU, // 73 0
+0xbcace59fU,0xbdceaa93U,0x47c0cb47U, // 71 0
+0x4736ff80U,0x3ef41e21U,0x417bdd62U, // 63 0
+0x9edbca44U,0xd76d8227U,0xe234e448U, // 65 0
+0x12a21109U,0x8b8a6e11U,0x694764a3U, // 63 0
+0xaaaef5f7U,0x3b80f5afU,0xfa065811U, // 53 0
+0x1c80d945U,0x7ac8f513U,0x167913a0U, // 59 0
+0xd5d1310cU,0x25081787U,0x115256b8U, // 67 0
+0xe0ef331aU,0xd9271d2bU,0x5ab64303U, // 71 0
+0x7bcd0feeU,0xb356b1bbU,0x94afe225U, // 71 0
+0xfb7423acU,0xa5060659U,0xc96d88fcU, // 61 0
+0x239979a7U,0x6e510531U,0xa21a440eU, // 61 0
+0x034b43aeU,0xa85f26f5U,0x41b950b0U, // 79 0
+0x8439c7ccU,0x6a5ecf39U,0xb730a7f2U, // 69 0
+0x58b7a338U,0xf6926607U,0x9d859779U, // 67 0
+0xf4c7a280U,0x67c9c5fdU,0x99090ae0U, // 61 0
+0x722dfa4fU,0x9fa6374fU,0xf34029deU, // 63 0
+0x65a27af3U,0x9466340bU,0x5be9b6bbU, // 55 0
+0xf55facdeU,0xd101900bU,0xd8f6a095U, // 69 0
+0x51c34442U,0x63262a95U,0x3c9565f5U, // 71 0
+0x83d309f8U,0x77e8299fU,0xaa911e26U, // 69 0
+0xc31d1f28U,0x7d261c27U,0x0ee576b9U, // 61 0
+0xf6fc40c0U,0x8ca71b55U,0x90c9fba8U, // 65 0
+0xbcaaf1b5U,0x3b604ec5U,0x59076106U, // 55 0
+0x4449e06aU,0x9df697a7U,0x2422a90bU, // 71 0
+0x8d3dc245U,0x488f6b6dU,0x77663f4aU, // 67 0
+0x8bdc3fa7U,0x80e8dd59U,0xc38da2bdU, // 73 0
+0xb356ac7fU,0x1d2e9133U,0x300b0a56U, // 65 0
+0xba4eac25U,0x0ebbadcdU,0xc6d879eeU, // 63 0
+0x6566b5dbU,0x79642cefU,0xaccd00b6U, // 65 0
+0x67032ca5U,0x3a9e4197U,0x9c909b32U, // 73 0
+0xd3ad192eU,0x7c2e35fbU,0x2919cd80U, // 79 0
+0x76818ea7U,0x1e9c5449U,0x08c7a16dU, // 61 0
+0x47ab1ac8U,0x29ba9a57U,0xcb5f6127U, // 69 0
+0xb4519d72U,0x276caab3U,0xeb6dda23U, // 69 0
+0xf354b5adU,0x0f708db9U,0xfff9a7e9U, // 65 0
+0x355c9b26U,0xc59bbd51U,0x9c8c11f1U, // 71 0
+0x2cb4d210U,0x4241b4e9U,0x3914d6c2U, // 61 0
+0x9b7750c5U,0x2d05f6bbU,0xf6ec7365U, // 65 0
+0x5b0d85e8U,0xaad6656fU,0xe8b50eeeU, // 61 0
+0xb4356da6U,0x9f908d17U,0xaabf994aU, // 75 0
+0x0ed416f5U,0x27393217U,0xf3a6a053U, // 59 0
+0x13217295U,0x229ddd37U,0x2d194230U, // 67 0
+0x8b12486dU,0x79b7d273U,0xbf0e6421U, // 63 0
+0xe3f7773aU,0xd7a43921U,0x4d13bd30U, // 67 0
+0x10f9a1bcU,0x497d5063U,0xc4af29e4U, // 59 0
+0x4543df66U,0xde0b8bb5U,0x824f9dbeU, // 73 0
+0x770d80bfU,0x83787cedU,0x187ab2f9U, // 71 0
+0x074b10d8U,0xd998ac2fU,0xe2d95abdU, // 67 0
+0xface69d4U,0xaea88bddU,0x85bd0207U, // 61 0
+0x72b225d2U,0x4e7b1399U,0xd2ef232aU, // 73 0
+0xf9b799feU,0x40e70fc5U,0xd764e64aU, // 75 0
+0xbc9d57d0U,0x106cda95U,0xd445921eU, // 75 0
+0x9c2887e6U,0x0d3eae75U,0x8f5d2be2U, // 73 0
+0x38d64ff3U,0x0454ccb5U,0x560d07faU, // 63 0
+0xf719ebf8U,0x63a43771U,0x212370e2U, // 63 0
+0xedc946a1U,0xe5671d4bU,0x2f10087dU, // 67 0
+0x2c7aad00U,0x6b72a697U,0x707dc788U, // 65 0
+0x25f64193U,0x1d51551bU,0x78e33013U, // 69 0
+0x994bc103U,0xa4728fe7U,0x9781ae9cU, // 61 0
+0x9819a0ffU,0xa105c64dU,0x71ac0323U, // 69 0
+0x36d522d2U,0xc13bb5a1U,0xff43ab20U, // 63 0
+0x2b76c27aU,0xefe0ccd7U,0x1f723c92U, // 63 0
+0x829ff097U,0x3077c52dU,0x2da7365cU, // 45 0
+0xc81f9a95U,0xc2ce6d5fU,0x8de2660dU, // 65 0
+0xbedcec21U,0xf42355b1U,0xbc832d4dU, // 61 0
+0x5fdcaeb7U,0xed7c2c3bU,0xdf85e99bU, // 69 0
+0x9cc985a7U,0xb6d32a21U,0xe8224c3eU, // 61 0
+)EOK"
+R"EOK(
+0x4b15ccabU,0x5a68a60bU,0xce5c965cU, // 63 0
+0xd48105ebU,0x199d8555U,0x08c80404U, // 63 0
+0xc833ba6bU,0xcefe6e49U,0x0be58afcU, // 59 0
+0xf6876818U,0x38cad269U,0xe300f724U, // 73 0
+0xd06deea0U,0x2b21be91U,0x7f0dd29bU, // 67 0
+0xfb3d83e6U,0xc5c606c3U,0xde24cd96U, // 59 0
+0xce402f98U,0x20be3b43U,0xc54bd45fU, // 67 0
+0x1d8e8d9cU,0x946cd7a9U,0xfb235c87U, // 63 0
+0xc0ea3e41U,0x9de7798dU,0x0fbe58c6U, // 61 0
+0x6aa1f5acU,0x90e909bfU,0xa855e057U, // 69 0
+0xe45e5d22U,0x58cc991fU,0x8069949eU, // 59 0
+0x822bda45U,0xbd362299U,0x301d28f9U, // 63 0
+0x30da34d7U,0x3638ab63U,0x3fc1b1dbU, // 61 0
+0x6a2654a2U,0x9760902fU,0x4648e6d8U, // 69 0
+0xf81537b5U,0xd5cc2d51U,0xecc14993U, // 65 0
+0xb3e313c2U,0x68d1acb5U,0xc38bead8U, // 51 0
+0x3665f21eU,0x6c0a6417U,0x95686a7fU, // 59 0
+0x8c7027b3U,0x1ec05defU,0xda661b05U, // 73 0
+0x3f4a7890U,0x198dedb1U,0x58727086U, // 69 0
+0xa07c17c7U,0x133526ffU,0x1692f655U, // 67 0
+0xfff73ff3U,0x655a3f99U,0xd1e86109U, // 69 0
+0x3c8b59ceU,0x2cf4310dU,0x621f28b9U, // 67 0
+0x18b5f675U,0xddf7e7f9U,0x085125e3U, // 65 0
+0x4d9146f2U,0x4aa5add5U,0x8055cd61U, // 59 0
+0x5c173251U,0x999d9bedU,0x7ce55226U, // 65 0
+0x760e742dU,0x90ca09ffU,0xf4f7c554U, // 65 0
+0x95ceec19U,0xf3016b87U,0x95dd70f7U, // 61 0
+0xe32db104U,0xaca8999dU,0x6948463dU, // 67 0
+0x8c5e5af3U,0x29184823U,0x6d56c934U, // 61 0
+0x7d63f8ccU,0xf7456c71U,0xa761dd68U, // 63 0
+0x4d848713U,0x63abc149U,0x73a72b6bU, // 69 0
+0x97f6d1afU,0xdf3caa5bU,0x5313ea96U, // 59 0
+0x81151eabU,0x8221d05dU,0x68039862U, // 65 0
+0xede83adfU,0x0e3efe97U,0xed6f9a48U, // 57 0
+0xe03f245aU,0x6cfe1039U,0x9738220fU, // 69 0
+0x236779ecU,0xf97179e5U,0x35255e21U, // 63 0
+0x18c52b60U,0xa35563e7U,0x4bdaa0b7U, // 67 0
+0xf004a104U,0xbd4b08b7U,0xcddd7e3eU, // 67 0
+0x13265c6cU,0xcab50857U,0x2f9e6defU, // 63 0
+0x51490992U,0xea521e3bU,0x052191bcU, // 75 0
+0x422354d8U,0x4cf955c7U,0x9fde0969U, // 63 0
+0x70ce3b99U,0x1423f959U,0xf90aa714U, // 75 0
+0x4cee0451U,0xedc1f4c3U,0x113ae092U, // 69 0
+0xd56b2160U,0x0837a671U,0xfb92e24dU, // 59 0
+0xbebdcfdeU,0x7a6637e1U,0xeff772abU, // 57 0
+0xc85b7117U,0x5845c46fU,0xa2d456e7U, // 69 0
+0x3e76b12dU,0x644992dbU,0xa2015e15U, // 63 0
+0x090f4829U,0x9cc17ec3U,0x2b776333U, // 65 0
+0xcbbc44baU,0x702c604fU,0x4d913570U, // 77 0
+0xfd695fc3U,0x27d33a23U,0x3b0c3c4dU, // 67 0
+0xda1e6662U,0x64385de5U,0xefdd119eU, // 57 0
+0x036754fbU,0x6bf34ee9U,0xbe6db012U, // 59 0
+0xa3fe0424U,0xd538f8c9U,0x1d2342daU, // 65 0
+0x38f10aa1U,0x340133c1U,0x55fdf02fU, // 65 0
+0xfe6d66e4U,0xf80e8ff3U,0x00b3e44aU, // 67 0
+0x8fcadb5fU,0x8da7ca29U,0x9585d9b7U, // 59 0
+0xc83e0c62U,0xec079105U,0xffa54d72U, // 79 0
+0xffb95a07U,0x15675023U,0xd5e379a9U, // 51 0
+0x498c9268U,0xfa14b77dU,0xaa12ead8U, // 63 0
+0xa031ba0bU,0xbd47e047U,0x12609545U, // 65 0
+0x1b16dc7eU,0x20026347U,0xe86b73faU, // 71 0
+0xc42c68c1U,0x4d28c42dU,0x60450be8U, // 65 0
+0xa09b67e7U,0x8fd5ac0dU,0xa00d9556U, // 67 0
+0x9418c385U,0x28eeed79U,0xd594ed09U, // 63 0
+0xf1a3c906U,0x8b67abfbU,0xcfac5bceU, // 67 0
+0xf7817142U,0xb612a489U,0x0dcf9f48U, // 65 0
+0x5453dd6cU,0x6cf653e5U,0xeadf259cU, // 73 0
+0xc369fcdfU,0x46ea0223U,0x1a8b7db1U, // 57 0
+0xf68ff1b9U,0x0b10c197U,0xb68b6f9bU, // 57 0
+0x1baf0577U,0xf20bda71U,0xcc2be772U, // 73 0
+0x63a41bc7U,0x7e4a2e89U,0xf4ed549fU, // 59 0
+0xdca47c27U,0xc6fd4e47U,0x222d990fU, // 61 0
+0x5a0b35c9U,0x8966d935U,0xcc4b2ab6U, // 67 0
+0xfd7bb8f9U,0x377b8785U,0x70524290U, // 79 0
+0xecfd5b8cU,0xe7f3cd85U,0x7add8bc3U, // 63 0
+0xc1f9d81eU,0xc11bfbe1U,0xa90e7aa9U, // 71 0
+0xba2f3de3U,0xf64df7f9U,0xa6dc63eaU, // 69 0
+0x01e92eb0U,0xbe5eb565U,0xc9d5d88cU, // 61 0
+0xda08eeaeU,0x6b94bfbfU,0x6c482e1fU, // 67 0
+0xd4935564U,0xeb7220e3U,0xf07f5a35U, // 63 0
+0xe8f5bddeU,0xa22c155dU,0x6bffb878U, // 65 0
+0xce29d9d6U,0xa9760185U,0xbdf805fdU, // 73 0
+0x5a70f181U,0xc6c721f9U,0xcca5ec94U, // 67 0
+0xc73a100bU,0x61f6ecddU,0x26cacb90U, // 61 0
+0x23d0d920U,0x4248ceb1U,0x3064c553U, // 77 0
+0x90d8cf0cU,0x1b3771e9U,0x813d4062U, // 63 0
+0xac868fa1U,0xd8364a09U,0x0994c925U, // 57 0
+0xd1c5d52fU,0xfb2e247bU,0x85410452U, // 71 0
+0x780dc4feU,0x1d0b3c35U,0xec92b0aeU, // 69 0
+0xcab16e18U,0x0060af23U,0x8c93073dU, // 59 0
+0x83b4782eU,0x3f689509U,0x6988eab4U, // 77 0
+0xae324315U,0xeeb626c9U,0xac1a0d6fU, // 61 0
+0xd300c8a0U,0x01cba557U,0xec2f35b4U, // 67 0
+0x9c7a2d36U,0x13046f0fU,0x7bac956dU, // 57 0
+0x63c25a91U,0x38eb5503U,0x57676f2bU, // 63 0
+0x41dab1bbU,0xe7152339U,0x6300af31U, // 61 0
+0x17bf7f04U,0xede0c7a1U,0x06dcdba6U, // 57 0
+0x7fe5cdabU,0xe308c153U,0x7a0aec4aU, // 59 0
+0xc85c7287U,0x3ab9db4dU,0xabd1670aU, // 63 0
+0x3a4eb45bU,0x1d478a6fU,0x6eec15e3U, // 59 0
+0xfcd53b23U,0x799bfbd7U,0xc363582aU, // 77 0
+0x649cf3c3U,0x13ffb4d3U,0xdbd39495U, // 67 0
+0xa484cb51U,0x514d5d43U,0x2fae7299U, // 71 0
+0xf47e1cceU,0xfea47a21U,0x006830eeU, // 67 0
+0x1450d172U,0xf929e3c5U,0xde2f4d28U, // 67 0
+0xa9039339U,0x41b37c25U,0x3b875164U, // 65 0
+0xbad95de5U,0x08cf16f3U,0xb9608a46U, // 67 0
+0xccf888d3U,0x95a8b44fU,0xbaacca5dU, // 59 0
+0x35c7403aU,0x314d1663U,0x007e7d37U, // 71 0
+0x1d5b4e9fU,0x5cbe2d77U,0x0d19e4ecU, // 67 0
+0x17731ddfU,0x805b7739U,0x0d5bf0fbU, // 67 0
+0x131eeae8U,0x0adefb23U,0x8d4dd85eU, // 69 0
+0x6594f547U,0x5b29b845U,0xaf17974dU, // 69 0
+0x412904b7U,0xd31b7169U,0xd69a2da9U, // 61 0
+0x9fc21f96U,0x1de782d9U,0xbc9ef7fcU, // 57 0
+0x24d6b44aU,0x382cd559U,0x18255786U, // 65 0
+0x8b4e1aafU,0x90d556cbU,0x8020311aU, // 71 0
+0x4cb01022U,0x3a50334fU,0x59a31224U, // 69 0
+0x941c3f10U,0x2012cc13U,0xe8a59ddbU, // 63 0
+0xead6f559U,0xd85ca8c9U,0x313e421bU, // 61 0
+0xcc246659U,0x44721085U,0x994893c6U, // 61 0
+0x1965c85bU,0xa82b232dU,0x1c215ed0U, // 71 0
+0x5fcf56acU,0x87a74bf5U,0xc56c2dd5U, // 69 0
+0x3e82e5ffU,0x3bbea761U,0xe8c1cc96U, // 65 0
+0x61f08e29U,0x244acae9U,0x5696c0fbU, // 65 0
+0xf9dcb833U,0x60adb0cfU,0xd07c0108U, // 61 0
+0xd0762930U,0x4060e873U,0x89f89a4fU, // 65 0
+0x4da402a9U,0x1871ebfbU,0x984a357dU, // 63 0
+0x2061e62dU,0x93d60789U,0xc5b3dbadU, // 57 0
+0x27fb01ecU,0x8f4ba843U,0x58788944U, // 67 0
+0x4a1d88d8U,0x3a0012adU,0xaf165275U, // 73 0
+0xe37896f2U,0x08efe0b3U,0xa3a93101U, // 63 0
+0x88b839f1U,0x116bcbb9U,0x09f63c72U, // 61 0
+0x91fb1c6dU,0x03e01769U,0x9b870554U, // 67 0
+0x6b76c3a2U,0xb4056207U,0xa18f3c14U, // 63 0
+0x628a5bd1U,0x5d6e4a1dU,0xb1315165U, // 65 0
+0xcb8ce169U,0x86e98513U,0x0b66d17cU, // 59 0
+0x4eeb394bU,0x7e8b9d31U,0x84a857eaU, // 63 0
+0x4d320aa7U,0x6649ffdbU,0xa1b41079U, // 71 0
+0x1e7e9804U,0x990b090bU,0x87e12155U, // 57 0
+0x4941f2dbU,0x3d097373U,0x54a1e5aeU, // 71 0
+0xafdaf9e3U,0x5543bb05U,0xe13d8865U, // 67 0
+0x9be7e7a7U,0xf550c7dbU,0xb2e8e1f4U, // 69 0
+0xeb1fec1aU,0xc1567d73U,0x857d726bU, // 61 0
+0x342baa85U,0x8dcc86bdU,0x57cf0937U, // 77 0
+0x176bfb0cU,0x4d63d0a1U,0x25d15927U, // 57 0
+0x089b5824U,0xbcb677dbU,0x4c23ef11U, // 67 0
+0x3d410eb9U,0x745737e5U,0x99e06537U, // 65 0
+0xfb6134eaU,0xe09e9e4dU,0x3186855fU, // 69 0
+0xebb70033U,0xa3483841U,0xc3a3b297U, // 69 0
+0x2dd3c551U,0x9e246dc1U,0x7b797ca9U, // 61 0
+0x9a21f369U,0x262bf11dU,0x8c9d81b8U, // 57 0
+0x8b3feff6U,0x220f6063U,0x7ef1a757U, // 61 0
+0x1f271f62U,0xa803ef8bU,0xcb6a9923U, // 65 0
+0xcc583a12U,0x9e2e8ccbU,0x24b93555U, // 59 0
+0xe79e1206U,0x87612407U,0xc7870549U, // 67 0
+0x3e47dfd3U,0x85d5e321U,0x3b0d0a0aU, // 65 0
+0x45e48717U,0x6984ae57U,0xaa4fb02cU, // 49 0
+0x4e4d5b77U,0xe1f38549U,0x72a5d215U, // 69 0
+0x96955a92U,0xe8ae8af7U,0xa17fe5bbU, // 61 0
+0x244d0534U,0xb9032495U,0x27bef496U, // 69 0
+0x2d3bdfb9U,0xe3655341U,0xaeea3a00U, // 65 0
+0x194488edU,0x4151e0ddU,0xa65c7b52U, // 61 0
+0x78526eaeU,0x2c6e653dU,0xd1589cf0U, // 73 0
+0x6ffee4d7U,0x473683cdU,0x46a805b1U, // 65 0
+0x8153f140U,0xed9bec6dU,0x77b8fde3U, // 63 0
+0x1b5c42b1U,0x7efbf551U,0x470082dcU, // 59 0
+0xa8f1d687U,0xad6f1335U,0x29173b79U, // 59 0
+0x418b582eU,0x9e4b5b7bU,0x0242c135U, // 63 0
+0x90605512U,0xec654d29U,0x454c970dU, // 65 0
+0x7af032b2U,0x7b79aa6dU,0xfc3f6c92U, // 69 0
+0xc166921bU,0x72104649U,0x4c9bc8b9U, // 71 0
+0x52a724d4U,0xa7065ad1U,0x576c4e5fU, // 57 0
+0x6e031b53U,0x7c6ca1efU,0xbda74896U, // 71 0
+0xd27b7167U,0x29cc26abU,0xe6fe2b71U, // 63 0
+0x7323c1d9U,0x31f08b0bU,0x85e45eb2U, // 61 0
+0x5a197b07U,0xf4137909U,0x42eb3243U, // 69 0
+0x130d47d4U,0x5afa6829U,0xa631bb5eU, // 67 0
+0x970dd5e0U,0x8bc6082bU,0x2449690bU, // 63 0
+0x3cb7af73U,0x3d6749adU,0x81cc4a93U, // 67 0
+0x6ac56185U,0xf9380c83U,0x7eedd312U, // 55 0
+0x50ed1f75U,0x297c4d27U,0x8324edfcU, // 61 0
+0xa1af6609U,0xcdf1e53bU,0x5058c298U, // 61 0
+0xf07f9010U,0x024dda03U,0xb1476336U, // 71 0
+0x40389dfdU,0xd790f243U,0xf91f5c74U, // 61 0
+0x912d4b6dU,0x77d3c80bU,0xab5e9551U, // 65 0
+0xefa41a51U,0xb480e841U,0x533d6560U, // 59 0
+0x982563a6U,0x2de062f5U,0x2942e58dU, // 71 0
+0x44d7b923U,0x43399715U,0xbc847221U, // 51 0
+0xb32d8d30U,0x06fd209bU,0x957b0829U, // 65 0
+0xa29e315cU,0xdef90ecbU,0xc34ba3bbU, // 73 0
+0xf352dad6U,0x0f510ed7U,0x3b505887U, // 65 0
+0xb7495c02U,0xa3f2d819U,0xf7256e8eU, // 55 0
+0x19802543U,0x8c1db9f3U,0x93ee59c8U, // 61 0
+0xe0a139a3U,0xe728a967U,0x101d3a84U, // 69 0
+0xdfbf7e0bU,0x0dd9ffd5U,0x5f75a232U, // 53 0
+0x0c8fc6daU,0xca9044a1U,0x1039dbd1U, // 65 0
+0x58fd769eU,0x56dc718dU,0xfd7a6cccU, // 63 0
+0x4801e633U,0x2fa07439U,0x9ae70bddU, // 75 0
+0x334791b4U,0x984b4a21U,0xff8e8b73U, // 75 0
+0x45d112bdU,0x3aea3ccfU,0x4f9d4c71U, // 63 0
+0x3e8ebb69U,0x9ac99a3dU,0x553bfb50U, // 67 0
+0x5f7459d6U,0x8f8a7fd9U,0x3d3d8406U, // 69 0
+0x1b5847c9U,0xe37b3447U,0xf559ffedU, // 63 0
+0x5c61f64cU,0x44c81dd7U,0x745d44eeU, // 61 0
+0xded00013U,0x9e11c323U,0x8766ef6eU, // 73 0
+0x260c8bafU,0xf947867bU,0xf2c73ae0U, // 79 0
+0x622239c2U,0xd47688b9U,0xf8659a66U, // 67 0
+0x2806778aU,0xad7f0341U,0xbed18a3cU, // 69 0
+0x1e477415U,0x4c03c3e9U,0x49d3740eU, // 65 0
+0x9b5218ccU,0xc645a8dfU,0x5c21002eU, // 61 0
+0x2cd31cf4U,0xb8d18377U,0xc9d16143U, // 67 0
+0x2b2c5904U,0xe0dc4ba1U,0xf8749ac1U, // 73 0
+0x798ceecbU,0x4df4e579U,0xdb221a8fU, // 61 0
+0x9afec9afU,0x3fd22187U,0xf0bc821eU, // 65 0
+0x65c94265U,0x25b29609U,0x84284dc1U, // 67 0
+0xa818b277U,0xf50a644dU,0xbbb3390bU, // 65 0
+0xdc0ad856U,0x578dc8fdU,0x10f597e3U, // 63 0
+0xd1460891U,0x2c047747U,0x58c83c3eU, // 61 0
+0xd956315eU,0x7a963995U,0xca42619dU, // 55 0
+0xa45b9a08U,0x95298dadU,0x237aabf7U, // 61 0
+0x2eadfb26U,0xb60963e1U,0xe38ca7c8U, // 61 0
+0x7c01e4e1U,0x7149ced3U,0x5a29c75dU, // 79 0
+0xefbecdaaU,0x4c711487U,0xe998d97cU, // 65 0
+0x667913eeU,0x1246c02bU,0x8896d198U, // 67 0
+0x1a3d9fa4U,0xa1876e63U,0xa4469a7cU, // 63 0
+0x3e079d27U,0xc61bfdffU,0xf84b67efU, // 51 0
+0x8f389a5cU,0x10dacdd1U,0xd8766fc2U, // 71 0
+0xc7d34be7U,0xac61c911U,0x26453491U, // 69 0
+0xa337dffeU,0x9690a525U,0x8f675218U, // 71 0
+0x3b20c1e7U,0x77683691U,0x14d0c50dU, // 73 0
+0x0a196ed5U,0xa107b7f3U,0x7b4b1b7fU, // 55 0
+0x216497c4U,0x34acdeddU,0xa57cefd0U, // 67 0
+0xea87fd14U,0xd10468b3U,0x962856c9U, // 77 0
+0x60e57c55U,0x093c6f73U,0x1395bf41U, // 69 0
+0x34830f96U,0x850e2b27U,0x7b954961U, // 61 0
+0xdd71ff56U,0x010cad87U,0x4c1e0a29U, // 59 0
+0x83fe9817U,0xd67037c7U,0xbb6f6c07U, // 57 0
+0x2bf34407U,0x15564175U,0x53d98c7fU, // 53 0
+0xea80fd5fU,0x2770dfe3U,0x002c6b8cU, // 69 0
+0xd5e7d39bU,0xfd845b05U,0x76c4f1c7U, // 57 0
+0x509ba27cU,0x9a73183dU,0x4c1866c9U, // 63 0
+0x642bb14bU,0xabcda3c3U,0xda52e24aU, // 65 0
+0x3e04d7b7U,0x4bb374dfU,0xc0fd13c0U, // 53 0
+0xdf7cd8aaU,0x07615cb1U,0x60a4d415U, // 71 0
+0x2e54967fU,0x728c3ac3U,0x42705c26U, // 61 0
+0xe4277da6U,0xf72c3541U,0x42607379U, // 65 0
+0x4eadcc41U,0x90d42dc5U,0x630ea957U, // 67 0
+0x3641cd3cU,0x8f55f167U,0x16f6099dU, // 57 0
+0xbb7e5f4bU,0x69bd5901U,0x8476f451U, // 71 0
+0x105a9b9bU,0xe09174bfU,0x9de8d12aU, // 63 0
+0xbfe07342U,0x8b99a029U,0xce08fd36U, // 71 0
+0xd9765f1dU,0xb6bd9131U,0x94343c9dU, // 69 0
+0xe6f12030U,0x91fd3339U,0xe6b27d8eU, // 63 0
+0xe4d0305cU,0x654d0c6dU,0xa01681b1U, // 65 0
+0xc7cb0dddU,0xe25f121bU,0xe5368c56U, // 57 0
+)EOK"
+R"EOK(
+0x578245b7U,0x29125063U,0xc6775470U, // 65 0
+0xdf87e23dU,0x925cac55U,0x58c1db3bU, // 81 0
+0x767d862eU,0x5e3845d3U,0x1a6efe95U, // 67 0
+0x1843e8b5U,0x938cc191U,0x0b89b75cU, // 61 0
+0x04fdfd4dU,0xa0bc823dU,0x9f988f56U, // 69 0
+0xf3e1d3d6U,0x382a36ebU,0x558b6cccU, // 71 0
+0x683e43c1U,0x6ac53255U,0xc14bceacU, // 75 0
+0xf7968436U,0x2019b381U,0xdaca522dU, // 63 0
+0xa9bdad78U,0x1573448fU,0xd5c272adU, // 75 0
+0xe3a8a2e6U,0x1dbcd7a1U,0xc231c5caU, // 73 0
+0xc6c91b37U,0x777900e1U,0xdf3f5d02U, // 53 0
+0x83e513ccU,0xbe653db5U,0xe5a61915U, // 61 0
+0xb3356fd2U,0x5691498fU,0xdebb716eU, // 69 0
+0xe994cb2eU,0x8e9758edU,0xe4a17d54U, // 69 0
+0x82848bd2U,0x6664a7cfU,0xdc7e7cc8U, // 63 0
+0x7c9ad4d3U,0x474e4a5fU,0xc5eb1fa4U, // 63 0
+0x913ad79eU,0xa8934cdfU,0x4d52de97U, // 73 0
+0x963592eeU,0xb86b9513U,0xe2e40c53U, // 63 0
+0xd5e156c9U,0xc67feb4bU,0xd9bfa2a5U, // 71 0
+0x3b5e9fefU,0xe1d2e9a3U,0xaeb4cc98U, // 61 0
+0x5543a2c0U,0x97664781U,0x00d2feacU, // 67 0
+0x28ba89dcU,0x264ed8f7U,0x5cdaa753U, // 65 0
+0x7663723eU,0xa7b39e3dU,0x9bef3979U, // 59 0
+0x8f25ea92U,0x640fc373U,0x758f58c3U, // 71 0
+0x24edf7efU,0x46c5ee8fU,0x1dc7a499U, // 61 0
+0x82cf8fd5U,0x3fc37e4fU,0xcce2a81aU, // 69 0
+0xadcd875aU,0x815ec175U,0x6ad8a895U, // 65 0
+0xc7fe6d8dU,0x57b9aaffU,0x52bbabc6U, // 71 0
+0x0c340175U,0x3c8bc395U,0x165991c0U, // 69 0
+0x124ada4aU,0x83ddc151U,0xea7b1d89U, // 65 0
+0x3513d3f8U,0xd41133b9U,0xea2cdd86U, // 61 0
+0x87222171U,0x7f7886fdU,0x384859ceU, // 65 0
+0xf0a7f1acU,0x3c74d4b1U,0xdb902351U, // 67 0
+0x92215baeU,0x905d3639U,0x31cdc9d7U, // 61 0
+0x5c3b3054U,0x47001883U,0x35935df9U, // 77 0
+0xb4726100U,0xcca75271U,0x97f7b9caU, // 59 0
+0xe6d0b48aU,0x0024e25dU,0x375d63f9U, // 65 0
+0x8cf2387aU,0xd1380793U,0x8228ff3bU, // 69 0
+0xb000a292U,0x9a0eac65U,0x508f98a1U, // 61 0
+0xfe059592U,0x84dc1b85U,0x452f99e1U, // 65 0
+0xb661bbbbU,0x024117c1U,0x123354ddU, // 69 0
+0xaefa93e8U,0x2bba76c5U,0x1ea232c9U, // 61 0
+0xd627a1c6U,0xa8b529b7U,0x6de7d0f3U, // 69 0
+0xd92e75dcU,0xd1f76bfbU,0x46735288U, // 61 0
+0xdb0ebabcU,0x4eddc667U,0x3a2371b1U, // 67 0
+0x2da0f38bU,0xb995a477U,0x33f0a69dU, // 59 0
+0x2fd7787eU,0xa9e3b59dU,0x8e8a8954U, // 67 0
+0xece1fcc3U,0xb0c028cbU,0xb26cdca6U, // 65 0
+0xd6e9db63U,0xc2aeb597U,0x14ddfbebU, // 65 0
+0x6c0d5da2U,0x29cf2e7bU,0xd23fa8a0U, // 63 0
+0x790ac9e5U,0xd4291585U,0x6164d602U, // 73 0
+0xd2ede57aU,0xc578a1edU,0x4a48e768U, // 63 0
+0x027c8137U,0xb8eb07e5U,0x28f8c378U, // 75 0
+0xf8ee1d9dU,0xbfda3429U,0xa5b6d97fU, // 69 0
+0xd51ee866U,0x4f60848dU,0xb089ba19U, // 75 0
+0x9aca2bc2U,0xa2c9c1ffU,0x5827e889U, // 65 0
+0x2b8811f5U,0x42cb3729U,0xd70c07d7U, // 59 0
+0xf29e07c4U,0x4d02eb67U,0x1bd386fcU, // 65 0
+0xcb1865a1U,0x4edd6981U,0xbad0f460U, // 69 0
+0xf5fd8134U,0xff5626b3U,0xe4d1ae84U, // 73 0
+0x2017b66eU,0x4630458dU,0x70e6101eU, // 63 0
+0xe10af48aU,0x511bd2ddU,0xb1c9c116U, // 73 0
+0x451ccbafU,0x4b694c1fU,0x72e2355aU, // 71 0
+0x73c050acU,0xc7b7ea37U,0x8d16b657U, // 57 0
+0x7ec159b8U,0x48b95db7U,0x0360554bU, // 59 0
+0x9da85954U,0xc4322cf5U,0x6da6e1c0U, // 63 0
+0xc86297eeU,0xf4a57d31U,0x1cc0ab8bU, // 69 0
+0x9e681d43U,0xd6389b8dU,0x1fc50bc1U, // 61 0
+0xe568af05U,0x662279cfU,0x0bcdbc9eU, // 71 0
+0x308c7713U,0x5c47b20dU,0xb959795aU, // 73 0
+0x68cf9dbbU,0x49943561U,0xfb27ca2aU, // 71 0
+0x1a17e2c5U,0x370f31a3U,0x19822eefU, // 71 0
+0x44e9a3f5U,0x51258f3bU,0x2fc19cafU, // 77 0
+0x87623383U,0x8681d153U,0x70174aa0U, // 59 0
+0xae397886U,0xad999823U,0x81fd00deU, // 65 0
+0xb223e62eU,0xd9ab0385U,0x7546a249U, // 65 0
+0x022b3065U,0x0912e099U,0x93bb5877U, // 63 0
+0x31307912U,0x9340e661U,0xa5e4e463U, // 65 0
+0x4219527eU,0x2b0921bbU,0xe62629e7U, // 59 0
+0xbfa701bfU,0x88059d49U,0x410b2e42U, // 67 0
+0x7834b7d0U,0x2f3f3fabU,0x94bb3b72U, // 55 0
+0x158f09f6U,0x3481eac3U,0x5b548c4bU, // 67 0
+0x1053f13cU,0x634a169fU,0x3c33e783U, // 55 0
+0xfd7bda97U,0x34bd52adU,0xa16f75bcU, // 63 0
+0x4ab31a92U,0x7f9b1d33U,0x76a17175U, // 57 0
+0xcb0e7e77U,0x00c3b9adU,0x3c87a2d5U, // 53 0
+0x59977434U,0xe4658da3U,0x12151b88U, // 73 0
+0x0c301eecU,0xc8da12cbU,0x8be8a11dU, // 79 0
+0xade09959U,0xb9538a85U,0x24f6c961U, // 69 0
+0x0fda2401U,0x3d5e3515U,0x8fe03e63U, // 61 0
+0x49bf4d48U,0x9b8b9e83U,0x31c1a079U, // 61 0
+0x31eb43c0U,0x68c6d129U,0x6941a0f9U, // 67 0
+0x6fbcb00bU,0xe6b52087U,0xf8670e68U, // 57 0
+0xaabb17caU,0xdb48c97fU,0xe49a0fc1U, // 55 0
+0x3af05bb6U,0x79609df3U,0x2839498fU, // 55 0
+0xf3ccf82eU,0xa9116ebdU,0x8ad6253aU, // 77 0
+0x088780fbU,0x2a9d239dU,0xf9aca16bU, // 67 0
+0xcc43e718U,0xf186fa07U,0xef0b253cU, // 75 0
+0xb0b5d698U,0x9eeb02adU,0xa5f2151cU, // 67 0
+0xf2f0619dU,0x9a6d622dU,0x8616a109U, // 53 0
+0x117ab706U,0xb150a60dU,0x29802bedU, // 57 0
+0x3be5bf9eU,0xb1d5c781U,0x5dd754ebU, // 73 0
+0xa0f06bcbU,0x49184d1dU,0x6eec8dcbU, // 65 0
+0xd675f7d4U,0x0cb34fd9U,0xd5bc9563U, // 61 0
+0x1e9eb0f7U,0x9f7227c1U,0x818eae20U, // 69 0
+0xeffcf862U,0xdd936ff3U,0x1cf24beeU, // 67 0
+0x235d7e83U,0x843f887fU,0x6fadf41fU, // 63 0
+0x98804b18U,0xb6a4665bU,0x77037aa0U, // 65 0
+0xd39d12fcU,0x7b773c2dU,0x13e7bd61U, // 67 0
+0x520bd80cU,0x729c1af1U,0x3b8b5ba2U, // 65 0
+0xb2cd84bfU,0x5f548953U,0x63583eafU, // 67 0
+0xa5996b6dU,0xfdaf72ddU,0xdb2fed75U, // 69 0
+0x5c1eede4U,0x9ccd2561U,0x22c90028U, // 67 0
+0x1ec50ce9U,0x0c791185U,0x52c85827U, // 69 0
+0x4913b89fU,0xe1c35081U,0xa316c267U, // 67 0
+0x83a9feddU,0x54d9d03dU,0x58b031d7U, // 61 0
+0xe660f06aU,0x1972a577U,0x084dd5edU, // 69 0
+0x94262125U,0x7b98be55U,0xe854a76eU, // 61 0
+0xcecbf94aU,0x2b3b145dU,0x16502823U, // 65 0
+0xc258ea23U,0x15ed500dU,0x18695eabU, // 67 0
+0x7032fb54U,0x3148dc11U,0x272db21bU, // 69 0
+0x98bd8011U,0x599fa4fbU,0xc2af4a05U, // 69 0
+0x27d3f78dU,0x37b05bb3U,0x4e000693U, // 65 0
+0xb93ed4dbU,0xba67d281U,0x191765a2U, // 67 0
+0xdd0f08dfU,0x10ce0483U,0x0310a402U, // 57 0
+0x0dc2f5dfU,0xdaa5f341U,0xfb1f8de3U, // 79 0
+0x3f2aeecdU,0xaf4bc389U,0xd3251ac8U, // 65 0
+0x04608c4fU,0x415e69b7U,0x0ff6425dU, // 57 0
+0x8ecca4deU,0xab2a21bbU,0x2d2c1399U, // 65 0
+0xc419de4bU,0x2d18c843U,0xc98c14f0U, // 63 0
+0x8682cf5fU,0xcba82a29U,0xe31ef6a3U, // 57 0
+0x24854561U,0xa8a17c07U,0xbbf121e4U, // 71 0
+0x0051a6d2U,0x2c5d481fU,0x94654fbcU, // 61 0
+0xbb018b60U,0x841df079U,0x4c924662U, // 73 0
+0x11925359U,0x9fde0307U,0xd2454515U, // 69 0
+0x8aff7300U,0x9ac230a5U,0x90ff3789U, // 71 0
+0xf392e47bU,0x908ebbb7U,0x48ff2d93U, // 63 0
+0xf8f7aaccU,0x5bf43ab1U,0xec651180U, // 59 0
+0xb9e7cc48U,0xf59fdb8dU,0x60f655a4U, // 65 0
+0xe217d02fU,0xeda8ad67U,0xe0fe6253U, // 67 0
+0xb081f764U,0x72347dcfU,0x1ff3a10aU, // 73 0
+0xdd4dd25fU,0x4014d9c5U,0x33e9a7ccU, // 69 0
+0xe034c933U,0x85983a41U,0xc686a123U, // 61 0
+0xb733fc1fU,0xc8d25d6fU,0x1b334094U, // 69 0
+0x3070a3efU,0x8839c081U,0x90c37979U, // 59 0
+0xc27f5681U,0x1fb73835U,0x6cb3caeeU, // 61 0
+0xafad543aU,0x3ff76e0dU,0x5506843eU, // 61 0
+0x3628f2b7U,0x1705f28dU,0x92404594U, // 65 0
+0x6927822eU,0x1d031359U,0x68ac6764U, // 59 0
+0x460dbf1dU,0x66d8fcc1U,0x01b427d5U, // 67 0
+0x734239f7U,0x98e2406fU,0xa8b8d9d1U, // 71 0
+0xbe9e9ac7U,0x3e18d081U,0xaeda341aU, // 61 0
+0x51f8c76fU,0x58023d33U,0x78ce1db3U, // 71 0
+0x39c9f540U,0x84654b3dU,0x3599531aU, // 67 0
+0x60cc5480U,0x482ebe73U,0xbc07c697U, // 69 0
+0xe8fb61dcU,0x339aba1fU,0x4365f9e5U, // 59 0
+0x6ec4e9beU,0x93d81a4bU,0xe99b8616U, // 61 0
+0x8b73e175U,0xbb735f29U,0x01061738U, // 61 0
+0x0170d18dU,0x54b3f59bU,0x8208fb36U, // 69 0
+0x38d5e584U,0x466b86ddU,0x800c881aU, // 67 0
+0x6f28dd65U,0x58b43b09U,0xc122402eU, // 63 0
+0xab5468daU,0x91533045U,0x31ed82a8U, // 71 0
+0xde8da0d3U,0x8d9ba9e3U,0x7c339f29U, // 71 0
+0xf1b9bb18U,0x7230c727U,0x4cb26812U, // 67 0
+0xf81d21aaU,0xd75bda63U,0xc4aefc40U, // 79 0
+0x533cc85fU,0xfd27a10bU,0x17d8f58cU, // 59 0
+0xba8a99e6U,0x6e15fd99U,0xb7b49aa3U, // 83 0
+0xa65cfa55U,0x449ce531U,0xbbd07623U, // 65 0
+0xda3653b1U,0x1b3eb9e5U,0x6d1ab1a1U, // 69 0
+0x1f0bec9dU,0x8dd1929fU,0x1cd0c325U, // 69 0
+0xf9553d4eU,0x9f42178fU,0xeea3c4acU, // 65 0
+0xbbab8d7eU,0xad538f19U,0x19025aafU, // 65 0
+0x79528d90U,0x3a7a09cfU,0x554133cfU, // 77 0
+0x1cde5bb7U,0xf6b0e611U,0xb445a938U, // 61 0
+0x1a3f456fU,0x3e87d5dbU,0xfb5621ccU, // 67 0
+0xaf0e7cccU,0xd8fcfcabU,0x7945c5c0U, // 59 0
+0xa83e1408U,0xf43a5c31U,0xd56bd094U, // 57 0
+0x12d324b5U,0x099dbcffU,0xcd690e22U, // 57 0
+0xe874a962U,0x5cc18007U,0x23839b48U, // 59 0
+0x14b55e8cU,0x10fd5f4fU,0xd3f68affU, // 59 0
+0xd1cada94U,0xbc6b8159U,0x01c12b85U, // 67 0
+0x56abf947U,0x50bfae89U,0xa1f2993dU, // 69 0
+0x80bde4b8U,0xc1adce85U,0x8a925dcdU, // 63 0
+0x2c718500U,0x9899bc29U,0xeef031d5U, // 73 0
+0xf44bdbf7U,0xc91f4193U,0xc7199707U, // 63 0
+0xf250349aU,0x817304b5U,0x7429e060U, // 69 0
+0x0e5bee04U,0x9b5db549U,0x987c04b3U, // 63 0
+0xb2985eb0U,0x6f6b2635U,0x26b4d222U, // 63 0
+0x88afe4edU,0x0dac6bd7U,0xe288ecb8U, // 57 0
+0x1ee2dccfU,0xc13ad2bbU,0x05b6dce4U, // 63 0
+0x29b05f96U,0x73a16b23U,0x26ce949dU, // 59 0
+0x9ea31a4dU,0xed1a1dcdU,0x25283964U, // 65 0
+0xb7b930c6U,0x38404b4dU,0x5fb2a7dbU, // 59 0
+0x1a581950U,0xf93ecf1bU,0x153d52a4U, // 63 0
+0x06ae8aaaU,0x542c5585U,0x6ed28058U, // 61 0
+0xa66da934U,0x693f5ddfU,0x9880bc9eU, // 55 0
+0x14bd1f99U,0x224db837U,0x71bd4ca2U, // 59 0
+0xe982d93fU,0xc23fd465U,0x61b62d3aU, // 63 0
+0x66fd6899U,0xacdceb67U,0xfcd6ab1fU, // 63 0
+0xe2c90478U,0xf07067c3U,0xbac0a710U, // 71 0
+0x73e8799cU,0x800fbdf7U,0x2d4dc0a4U, // 59 0
+0x8d745c81U,0x9777615bU,0x0d4523c1U, // 57 0
+0xd060b0f3U,0xddc16265U,0xda60ff55U, // 71 0
+0x269a3ba6U,0xc78c2805U,0xbcafd3e7U, // 67 0
+0xe2e47c54U,0x4b055ca1U,0xe4e08996U, // 67 0
+0x5550963cU,0xe9741ed1U,0xdc4a3ee7U, // 69 0
+0xc297f0e0U,0x667d1a0bU,0x47c460ddU, // 65 0
+0xed4466ceU,0x6bbfac13U,0x3815e7f4U, // 71 0
+0xa31c6253U,0x1dbeb6bbU,0x1bd71f37U, // 63 0
+0xc0846bb5U,0xac11bf45U,0x88a766beU, // 65 0
+0xa7902600U,0x0a216b91U,0x5e1e88c4U, // 61 0
+0x6ec5425eU,0x91d3b0e3U,0x9c3dd39fU, // 61 0
+0x3d44357eU,0xce172a31U,0xfb98617aU, // 79 0
+0x17fdb1afU,0xbacc9b61U,0x92040c8aU, // 63 0
+0x9f21a2c0U,0xf0452459U,0x45497ab4U, // 67 0
+0x0d6de364U,0x84a40aa5U,0xfd08ab7bU, // 63 0
+0xe57791aaU,0xc7654247U,0x74f2e64bU, // 59 0
+0x531bf766U,0x8714fff9U,0xcb0276b8U, // 63 0
+0xff899cc5U,0x1ed6ef69U,0x01ab0692U, // 71 0
+0xb05dda47U,0x37230cabU,0xceed9a7dU, // 61 0
+0x7f67d93fU,0x3a977071U,0x085fcbdbU, // 61 0
+0x4e9ef38cU,0xed7346d5U,0xdb8fd435U, // 63 0
+0x30751beeU,0x60dff06dU,0x81b723f0U, // 67 0
+0x138a1d33U,0x740b8afdU,0x50c9f85bU, // 61 0
+0x199eb5e0U,0x1b5c9627U,0x040ff58bU, // 67 0
+0x8ed38136U,0x515fd321U,0x30c967c4U, // 69 0
+0xac021ac3U,0x01a455a7U,0xd8dab24fU, // 71 0
+0xe8cd1eabU,0x306d8c37U,0x026fae23U, // 65 0
+0x76d39c0fU,0xbf2b5881U,0x530ff21aU, // 63 0
+0x7bc33d14U,0xd6f1ff3fU,0x102b4860U, // 69 0
+0xc6424e2bU,0x4f55fae5U,0x5bf661bcU, // 65 0
+0x21ada22cU,0x0f0fb85fU,0x515921fcU, // 53 0
+0xecd7e44dU,0x5957ad3fU,0xff1e6f48U, // 61 0
+0x12e74241U,0x7ead9cfdU,0xa84432e3U, // 61 0
+0xe21f36eaU,0x9574cfbdU,0xac289022U, // 71 0
+0xb161680eU,0xb9ccdf13U,0xa6952bf2U, // 57 0
+0x120bb451U,0xc55591b1U,0xc44651d8U, // 67 0
+0xef8cbc3cU,0x38987a5dU,0x93075ce2U, // 63 0
+0xc41f48a1U,0x8237352fU,0x2375645eU, // 65 0
+0xc4e68fabU,0x6bfe2077U,0xbc0c12afU, // 63 0
+0x237614bdU,0x0f16c361U,0xaca53406U, // 69 0
+0x448f6ee2U,0x813ca947U,0x312ea220U, // 69 0
+0xac993351U,0x19caa653U,0xc5cb59efU, // 75 0
+0x2bfde145U,0x6d9f4883U,0xb90c787bU, // 73 0
+0xbd7df6cbU,0x09927e83U,0xf0809306U, // 63 0
+0xee5e5109U,0x9d8e75cbU,0x3568c107U, // 67 0
+0xde87f3d5U,0xb8682325U,0x58986806U, // 59 0
+0x1efcded7U,0x23b2cb95U,0xcba6e997U, // 65 0
+0x8e358a48U,0xd7dc7a97U,0x78e71439U, // 57 0
+0xc24322abU,0x07c3ebb5U,0x372b0bdcU, // 63 0
+0x0d6dbb45U,0xfac70d71U,0x7049eec0U, // 63 0
+0xe8ee86caU,0xb6161e53U,0x318f6150U, // 71 0
+0x4c89766dU,0xd2b1b279U,0x40b074abU, // 69 0
+0x8c20a83bU,0xbb33beddU,0x5d24a81cU, // 59 0
+0x418dc1adU,0xdf52be61U,0x73e7923cU, // 69 0
+0x3649b101U,0x40f707f7U,0x8e03575cU, // 59 0
+};
+
+/**
+Seeds tinymt32 RNG with the parameter set of instance id.
+
+@param state Variable, that holds state of the generator to be seeded.
+@param seed Value used for seeding.
+@param id Index of the instance of the generator.
+*/
+void tinymt32_seed_instance(tinymt32_state* state, ulong seed, uint id){
+	uint p = (id % TINYMT32_NUM_PARAMS) * 3;
+	state->mat1=tinymt32_params[p];
+	state->mat2=tinymt32_params[p + 1];
+	state->tmat=tinymt32_params[p + 2];
+	tinymt32_init(state, seed);
+}
+)EOK";
@@ -0,0 +1,2101 @@
+// Parameter sets of tinymt64 for one parameter set per PRNG instance (see
+// clrand_set_instance_params), written by src/tinymt_dc. The characteristic
+// polynomial of the recursion of each set (mat1, mat2) is irreducible of
+// degree 127, so that every instance has the full period 2^127-1, and
+// differs from those of the other sets, so that every instance runs its own
+// recursion. tmat is tuned so that the outputs are equidistributed up to the
+// upper bound in every dimension. The comment on each row gives the weight
+// and delta of the set, as in the output of TinyMTDC.
+// The table is split over several literals to stay within the length
+// limits of some compilers.
+const char * tinymt64_params_kernel =
+R"EOK(
+/**
+Parameter sets of tinymt64, one per PRNG instance. Streams with more
+instances than sets are rejected when they are readied.
+*/
+#define TINYMT64_NUM_PARAMS 1024
+
+__constant uint tinymt64_mats[TINYMT64_NUM_PARAMS * 2] = {
+// mat1, mat2, // weight delta
+0xcbeab12eU,0xdea32be0U, // 61 0
+0xec7b12ddU,0xf6fb0f09U, // 63 0
+0x7a8b111eU,0xd5a8e3beU, // 59 0
+0x86e6d2b6U,0x63cc86e4U, // 71 0
+0x418c708cU,0xe9c101eeU, // 69 0
+0xe626b546U,0x1ee0b2bdU, // 71 0
+0xfe54ea87U,0x60b2e6f1U, // 73 0
+0xbd677998U,0xdedc2b9dU, // 71 0
+0x6011dbf7U,0x8191dad5U, // 67 0
+0xe04579c8U,0x253d5feaU, // 61 0
+0x6237ad29U,0x827a8747U, // 57 0
+0x75f380b7U,0x0b1d0d76U, // 61 0
+0x23d33f01U,0x8f7660f3U, // 63 0
+0x1c422038U,0x1b060aafU, // 67 0
+0x7f700d67U,0x0cfbf37fU, // 69 0
+0x7e2b65faU,0xd9ddb926U, // 69 0
+0x459de097U,0xcb6966d1U, // 69 0
+0x39fc1937U,0xe8818a5aU, // 65 0
+0x8bbdf9b3U,0x3ae41900U, // 65 0
+0xb81f298fU,0xe07ff796U, // 55 0
+0x909f1b65U,0xc351ea26U, // 75 0
+0xd5ae2fd2U,0xcc783405U, // 47 0
+0x8750ac8dU,0xdebad1a9U, // 63 0
+0xeb71e745U,0xd44bec78U, // 61 0
+0x1c2d8eecU,0x26cb9723U, // 59 0
+0x8675cb15U,0xb9a69797U, // 69 0
+0x87399501U,0x7179a660U, // 53 0
+0x1d9afdf7U,0x5990cb33U, // 65 0
+0xd20a783eU,0xcbc2fafeU, // 67 0
+0x4db77ea9U,0x063eff71U, // 69 0
+0x9b796731U,0xb6310a01U, // 63 0
+0x75175d0fU,0x0b4a91a7U, // 61 0
+0x039ce763U,0x14606723U, // 69 0
+0x1758fd85U,0x7f5fe96aU, // 61 0
+0x1ea45c60U,0xe122334bU, // 71 0
+0x7afadeafU,0x1e6e5aacU, // 67 0
+0x45e8e792U,0xf47a19e0U, // 63 0
+0xc174d65dU,0x15739cb2U, // 71 0
+0x4979daadU,0x4b52a534U, // 63 0
+0xc32baa74U,0x8083e394U, // 55 0
+0xf7c17ff0U,0x1bf42580U, // 63 0
+0x28d23babU,0x10a44600U, // 69 0
+0x9c5c2d13U,0x71c7cd11U, // 71 0
+0x297b1f4bU,0x5ce61ae3U, // 69 0
+0x32edaa7eU,0x6fefc193U, // 59 0
+0x8615d0a7U,0x913201a9U, // 67 0
+0x9bf1f607U,0x5213aedaU, // 65 0
+0x5a4a1416U,0xb03d3f8eU, // 69 0
+0x8f5d7b85U,0x0a6ef7c2U, // 61 0
+0xa7bdcb49U,0x19f9eefdU, // 57 0
+0x12265f6eU,0x46f43d1eU, // 57 0
+0xf6739bbfU,0x2699300eU, // 61 0
+0xbecaa83cU,0xbb4d01ddU, // 69 0
+0x74cd8e80U,0x8d1c7b06U, // 75 0
+0x16fff739U,0x4a8e28deU, // 65 0
+0x29333155U,0x7cd2fd33U, // 65 0
+0xf3aad1eaU,0xc483e153U, // 63 0
+0x9ef08a45U,0x2da874c7U, // 75 0
+0x6409cbd6U,0x2cbae9ecU, // 59 0
+0xef16fcb3U,0xf550f93fU, // 73 0
+0x5a2bfb9aU,0x9aa45fd6U, // 73 0
+0xd07f03e5U,0x07ac10c5U, // 73 0
+0x73e274e0U,0x054e24f7U, // 61 0
+0xc08973aeU,0xb0d66afaU, // 57 0
+0x1b3d62f5U,0x8484af9fU, // 59 0
+0x38358c4fU,0x9fe653bcU, // 73 0
+0x8fd371edU,0x50ebec61U, // 59 0
+0x43bf2497U,0x2c1df3aaU, // 69 0
+0xf74b27aeU,0x54a4dc72U, // 67 0
+0xfbcf4be8U,0x96d73100U, // 59 0
+0xf4c592d0U,0xdb5d490cU, // 55 0
+0xcae17c5eU,0xeadd89a7U, // 65 0
+0x44d94db1U,0x580e581cU, // 67 0
+0x2b97b2c7U,0xda862c0dU, // 67 0
+0x94f578bdU,0xc3a01e48U, // 59 0
+0x23e3e470U,0x22cd4884U, // 63 0
+0xf10aab44U,0x212e1c69U, // 57 0
+0x5c3dbbafU,0xb1c574c1U, // 65 0
+0x52f645cfU,0xc769d5f3U, // 63 0
+0x99e24ac4U,0xab8b1684U, // 55 0
+0x8850b73dU,0x6fcc67caU, // 59 0
+0x68883a8eU,0xd7213dddU, // 63 0
+0xb62971c2U,0x1b0570e3U, // 63 0
+0x191c5a75U,0x43e260dfU, // 71 0
+0x5d8fc5a4U,0xdc30467dU, // 67 0
+0x82869e8cU,0xf2a39e0cU, // 59 0
+0xa5cf19faU,0x07de6b8eU, // 71 0
+0x67d42363U,0xe88ca48bU, // 67 0
+0x2b4767c2U,0xde518c72U, // 71 0
+0x87975ea7U,0xcaff7899U, // 63 0
+0x7491a411U,0xd86cb160U, // 61 0
+0x41093904U,0xe8599312U, // 67 0
+0xd46442ceU,0x5555298bU, // 73 0
+0xf6858a88U,0xdde8edf5U, // 61 0
+0x3bee3bb8U,0xaee1a9ebU, // 55 0
+0xe042df62U,0x1dd9ff58U, // 67 0
+0xc58ac0ecU,0xcf990331U, // 65 0
+0x5fe52c64U,0xca0995dfU, // 51 0
+0x1cde790bU,0xd26db827U, // 73 0
+0x8e8e3456U,0x2f22d218U, // 69 0
+0xd9a0b51eU,0xc42b2d66U, // 67 0
+0x4d43e7f4U,0x0cae8ff2U, // 63 0
+0xb63d17b9U,0x440fd123U, // 65 0
+0xeaf9dbfbU,0x68ddaf5bU, // 59 0
+0x378f947cU,0x2cf593cbU, // 59 0
+0x0ddc501fU,0x26dbd32cU, // 69 0
+0x38f33da1U,0x14202243U, // 67 0
+0xaedbaacdU,0xa8b371a6U, // 59 0
+0x3c54213fU,0x7d82be34U, // 65 0
+0x574d155cU,0x597718c6U, // 65 0
+0xe8aa88b0U,0x2e02434dU, // 65 0
+0x5796805dU,0xd10091e4U, // 63 0
+0x3b80ce5eU,0x42a710acU, // 63 0
+0xb2b74cc7U,0xaff12a2eU, // 65 0
+0x91330f75U,0x1074200dU, // 63 0
+0xe3b758abU,0xa67c6dd7U, // 69 0
+0x987716afU,0xc6ea1dc1U, // 69 0
+0xcd26a75cU,0xe0397225U, // 59 0
+0x406d0d20U,0x5da98a07U, // 63 0
+0x45d4a407U,0x3b792550U, // 65 0
+0x152f6feeU,0x32a1a6f4U, // 79 0
+0x652719a6U,0x37de4faeU, // 73 0
+0x9162bb30U,0xc06f1bffU, // 69 0
+0xb30c5316U,0x07333c5eU, // 57 0
+0x835bcdd1U,0xd651655cU, // 67 0
+0x0990e541U,0x0cdae860U, // 61 0
+0xe010641dU,0x122b8cfcU, // 65 0
+0x52d3c44fU,0x1ba24781U, // 67 0
+0xfeb8fcdfU,0x39287341U, // 69 0
+0xadd6c3c5U,0x92080c03U, // 57 0
+0xc7441a0eU,0xa5c17887U, // 63 0
+0x2a75393dU,0x54ac4382U, // 69 0
+0xb4c40ba8U,0x3d37b2a5U, // 53 0
+0xb53e8a97U,0x339cca58U, // 59 0
+0xcab9b3a7U,0xd0a7618bU, // 77 0
+0xfcdbfad1U,0x353b729eU, // 69 0
+0x29e5fb52U,0xe97a62ddU, // 71 0
+0x72291ad6U,0x232ac81aU, // 73 0
+0xb53d2191U,0x15e62f36U, // 69 0
+0x1ca3a6d4U,0x84401620U, // 73 0
+0x7e3af707U,0x22c23271U, // 67 0
+0x266ed8e8U,0x798bbf83U, // 63 0
+0xf47b1d27U,0x41226e3dU, // 59 0
+0x55f3b71fU,0x40203ac5U, // 65 0
+0x4bfc79edU,0x5295660fU, // 71 0
+0xdd3793f7U,0xfd3b6810U, // 71 0
+0xe41f24fbU,0x4a33f3e2U, // 79 0
+0x568c8c3eU,0x6ffbbb09U, // 61 0
+0xbcd78143U,0x1a7422fdU, // 67 0
+0x2c06847aU,0x3ef68975U, // 65 0
+0x913aea2dU,0x21d17b3aU, // 59 0
+0x611795fdU,0xc945ae2aU, // 57 0
+0xd00d8aaeU,0x77a7c4e0U, // 67 0
+0x4b833756U,0x229926d0U, // 69 0
+0xaaf8ce5fU,0x57e4f2f9U, // 71 0
+0xd5ed646eU,0x87b72f0cU, // 65 0
+0x21a5fc8cU,0x49e051b3U, // 65 0
+0xd797d6d9U,0xfc38d489U, // 69 0
+0x99167df7U,0xd1c23801U, // 67 0
+0xd29c8d3fU,0xd358a118U, // 65 0
+0x1de882a2U,0x69e5c589U, // 59 0
+0xfa162ea9U,0xf12bc940U, // 71 0
+0x39d7829dU,0x4059bb1aU, // 53 0
+0x59e7a154U,0xc22f2af8U, // 63 0
+0x5f7a2593U,0x98a002a0U, // 75 0
+0x84b82831U,0x134a130fU, // 67 0
+0x3cc7e826U,0x51257ebeU, // 69 0
+0x9674834bU,0x3fb532c1U, // 73 0
+0x18603fcaU,0x8c9a48f9U, // 61 0
+0xd568f674U,0xa40a54a6U, // 63 0
+0x8582e262U,0x477ee919U, // 67 0
+0xd80df36eU,0x6e5fc0e1U, // 67 0
+0xa7c5f464U,0x2e72cf8aU, // 63 0
+0x258e2800U,0x788f0155U, // 61 0
+0xaef55873U,0x68990c41U, // 57 0
+0xdb71524dU,0x6c78f14eU, // 57 0
+0x6f134e8fU,0x89f6f798U, // 65 0
+0x119be585U,0x914c92cbU, // 69 0
+0xd0c6b986U,0x0316e027U, // 61 0
+0x33069790U,0x5d50be9fU, // 65 0
+0x1f4d450cU,0xad84ec5dU, // 61 0
+0x6f958fb9U,0x1737d1e8U, // 67 0
+0x582846aaU,0x248a111eU, // 57 0
+0xfc8ae180U,0xa12b5c4eU, // 69 0
+0x4c9effd9U,0x54b089f1U, // 67 0
+0x3c44d8b2U,0x630ca563U, // 69 0
+0x72a40784U,0xb3b1d429U, // 67 0
+0x98853c38U,0x11506ee1U, // 59 0
+0xfd442d98U,0x109f2ca7U, // 67 0
+0x11db8e19U,0x7d3f3983U, // 67 0
+0xa344e068U,0x3b6d925fU, // 71 0
+0x034dace6U,0x5cb5c7caU, // 59 0
+0x20a85f82U,0xc556f035U, // 67 0
+0x754f3772U,0x7f7426b9U, // 59 0
+0x8df92241U,0xcfd19351U, // 73 0
+0x99419eb8U,0x551e9389U, // 63 0
+0xfb6d5966U,0x77ae5781U, // 65 0
+0xdce0d838U,0xecf92fbcU, // 67 0
+0x1a6cc0fcU,0x2c4900a6U, // 71 0
+0x2d3abe69U,0x1983c6b7U, // 57 0
+0xb2865ffaU,0x4a5b0845U, // 71 0
+0xfb87f48cU,0x3e259da0U, // 67 0
+0xab201390U,0x62f3109eU, // 65 0
+0x6ee5ab0cU,0x4fde8147U, // 67 0
+0xb12f548cU,0xbe193c7fU, // 51 0
+0x61c36adaU,0x83f51aa2U, // 65 0
+0x8a8a44b4U,0xa3caff09U, // 57 0
+0xa5550d93U,0x25181ac8U, // 65 0
+0x31ec4d92U,0x9acae9f9U, // 69 0
+0x156bf476U,0xc135fd7fU, // 63 0
+0x602908f6U,0xbc6e20cdU, // 65 0
+0x75f58c4fU,0x1ca135a0U, // 69 0
+0x7513009dU,0xac8fd072U, // 59 0
+0xd485a944U,0x496cd2eaU, // 63 0
+0x6e891ccaU,0x984cd35fU, // 67 0
+0x28bcf07dU,0xbe950718U, // 69 0
+0xbc9ae19bU,0x92e11b87U, // 61 0
+0xddc835d4U,0xc82ff525U, // 65 0
+0xca4a8138U,0xf769c1f1U, // 67 0
+0xe16d99f8U,0xcac6a94fU, // 53 0
+0x8afc5021U,0xf0c33cbaU, // 75 0
+0x3b3d00cdU,0xe4dba8e1U, // 77 0
+0x523d8ee9U,0xd6e2ffd6U, // 69 0
+0xe7d4fd95U,0x8d1974d9U, // 69 0
+0xcf826378U,0x54dfe26aU, // 55 0
+0x02fa94ffU,0xea58390aU, // 71 0
+0x956c0b7aU,0x965957b0U, // 67 0
+0x015d1ac9U,0x6dd2243eU, // 63 0
+0x63605314U,0x61e65ea4U, // 61 0
+0x6633d9ffU,0x12427181U, // 65 0
+0x7e0b7c16U,0xe6864e60U, // 67 0
+0x65c2b6a6U,0xbf285182U, // 75 0
+0x90d5b13fU,0xcc0af6baU, // 67 0
+0x7f8581f2U,0x1a60c0a2U, // 67 0
+0x339c6331U,0xcc8b1c0aU, // 69 0
+0x806d58faU,0xbd8157fdU, // 59 0
+0xe0e5bc7eU,0xe7571de3U, // 71 0
+0x10c19fbeU,0xf7899defU, // 65 0
+0xf67eca35U,0x299844b5U, // 65 0
+0x81163ec1U,0xc0e8a70aU, // 63 0
+0x69c30e44U,0xf988bfd6U, // 65 0
+0x6157ad15U,0x3d6603f2U, // 63 0
+0x526155b8U,0xefd6bb4fU, // 59 0
+0x3082f268U,0x7ca81babU, // 63 0
+0xcc272164U,0xb0d0b93fU, // 75 0
+0xafc72f72U,0x3d251839U, // 63 0
+0x7c5e488bU,0xd65ad267U, // 65 0
+0x593e8b57U,0x984726c8U, // 55 0
+0xb65f1ec3U,0xc3379ec5U, // 63 0
+0xd531ce0dU,0xc58c407eU, // 67 0
+0x9c54e7cbU,0x2d885854U, // 61 0
+0x883a1fd3U,0x46d0aad6U, // 65 0
+0x313d5a6fU,0x0063e935U, // 67 0
+0x8809630cU,0xd33604a9U, // 65 0
+0xb9818526U,0xb8fa4bc8U, // 77 0
+0x2c272934U,0x2e689df3U, // 65 0
+)EOK"
+R"EOK(
+0x9ed7bac1U,0xc9b2233aU, // 59 0
+0x6d9d026dU,0x6e911b93U, // 67 0
+0xf148571aU,0x46e9e267U, // 63 0
+0xe459bad5U,0x496006adU, // 69 0
+0x3066411cU,0x01b52d34U, // 65 0
+0x2314a939U,0x48321d70U, // 65 0
+0x363906dfU,0xc9ff855aU, // 59 0
+0x5aef527eU,0xf9d49eeeU, // 59 0
+0x3b8af678U,0xe83407beU, // 67 0
+0x294c8486U,0x6851ecc0U, // 67 0
+0xd78e128cU,0x01a56b47U, // 61 0
+0x49708407U,0x55143bcdU, // 67 0
+0x4cf49c55U,0x552d8c34U, // 63 0
+0x04a54532U,0x6ca5aad5U, // 69 0
+0xa86c06eeU,0xa260a0c6U, // 71 0
+0xbabc0779U,0x012d0767U, // 71 0
+0x5da638bcU,0xb49ae309U, // 63 0
+0xd0132e05U,0x7dd3b07dU, // 65 0
+0x83de1ab7U,0x5e61b6ffU, // 63 0
+0xfb6494aaU,0x3276d758U, // 75 0
+0xa15e9ad7U,0x02f9e33dU, // 71 0
+0x8857b549U,0x76e69213U, // 57 0
+0x8db52f41U,0x61596486U, // 69 0
+0x026f9f7eU,0xccf317e4U, // 55 0
+0x6debe90eU,0x2a28453fU, // 59 0
+0x3bc2843aU,0x12cc8918U, // 75 0
+0xa2763b37U,0x18e4f3aaU, // 73 0
+0x14d6767bU,0x471df49cU, // 63 0
+0x24235600U,0x54c9a52cU, // 63 0
+0x7b9f1957U,0x33a9a2e2U, // 55 0
+0x99f76db5U,0x5524b2b6U, // 65 0
+0x9e8be49eU,0x7d675763U, // 57 0
+0x1cce8352U,0x97ac70aeU, // 67 0
+0x517d5049U,0xf9305d82U, // 69 0
+0x97352187U,0x3d05c532U, // 67 0
+0xa16895f4U,0x2f3ee755U, // 71 0
+0x8af54e5fU,0x53fde152U, // 57 0
+0x1e288d9cU,0xf6403cd2U, // 61 0
+0x80d5d90bU,0x19d3c07cU, // 65 0
+0x2dd08825U,0x77136ab2U, // 63 0
+0xed78df5bU,0x7c9ea25bU, // 65 0
+0x0d2f1c78U,0xbe0f97a1U, // 69 0
+0x53eeddcaU,0xfebd923cU, // 63 0
+0x3f4307a8U,0x10910793U, // 63 0
+0x379682efU,0x1c6f6be0U, // 71 0
+0x88e4f48eU,0x5b351769U, // 63 0
+0xe700ea70U,0x9d87e6cfU, // 73 0
+0xd970c237U,0x9c3bc624U, // 63 0
+0x7bc19e52U,0xf887e389U, // 63 0
+0x34736df5U,0x160855c6U, // 69 0
+0x4e02ab9cU,0x90c44c41U, // 65 0
+0x5a7b6d5dU,0x74782a01U, // 65 0
+0xfd972c09U,0x052b9faaU, // 69 0
+0x7cd3f317U,0xdbdb80b9U, // 67 0
+0x6a2e1330U,0x32056b40U, // 67 0
+0x4951533bU,0xb828842aU, // 67 0
+0x1a991f37U,0xc0d90112U, // 63 0
+0xce76468dU,0x02450cafU, // 73 0
+0xe67318b5U,0xd5271aadU, // 67 0
+0x1e2799aeU,0xc6fa275dU, // 59 0
+0x4aa4ccdeU,0x422af773U, // 61 0
+0xbdd4c483U,0x322745afU, // 67 0
+0x6c11de97U,0x44616d4eU, // 67 0
+0x751abe43U,0xe953e3f6U, // 63 0
+0x894b9792U,0x31f9c0baU, // 77 0
+0xd83943e5U,0xf21a86ddU, // 77 0
+0x03ca8712U,0xb52a48a6U, // 61 0
+0xadda08d3U,0xba16ca89U, // 69 0
+0x0e957a7bU,0x9afc8970U, // 65 0
+0x262f19c6U,0xaffb2c06U, // 61 0
+0x9797c259U,0x206bf0b5U, // 67 0
+0x86d02b03U,0x989a9036U, // 59 0
+0xc5c29ce0U,0xd044e5f1U, // 67 0
+0xed10ab73U,0xbe34e9ebU, // 61 0
+0xe2f7ea5fU,0x4e08530dU, // 63 0
+0x4383a08eU,0x8ebba414U, // 69 0
+0xe07e23e9U,0x23c75d00U, // 53 0
+0xfa6ac89eU,0x8d242faaU, // 57 0
+0x662f50beU,0x3f95ddf0U, // 67 0
+0x168dbb24U,0x99661585U, // 63 0
+0x8fcfceb8U,0x3913d542U, // 61 0
+0x29307a27U,0x998712c3U, // 63 0
+0x6bdf871bU,0xda7d9d74U, // 65 0
+0x6da32328U,0xa5bd17ffU, // 67 0
+0xab6f0616U,0x40d0c98bU, // 57 0
+0x3f0774a6U,0xcdefe56aU, // 61 0
+0xe615b0c3U,0xd92d911fU, // 63 0
+0xd49cc769U,0x4598d61fU, // 65 0
+0x7a9fdf21U,0x0cb9ca4eU, // 67 0
+0x29b79059U,0x2afe3e40U, // 65 0
+0x84f60a1dU,0x0834870aU, // 63 0
+0xf5b439ddU,0xd1903f93U, // 57 0
+0x6d415ea2U,0x751f4dafU, // 71 0
+0xad9288efU,0x3a0d9f37U, // 69 0
+0x91e4c68aU,0xb7a35a50U, // 71 0
+0x97122701U,0xa41073e0U, // 63 0
+0xe4c4f93cU,0x73ca1dcdU, // 77 0
+0x2a81904cU,0xbef35542U, // 63 0
+0xccf79f77U,0xf2388e07U, // 67 0
+0xaf18d44fU,0x33cf9896U, // 71 0
+0x3eadbd80U,0xdcff5a2fU, // 61 0
+0x74fe9515U,0xe8065a9eU, // 67 0
+0x625ab81dU,0x7137b854U, // 59 0
+0x0cc12a5eU,0x392587c8U, // 69 0
+0x5b79c90bU,0xa9518855U, // 61 0
+0x868f3faeU,0xa915c0b3U, // 63 0
+0xc5ce1400U,0x92e9a396U, // 57 0
+0xf7238052U,0x1b1b64a6U, // 65 0
+0xd4ec4a24U,0xb4451221U, // 63 0
+0x5224a84cU,0x48860ce6U, // 59 0
+0xbb577d7bU,0x1c6cdafeU, // 69 0
+0x46fe9a01U,0xf47734daU, // 67 0
+0x711b08f7U,0x66138a26U, // 67 0
+0x6dc9a746U,0xa2e340f6U, // 63 0
+0x57b1f303U,0x32b19f72U, // 71 0
+0x891924b7U,0x0af64219U, // 67 0
+0xa93fad11U,0x6be07dfcU, // 65 0
+0x5946e808U,0xabbebe65U, // 53 0
+0xa3a850eaU,0x052fa15cU, // 65 0
+0x4cdd0a21U,0x0b27bcf0U, // 65 0
+0xde86ad9cU,0x4a17a208U, // 61 0
+0xda24d40eU,0x9bbc29e3U, // 59 0
+0x0789b212U,0x22bc3d0dU, // 71 0
+0xf6357b4bU,0x8ce361f3U, // 69 0
+0x9b9fbdb1U,0x9d36bf09U, // 55 0
+0x1c8999f0U,0xa69aa50eU, // 55 0
+0x349c6027U,0x990dc9d7U, // 65 0
+0x7cf60dcdU,0xbb75cf82U, // 65 0
+0xd546fe54U,0xbc2acc46U, // 71 0
+0xeddeedfdU,0x649ef1e5U, // 71 0
+0xe3554371U,0xc74a25eeU, // 51 0
+0x91a1dabeU,0x8ff0ca74U, // 61 0
+0xe9eb3a48U,0x8e23ba64U, // 71 0
+0x6f2f39ecU,0xf89250daU, // 67 0
+0x4a7c3185U,0x8c61f144U, // 59 0
+0x194ba4f0U,0x7e04faccU, // 65 0
+0xa4240e32U,0xfd6ffd20U, // 67 0
+0x6fc896ceU,0x5d2398bfU, // 65 0
+0x73a6a17aU,0xcfe65d1fU, // 57 0
+0xac6daa60U,0x0ab91d4dU, // 69 0
+0x72fc2c4fU,0x715933bfU, // 65 0
+0x8ccc0b98U,0x7631cab8U, // 61 0
+0xbe2ec604U,0x80345aa9U, // 69 0
+0x89e40176U,0x92ca2ee3U, // 61 0
+0x4caa7ab8U,0x689305e3U, // 85 0
+0x086a9024U,0xb6fad392U, // 63 0
+0x57e8d17cU,0x9c53abd4U, // 63 0
+0xd4f7abbdU,0x1182b339U, // 61 0
+0x46ec59fcU,0x772c5412U, // 59 0
+0xb36c8184U,0xddb2fb5bU, // 63 0
+0x8fe39bc4U,0x54e8bd61U, // 61 0
+0x8df3bdb9U,0x4d2388e3U, // 65 0
+0x73779fadU,0x983eb3b7U, // 73 0
+0x1e89da1eU,0xa8606470U, // 61 0
+0x3ced8094U,0x6b753a48U, // 69 0
+0x8a0712bcU,0x1039a818U, // 67 0
+0x6856e733U,0xc2265011U, // 69 0
+0xc212f62dU,0x82d50391U, // 73 0
+0x0634afa9U,0x19be9eb4U, // 69 0
+0x7d4547d8U,0x2a46bf85U, // 69 0
+0xd6c96e82U,0xdd29984aU, // 65 0
+0x5638f323U,0xc49b7972U, // 63 0
+0xec730cebU,0xefd222c9U, // 65 0
+0xd4f37fefU,0xa8d2ac40U, // 61 0
+0x8b26159aU,0x2869009eU, // 57 0
+0x03eecc90U,0x0b7e736fU, // 63 0
+0x80aa035eU,0x83d180efU, // 65 0
+0x84fef03fU,0x9323cb76U, // 61 0
+0x39c4c2eaU,0x540113e0U, // 63 0
+0x024cb596U,0x78094c3aU, // 61 0
+0xd815c97fU,0x89001bc0U, // 67 0
+0x322a4572U,0x031b7230U, // 63 0
+0x2e0e46f8U,0x267d22f4U, // 69 0
+0x7cd7bf3fU,0x17b5f5ffU, // 71 0
+0xda0928b2U,0x083f349eU, // 65 0
+0xc1eb930cU,0xaf310b17U, // 61 0
+0x33cc9a20U,0xc42c771aU, // 59 0
+0xba54bf25U,0x3156a7b8U, // 65 0
+0x9a954c65U,0x6830adc6U, // 69 0
+0xd55056f1U,0xd56290cfU, // 79 0
+0xfffb6685U,0xc08d6952U, // 73 0
+0xcca4a7fcU,0xd5cbdd12U, // 65 0
+0xe460b744U,0x10ed661eU, // 63 0
+0x7e8bfdceU,0x9645ba38U, // 75 0
+0x73a23e16U,0xc8caa6b5U, // 63 0
+0x1c76c241U,0x0f54d1e9U, // 71 0
+0x08f918afU,0x725696dcU, // 73 0
+0x3764144aU,0x8441168cU, // 57 0
+0x7b5c2623U,0x9a6419f9U, // 63 0
+0x06ef5430U,0xc533f0d6U, // 67 0
+0x01b8ea57U,0x0b1c8514U, // 77 0
+0xdc7813e5U,0x8b70bcc9U, // 69 0
+0xfcc2cab8U,0x9ec17afaU, // 85 0
+0x39bb979fU,0xd670923fU, // 61 0
+0x87e6fd48U,0x83fc3ddcU, // 59 0
+0xa161bed8U,0x30e0d7d4U, // 65 0
+0x7033a559U,0x1ccb7951U, // 59 0
+0xc5f9e3e5U,0xeba4f864U, // 65 0
+0xece646e6U,0x1969e23cU, // 63 0
+0x22d11d2fU,0x6f2ef6e0U, // 69 0
+0x66206c1aU,0x04ecedefU, // 73 0
+0xb89763a7U,0xdf7b268aU, // 65 0
+0xd0fc11a9U,0xd9b40109U, // 71 0
+0x6d2f9afeU,0xbfcd5ff0U, // 61 0
+0x2065b8e8U,0xeb0125b6U, // 65 0
+0x347176bfU,0x2bd86833U, // 75 0
+0x144193baU,0x46921ae5U, // 71 0
+0x92e03d36U,0x1ecb0037U, // 57 0
+0x9d77d5efU,0xbd6563f5U, // 65 0
+0x359a4fddU,0x94eea2cbU, // 69 0
+0x330ee702U,0x91396e37U, // 61 0
+0xe6c671eaU,0xb6681574U, // 63 0
+0xa39ee7f5U,0xdc73533cU, // 67 0
+0x43da4057U,0x00b24ee5U, // 69 0
+0xdd9e63d1U,0xb0db51d2U, // 57 0
+0x92ea4452U,0x8fbb5baeU, // 61 0
+0x5134d67dU,0x8169c9b6U, // 61 0
+0xf0a8f9eaU,0x53cf4b8aU, // 61 0
+0xb721cc20U,0xb1edb4ddU, // 61 0
+0xe51b2313U,0x5851fe4aU, // 63 0
+0xa5e6543cU,0xfc16460bU, // 61 0
+0x0a8fe09cU,0xec6c8f8cU, // 67 0
+0x538c15e8U,0x4add3cb0U, // 65 0
+0x10b6c405U,0x930ca0e8U, // 55 0
+0x1fa53e7aU,0x50c47699U, // 59 0
+0xb7e4811eU,0x64874eecU, // 69 0
+0x57a6ab66U,0x598f163eU, // 61 0
+0xf82f727eU,0xbe4c1bf3U, // 59 0
+0xf67da00dU,0x450f15deU, // 69 0
+0x7fcc4488U,0x266bf819U, // 65 0
+0x6b6e7986U,0x26681103U, // 71 0
+0x63063d10U,0x263aa6f2U, // 61 0
+0xee7b8021U,0xb748488eU, // 69 0
+0xf3ac5a36U,0x2c5d60cdU, // 67 0
+0xc1020702U,0x13ae5410U, // 73 0
+0xf83d53a9U,0xd59d5692U, // 67 0
+0x44a5557eU,0xd532680aU, // 57 0
+0x1a8218faU,0xd15a2cabU, // 65 0
+0xdd5711efU,0xbb66e5a5U, // 65 0
+0x32317eb5U,0xda80ecd4U, // 57 0
+0xae5e2a61U,0xee96e695U, // 73 0
+0x09de30c5U,0x53e3d833U, // 73 0
+0xbd8161d0U,0xefc9b618U, // 61 0
+0xfd758989U,0x42825cc4U, // 67 0
+0x7cf07c47U,0x5595957cU, // 67 0
+0x0d9e156bU,0xd127e92dU, // 65 0
+0xfb568e53U,0xb129728cU, // 59 0
+0xba7133f1U,0x37c421d8U, // 63 0
+0x57acc460U,0x4b92caaeU, // 63 0
+0xbd273782U,0xec27d714U, // 65 0
+0xba212014U,0xa768e74cU, // 63 0
+0x84103043U,0xdec9446aU, // 57 0
+0xd1382d15U,0xc5425415U, // 73 0
+0x5485629eU,0x416329f5U, // 65 0
+0xd3044cacU,0x19d01e6aU, // 73 0
+0xeecfc17cU,0x1b2e65b3U, // 65 0
+)EOK"
+R"EOK(
+0x7781bcceU,0x66274293U, // 61 0
+0xb3a446aeU,0x38b9e74dU, // 57 0
+0x997307ffU,0x8e01527dU, // 73 0
+0xcb108d79U,0x4aa09cffU, // 77 0
+0x7d1f73d3U,0x85a5039dU, // 67 0
+0xe18da358U,0x0b23eb7dU, // 69 0
+0x0a6e5bc2U,0x6d2f78b5U, // 59 0
+0x2ef1fa09U,0x04621e86U, // 73 0
+0xcfc83378U,0x04547e09U, // 65 0
+0x341f474dU,0x790e3c46U, // 67 0
+0x66d877fbU,0x2eef213dU, // 67 0
+0x6346d490U,0xabb4d419U, // 67 0
+0x3dd3b993U,0x887ca1feU, // 71 0
+0x72bdd871U,0x0e39ec8aU, // 69 0
+0x5ffb3b11U,0x5e690ce1U, // 57 0
+0x69489326U,0x03eb6395U, // 57 0
+0xcebf3277U,0x3b4828b9U, // 65 0
+0x60a4c918U,0x0f703094U, // 59 0
+0x3441d226U,0x3467acd3U, // 55 0
+0x650b638aU,0x5e6b75f3U, // 61 0
+0xd5c3e1c6U,0xba66c611U, // 69 0
+0x775c9979U,0x1b412f17U, // 69 0
+0x78a71fb4U,0xb851a38cU, // 63 0
+0x3bdd153fU,0x55fc3f86U, // 73 0
+0x7ea46596U,0xa18c5ff9U, // 67 0
+0x9983fe14U,0xb8143cc5U, // 63 0
+0x04a7328eU,0x80ef53c9U, // 59 0
+0xe5f1e473U,0x60ea4d5bU, // 67 0
+0xf1a1a5ceU,0xcfc64950U, // 55 0
+0x2f12ebd5U,0xb91c1ce3U, // 71 0
+0x9d41ccd2U,0xdfa2eaeaU, // 67 0
+0x6658762dU,0xa8ec01feU, // 63 0
+0x10a073eeU,0x31ce103cU, // 73 0
+0x4a2b406eU,0x0c230726U, // 69 0
+0xb25c089bU,0x4252170eU, // 67 0
+0xd2ecf3caU,0xdb7eeb31U, // 63 0
+0xd6fd02e7U,0x2183dfb5U, // 67 0
+0xe77bfe43U,0x20af01caU, // 71 0
+0xb73579e9U,0xf6ab19c6U, // 63 0
+0xadc7edecU,0x976f478eU, // 75 0
+0xf9346129U,0xfa1b0b36U, // 61 0
+0x24c38aa8U,0x86bca582U, // 57 0
+0xd7a76b0cU,0x51ab0da8U, // 71 0
+0x8f6b32beU,0xf3f66c44U, // 65 0
+0xf5ca2ed8U,0x7e583c44U, // 61 0
+0xfd9d8a43U,0x039fd89fU, // 69 0
+0x3a5d670fU,0x511f7086U, // 59 0
+0x68ea039cU,0x6801db76U, // 67 0
+0xe2cd3396U,0xe2655222U, // 75 0
+0xb223e0c2U,0x5fa83d62U, // 65 0
+0xe68bfed0U,0x3db2c282U, // 61 0
+0x24acc524U,0x1daead35U, // 73 0
+0x16fee2cfU,0xc2bb03e0U, // 65 0
+0x7b1a57adU,0xbad588aaU, // 77 0
+0x4c69d8a8U,0xa09dd8daU, // 65 0
+0xd39a196dU,0xdeeb3fdbU, // 69 0
+0x72eacd8aU,0xeb85e017U, // 61 0
+0xbc4e435cU,0x78d5a14bU, // 65 0
+0x8e6c4f1eU,0x9af018e2U, // 63 0
+0x74960371U,0x9f62f5e3U, // 63 0
+0xbae781feU,0xa6aa1993U, // 59 0
+0x1f243912U,0x83de9d88U, // 65 0
+0x2586a43eU,0x896c4300U, // 67 0
+0xc74a3bdaU,0x1ad2ee11U, // 55 0
+0x9f03b8f8U,0x053a323aU, // 65 0
+0x24b8e491U,0xde0086caU, // 59 0
+0x4bd6bd9bU,0xc99918e0U, // 53 0
+0x0d3f4895U,0x4cbfe8afU, // 65 0
+0xd1cbb104U,0x7a3b913eU, // 65 0
+0xd99507afU,0xe27054c9U, // 71 0
+0xe9ca5cecU,0xc83b1f13U, // 77 0
+0x994e2c46U,0x763aa79eU, // 69 0
+0x51531fc7U,0xae04274aU, // 59 0
+0xa4e7e148U,0x7e9cb348U, // 57 0
+0x741ceb3bU,0x2adb2f46U, // 61 0
+0x513dc1a1U,0x04580222U, // 71 0
+0x925dd939U,0xac280dccU, // 73 0
+0xb2d73db9U,0x8641c3f3U, // 67 0
+0x802fb25cU,0x592278b7U, // 73 0
+0x6cd741a5U,0xbbfc47d5U, // 65 0
+0xc2c4c708U,0x09bb36d3U, // 55 0
+0xbe1b4133U,0x18b782d2U, // 61 0
+0xa071037bU,0x41108c13U, // 69 0
+0xce637e94U,0x3f96b39dU, // 59 0
+0xbc3df17fU,0x5fc93a6bU, // 65 0
+0xab76bebfU,0xd8aa2229U, // 71 0
+0xe2fc50c9U,0xd6f281edU, // 69 0
+0x96190d69U,0x68a4354dU, // 71 0
+0xcca38300U,0x6e1d227eU, // 73 0
+0x5cf015a7U,0x0aca8337U, // 73 0
+0x813c3ac7U,0xcbb7150dU, // 53 0
+0x90d410efU,0x1462f338U, // 67 0
+0xfa35a565U,0xd30a93e7U, // 67 0
+0x915b3271U,0x5777819aU, // 77 0
+0x2063a506U,0x7318c246U, // 71 0
+0x8b85177cU,0x764b97ceU, // 61 0
+0xf43728edU,0x0d40f95cU, // 67 0
+0xe9d86e6bU,0x04c4d474U, // 61 0
+0xbb0b74deU,0x05b2d179U, // 63 0
+0xb1e8badeU,0x3e4bc43eU, // 67 0
+0x453aa261U,0x8ac57456U, // 63 0
+0xfbc87280U,0x483841d5U, // 69 0
+0xd06369a8U,0x05411c05U, // 63 0
+0x1af067b3U,0xb7cda462U, // 59 0
+0xdbd5d9cdU,0xe5671a9cU, // 65 0
+0xf3f9f71bU,0xe01d96f6U, // 65 0
+0x945e0787U,0x989c4771U, // 65 0
+0x3e710003U,0x660433c5U, // 67 0
+0xed0f325eU,0xe18ce78fU, // 75 0
+0x27120d4dU,0x40464fe3U, // 59 0
+0xcb48a5aeU,0x2f3baed9U, // 69 0
+0x22bc9229U,0x02f107c5U, // 73 0
+0xd4f6f899U,0x73e2d681U, // 71 0
+0x6f1b248bU,0x89b77ddeU, // 67 0
+0x897a45e7U,0x88dbf4aeU, // 65 0
+0x2858d96dU,0xd688b6dfU, // 67 0
+0xf50deffcU,0x677ea253U, // 69 0
+0x69eaad3cU,0x152e6f40U, // 57 0
+0x7ee0a9ecU,0x48f4b96fU, // 73 0
+0xa0d937a9U,0x3aa7da60U, // 67 0
+0xaf7dac17U,0x84d2506dU, // 69 0
+0x0fc0bdb4U,0x95010ccbU, // 57 0
+0xaab416a5U,0xdbd0bae4U, // 63 0
+0xa21de37dU,0x67fe0c85U, // 67 0
+0xcb673610U,0x3366d5a2U, // 63 0
+0xc39b6c9dU,0xcf426cacU, // 61 0
+0xf29675c7U,0x5b81060bU, // 63 0
+0xccb69989U,0xdcb33ddcU, // 65 0
+0x47c220d8U,0xa5887825U, // 61 0
+0x677bfb13U,0x887535c8U, // 65 0
+0x13832c6eU,0x6142be8aU, // 69 0
+0xa8f33c21U,0xf84df001U, // 57 0
+0x3a157f9dU,0x20062da8U, // 63 0
+0x3c0441e2U,0xf306ebe2U, // 67 0
+0x1df74953U,0xfad8401fU, // 65 0
+0x2c1b48a1U,0x79c492bbU, // 75 0
+0x92da0bd7U,0x5c13cc86U, // 63 0
+0x00658034U,0x6a7d6e03U, // 59 0
+0xab854412U,0xe57f19ebU, // 63 0
+0x25045d10U,0x37ec0431U, // 69 0
+0x55831a08U,0x84105979U, // 59 0
+0x680c216aU,0xe0e26ddfU, // 61 0
+0x9967c5f4U,0xcc57a7c6U, // 67 0
+0x322be9deU,0x6983819fU, // 71 0
+0xa9d5c2e7U,0xf653426eU, // 63 0
+0x3e97a45bU,0x4e967eadU, // 67 0
+0xf13bcba9U,0x8e7d4ecdU, // 61 0
+0xe9da9e49U,0x4c080e36U, // 67 0
+0x6d07351aU,0xe2554027U, // 69 0
+0x9698ac71U,0x0d89d0a5U, // 69 0
+0xec379acbU,0x990c26bbU, // 55 0
+0x0ee781deU,0x5e24e108U, // 63 0
+0x7c5b43edU,0xed84d86bU, // 77 0
+0x2ae8dabaU,0xa754ab70U, // 75 0
+0x37d34a29U,0x57b262d3U, // 71 0
+0x4a382a99U,0x88f10504U, // 63 0
+0x4574cbafU,0x93f6c4b6U, // 65 0
+0x3d3a451bU,0x814454f7U, // 73 0
+0x6212a5adU,0xbae46605U, // 73 0
+0x9630ed6dU,0xa2a580ffU, // 63 0
+0x1e1cf8d5U,0x463e5adeU, // 59 0
+0x784558a6U,0x0fd42e22U, // 59 0
+0x0de4be12U,0x85bf9f9bU, // 63 0
+0xcb97a72dU,0x47e73c36U, // 67 0
+0xeaa2bcd2U,0x2896eb7aU, // 63 0
+0xc6904253U,0xe7ff78eaU, // 79 0
+0xbbfebc1bU,0xab634109U, // 63 0
+0x442be692U,0xf93400abU, // 63 0
+0x020705b2U,0xda188009U, // 55 0
+0xbe83c9a4U,0x5c4d7a15U, // 57 0
+0xb3fada83U,0x91a27c6eU, // 75 0
+0x86c73034U,0x2a05ebaaU, // 67 0
+0xcde4a742U,0xc3053411U, // 63 0
+0xb1edfc6cU,0x0ff914bfU, // 71 0
+0xdb139b17U,0xca13b4c9U, // 75 0
+0xdd24f52aU,0xdde36c1bU, // 67 0
+0xe4a3cd9cU,0xf22c12d3U, // 69 0
+0x304c4360U,0x3bd53da5U, // 67 0
+0xb4c01836U,0x0a42f333U, // 67 0
+0x3f87303cU,0xab0efa25U, // 67 0
+0xfa341243U,0xd0dd815cU, // 69 0
+0x165d3117U,0x8cf22c19U, // 63 0
+0xacf983cfU,0x292edc6dU, // 59 0
+0xb913ed31U,0x6a5b7b3cU, // 73 0
+0x0f2d0e1eU,0xc954bb35U, // 71 0
+0x7ab8cdf3U,0x8583d0a0U, // 65 0
+0x597324b9U,0x8a400c17U, // 69 0
+0x42534a8bU,0xe673a70dU, // 65 0
+0x49acd7beU,0x6798f01eU, // 73 0
+0x2e500cd3U,0xe9cc8476U, // 75 0
+0x2034243bU,0xaaaabafeU, // 71 0
+0x879ab5b9U,0x5a9c95acU, // 75 0
+0xe1e0ca40U,0x3087c7d4U, // 67 0
+0x478bba50U,0x86b33a6aU, // 59 0
+0xdf3e1573U,0xd2172996U, // 65 0
+0xd8037538U,0x5bf9c1faU, // 65 0
+0x4d166051U,0x15013c9fU, // 65 0
+0x4ab04e17U,0x40082fd4U, // 69 0
+0xe5630eb6U,0x10e275d0U, // 65 0
+0x5d8e0bf0U,0xe6b0db2aU, // 65 0
+0xaade34efU,0xd5978e85U, // 65 0
+0x93fcc35dU,0xc4158511U, // 65 0
+0x12400ab8U,0x2c626af6U, // 65 0
+0xa63ada73U,0x3bed91bfU, // 67 0
+0xfe174a8bU,0x649566faU, // 61 0
+0x54b38029U,0x74e3a2f2U, // 67 0
+0x10346007U,0xcc7d9ea5U, // 67 0
+0x4928b324U,0x74ae38ccU, // 67 0
+0x685356a9U,0xeb43acacU, // 73 0
+0xfeb6b70fU,0x775333e0U, // 71 0
+0x9fb4bf19U,0x5c3802f5U, // 75 0
+0x1bcbf9b6U,0xcb8f6d04U, // 67 0
+0xfd3cfae1U,0xf2fa8d2bU, // 61 0
+0x8a7ebf95U,0x51bef406U, // 53 0
+0xbe4d1624U,0x828d30c2U, // 63 0
+0x93b3856bU,0x9142134eU, // 65 0
+0xf4ef2a5cU,0xbfe854e3U, // 61 0
+0x9cc16df4U,0x2b7a0643U, // 65 0
+0x1031b4adU,0x543ff337U, // 59 0
+0xa62d1fe6U,0x7d6f7d47U, // 63 0
+0xe07e14e5U,0xb2c010ebU, // 65 0
+0xcea268e2U,0x6328a81eU, // 65 0
+0x613db393U,0xddcd47cfU, // 65 0
+0xfe0fe450U,0x67b1528cU, // 65 0
+0xc8dcaf5dU,0x0f43189aU, // 73 0
+0x8e39811fU,0x128c7e22U, // 65 0
+0x6d1b6c3dU,0x822c2980U, // 61 0
+0x1038270bU,0x6a419342U, // 59 0
+0x28b0e189U,0x9ffb03d5U, // 59 0
+0x0e307b41U,0x5965b044U, // 71 0
+0x71480638U,0x0f9e14aaU, // 69 0
+0xdc6b11f6U,0x9ae33c09U, // 67 0
+0xee184123U,0xb35f88c7U, // 71 0
+0x3960d31cU,0xe8749af2U, // 65 0
+0xad4ec206U,0x9d0436ddU, // 73 0
+0x11fa5551U,0xe27fa575U, // 73 0
+0x1c7e6b65U,0xb1040af1U, // 57 0
+0x5da89ac4U,0x52ca4bdeU, // 75 0
+0x2208941aU,0xa20d8efeU, // 69 0
+0x906830beU,0xe3356ec0U, // 59 0
+0x713c74b9U,0xccf2c8aaU, // 65 0
+0x88e2c1ecU,0x531eda7bU, // 59 0
+0xc8ecc728U,0x7baab125U, // 67 0
+0x057d4663U,0xcabd3bafU, // 61 0
+0x4b4d4de0U,0x95a9b3dcU, // 59 0
+0xa2ea3468U,0xbfed23d6U, // 57 0
+0xbe94cefdU,0xc3f117d7U, // 69 0
+0xc2f1957bU,0x84d823a0U, // 65 0
+0x6bc1fcb0U,0x385f8077U, // 65 0
+0x3ecca08eU,0x77ffe8efU, // 73 0
+0xeb96020fU,0x979c69eeU, // 65 0
+0x3aa78c86U,0xcafb0ff4U, // 57 0
+0x9cca08bcU,0xeedca7d7U, // 61 0
+0xf3bbb729U,0xbf9acda0U, // 65 0
+0x932f3c5eU,0xf79bf6b8U, // 55 0
+0xb41f870bU,0xd2de9f76U, // 71 0
+)EOK"
+R"EOK(
+0xd70af6a2U,0x313edcd0U, // 59 0
+0x6869da84U,0xb81ec9d5U, // 67 0
+0x6dc10710U,0x6f06b8f5U, // 63 0
+0xb331be23U,0xaed0358aU, // 61 0
+0x0270be7fU,0x7b16518dU, // 63 0
+0xaa64b736U,0x0037749bU, // 67 0
+0x5043fab6U,0x5750a28eU, // 69 0
+0x238f8152U,0xb8aa85b3U, // 79 0
+0x62849b22U,0x58ab149dU, // 63 0
+0x4c726a7dU,0x6a55c4fcU, // 67 0
+0x73b7dfe7U,0x55f65ea7U, // 71 0
+0x22a2fdf0U,0xa2a4a0f7U, // 65 0
+0x72d20161U,0x02fe929aU, // 67 0
+0xbe973d65U,0xe5582fb2U, // 69 0
+0x9d47c28aU,0xb157bc2cU, // 73 0
+0x21059054U,0x77ee6739U, // 69 0
+0x58648648U,0xad82734dU, // 71 0
+0x3137e31bU,0xb3078437U, // 61 0
+0xc9bb536fU,0x0010b6baU, // 67 0
+0xc87838d5U,0xbc98a20aU, // 69 0
+0x3fa8c774U,0xa2831a2fU, // 59 0
+0x30ba33efU,0x960a6922U, // 69 0
+0x0d165dd7U,0x83657b56U, // 59 0
+0x1af192b9U,0xedcb01dbU, // 69 0
+0x1eba5d55U,0xd817d4e0U, // 65 0
+0xe4ee4356U,0x419b220dU, // 65 0
+0xacdace35U,0xb65e1aaeU, // 55 0
+0x247ab289U,0x93c4c60aU, // 67 0
+0x8dd4e5f1U,0xb8b7c257U, // 69 0
+0xc11dbd8bU,0xe608968dU, // 65 0
+0x1c71c9a9U,0x6bdc3971U, // 57 0
+0x2d8dde3aU,0xe63b9678U, // 67 0
+0x5799d261U,0x1a1fd26fU, // 59 0
+0x523a3a0bU,0x6a9c987cU, // 65 0
+0x01d0f4abU,0x96d769b3U, // 65 0
+0xc50cb896U,0xb0669c0aU, // 79 0
+0x5f6c6426U,0x3d8163ebU, // 63 0
+0x6c2bb69eU,0xe1a46c53U, // 65 0
+0xf7817f6aU,0x96897825U, // 55 0
+0xd98db58aU,0x1cd97b79U, // 65 0
+0xf16c45a8U,0x35707daeU, // 75 0
+0x5568b0bcU,0x5b0b774bU, // 75 0
+0x08f6f9abU,0xf22168caU, // 63 0
+0xa7380a4dU,0x50191e35U, // 73 0
+0x27c41436U,0x29823b97U, // 63 0
+0xfb5e5e97U,0x4f31957eU, // 65 0
+0xf073a365U,0x9ea1de92U, // 69 0
+0x7d1a098fU,0x8b20867fU, // 59 0
+0x5ff390d7U,0xc3fcb474U, // 55 0
+0x4676429fU,0x8b88f713U, // 75 0
+0x2bed5de8U,0x4b646007U, // 61 0
+0x98022df0U,0x36a626a5U, // 57 0
+0x0e7ce70bU,0xada55bc7U, // 61 0
+0xf0a48294U,0xc4b5a8c8U, // 67 0
+0x3cf194bfU,0x51e333b0U, // 59 0
+0x11e4cb66U,0xf61ed7a9U, // 61 0
+0xdd54aaddU,0x0ec6387bU, // 61 0
+0xfa70768fU,0x5acbb714U, // 59 0
+0xdc9a279bU,0xd55585b5U, // 71 0
+0x57e3fc6cU,0x456065deU, // 61 0
+0xd11ab1adU,0x91d4b610U, // 67 0
+0x9cf0ed2dU,0xa548b14bU, // 75 0
+0xe20ea1faU,0xd7b171bdU, // 61 0
+0x0bbdfea3U,0x46e18d3dU, // 59 0
+0xb54fbe8aU,0x158a8fbdU, // 61 0
+0x0436cc35U,0xf3f66f14U, // 69 0
+0xbc322f9fU,0xbff38e73U, // 79 0
+0x990be8aeU,0x5d5c9399U, // 71 0
+0x427b6617U,0xf1c08d36U, // 61 0
+0xe728efa4U,0xcf4e5b5cU, // 55 0
+0x11ea4fbeU,0xa46f2c37U, // 65 0
+0x1f352539U,0xcb665645U, // 75 0
+0xb16f254cU,0x358662dbU, // 61 0
+0x7348edecU,0x08757355U, // 73 0
+0x681b8aa7U,0xd15d61dcU, // 59 0
+0xad1969f1U,0x5a2acc24U, // 65 0
+0xf97fffc7U,0x05c77344U, // 65 0
+0x642e22beU,0x9df9ca7dU, // 59 0
+0x10750c1bU,0xe0acb7c0U, // 71 0
+0x8f01b14cU,0x84eec706U, // 67 0
+0x30e1ca50U,0x9f87772aU, // 67 0
+0xa5bad207U,0x28621e55U, // 73 0
+0x953fb391U,0x1a43229fU, // 67 0
+0x2f2c0ab2U,0xef15807bU, // 59 0
+0x3fd381f3U,0xe4c0eeaeU, // 75 0
+0x9d582439U,0x2d5ae2e3U, // 69 0
+0x063b8d21U,0x929703b7U, // 65 0
+0xc12f419aU,0x93f4ee7cU, // 73 0
+0x7e841e2cU,0x711b4edcU, // 67 0
+0xfe0fb468U,0x1f008b3eU, // 65 0
+0xec5f0c99U,0x4de03852U, // 61 0
+0xd947c500U,0x93d3b0e3U, // 63 0
+0xbbd205c5U,0x10690d4cU, // 69 0
+0xe7e6e91aU,0x05c39545U, // 63 0
+0x354626a2U,0x7c54a6eeU, // 57 0
+0x970aac18U,0x13462c8aU, // 67 0
+0xf0a03662U,0x8a7b9d97U, // 57 0
+0xb6269960U,0x988c0b52U, // 57 0
+0x3f4a9422U,0x1c24cc1cU, // 65 0
+0x3ed0c6f1U,0x1daf4853U, // 71 0
+0xc3dfe98bU,0xfd75154dU, // 65 0
+0x0d38b7d7U,0x6ea61d68U, // 73 0
+0xfb73e457U,0xd31d36b1U, // 67 0
+0x744efe98U,0x7ce4a11dU, // 57 0
+0x3c0f66b6U,0x481f5988U, // 65 0
+0xb890aa55U,0x8bfc21e8U, // 47 0
+0x2e52b3c9U,0x6e8abc11U, // 67 0
+0xd92d2630U,0x1ca49aedU, // 71 0
+0x4b622cd2U,0xe981cb10U, // 53 0
+0xfe3ba39dU,0xc22be55dU, // 67 0
+0xd8d16061U,0x5c355265U, // 77 0
+0xce96496bU,0x4b01767bU, // 63 0
+0xc9483e8eU,0xe74fba97U, // 63 0
+0x0922a2e4U,0xe78505b9U, // 65 0
+0xf49dcfe3U,0x4971e642U, // 59 0
+0x91d6fc5dU,0x5c55ee0fU, // 73 0
+0xd4073d52U,0x113b5d5bU, // 69 0
+0x69001a82U,0x5d3c578fU, // 57 0
+0x15f6a941U,0xb70faedbU, // 65 0
+0x7c939eadU,0x3b920798U, // 71 0
+0x829166b1U,0x2278d58bU, // 63 0
+0xe10dd570U,0x402853adU, // 65 0
+0x40eea6eaU,0xa80db16eU, // 71 0
+0x76795f0fU,0xc0b7917cU, // 65 0
+0x4cf92055U,0x70ba051fU, // 71 0
+0x14a81d98U,0xed8449b8U, // 59 0
+0x463df319U,0x9135664fU, // 65 0
+0x1aec80f8U,0x826f53f6U, // 73 0
+0x5788d5f8U,0x0487ec0eU, // 67 0
+0xa90cc474U,0xe6dae595U, // 61 0
+0x381deb29U,0xc804d0ddU, // 67 0
+0x4f521a31U,0xc526d656U, // 77 0
+0xc70c4e66U,0x079333acU, // 67 0
+0xb4a225eaU,0x45998b8cU, // 71 0
+0xf440134cU,0x593be7c6U, // 71 0
+0x3f2fe72eU,0xf8ea7fa9U, // 61 0
+0xfefdcd53U,0x57943155U, // 73 0
+0xad28629cU,0x5f101ff0U, // 69 0
+0x9cc945b2U,0xc63c632eU, // 65 0
+0x2450dda5U,0x1e0e98e1U, // 61 0
+0x7e65dd0aU,0xe61d507bU, // 65 0
+0x86a870b4U,0xb6531703U, // 63 0
+0x705a9cdbU,0x857bc526U, // 59 0
+0x7a86db76U,0xff3561f1U, // 73 0
+0x9e0604b4U,0x945a3060U, // 61 0
+0x009ed339U,0x4b313d72U, // 57 0
+0x29a040eaU,0xbee78e0aU, // 61 0
+0x406e41bcU,0x5184d52aU, // 59 0
+0xf0f72b17U,0xeb2194daU, // 63 0
+0x7fbb00e5U,0xb3570d42U, // 59 0
+0xcc13afc7U,0xed2cdaaeU, // 65 0
+0x1bf3d7cbU,0x4c958b52U, // 59 0
+0xd2b8bcc3U,0x41e4e1a8U, // 67 0
+0xee4feb7cU,0xf786d189U, // 73 0
+0x7afe5b45U,0x265c345cU, // 65 0
+0xc6ab1b80U,0x970597c8U, // 63 0
+0xfc07409eU,0xec1d03c5U, // 63 0
+0x859182fbU,0xd8010a1cU, // 65 0
+0x1dcbed1eU,0xab4a06f3U, // 61 0
+0xe4040f6aU,0x81a98ef3U, // 65 0
+0xec7a51c7U,0x3ce3b8e0U, // 69 0
+0xa608937aU,0x81286e78U, // 65 0
+0xcc132373U,0xc63be55eU, // 63 0
+0xa5129c57U,0xf7052076U, // 69 0
+0x4a5b1df7U,0x4e8ea642U, // 69 0
+0xd5132fbdU,0x1726cd52U, // 69 0
+0xcecab354U,0x1e4cd9d3U, // 61 0
+0xe0c5140cU,0xf99d2f10U, // 67 0
+0x5515c90fU,0x1080bf54U, // 71 0
+0xaa8abc16U,0x2e17f60aU, // 67 0
+0x8c6a9a0cU,0xddc03451U, // 61 0
+0xc0aec1baU,0x6241b123U, // 63 0
+0xd16103f0U,0x552c1ff0U, // 71 0
+0x91d1c601U,0x4ce6a2ecU, // 67 0
+0x108da2aeU,0x14603a6fU, // 71 0
+0xc8e07da4U,0xd67dbfa3U, // 71 0
+0xe7e245beU,0xcfba8168U, // 65 0
+0x7189ef4eU,0xac7c4c35U, // 73 0
+0x0306f35cU,0xaa223215U, // 69 0
+0xacc72c3cU,0xd94a897dU, // 67 0
+0x678f4466U,0x13e7a463U, // 63 0
+0x7feb3fb4U,0x44d2129aU, // 63 0
+0x7fd2b941U,0xf87123a8U, // 71 0
+0x32d21b0fU,0x3c6ee37aU, // 63 0
+0x242034fcU,0xd0043b8dU, // 73 0
+0x89ac688aU,0xc9871fcdU, // 71 0
+0x7b5c59f9U,0xd6f608dfU, // 71 0
+0x323de531U,0xe2ab30ffU, // 61 0
+0x35e096a0U,0x94e37ce1U, // 69 0
+0x0d8ffe96U,0xa372eba7U, // 77 0
+0x00ca9600U,0x4967a323U, // 61 0
+0xbb6868e8U,0x46627c5dU, // 67 0
+0xf65252c7U,0xfbb259a5U, // 65 0
+0xb965d312U,0x1b8b5333U, // 61 0
+0x99f87259U,0xcc2fa14eU, // 61 0
+0xc6ae2a9aU,0x38ef0f5bU, // 63 0
+0xc8503c47U,0xfbcd9e1aU, // 71 0
+0x6ca6e5f4U,0xa41f3ca1U, // 69 0
+0x85148b4fU,0x948c686aU, // 57 0
+0x4ee1ed6cU,0x33ce84ccU, // 65 0
+0xaf0321e8U,0x736b99cdU, // 65 0
+0x88e0cc1cU,0x863b6a42U, // 59 0
+0xc0392b37U,0xf4394ff1U, // 75 0
+0x8127dbe2U,0x47c050edU, // 57 0
+0x7d03a3c8U,0x66b43bfbU, // 63 0
+0xb54fc522U,0x3e051bc5U, // 61 0
+0x4d2d561eU,0xf04220c7U, // 65 0
+0xa978b813U,0x84b931cfU, // 71 0
+0x8ac10faaU,0x0d36a05dU, // 61 0
+0x81b79d5dU,0x9baf3414U, // 61 0
+0x6d0c5e18U,0x7f192a8bU, // 59 0
+0xab00d60eU,0x74356fe8U, // 65 0
+0xc752ca63U,0x68eaa7b4U, // 55 0
+0x62ebfdc4U,0x1b233207U, // 67 0
+0x32ea6f98U,0x496ab53eU, // 77 0
+0x8f87144eU,0x9f3df3a9U, // 61 0
+0x5c05a810U,0x8e096a50U, // 69 0
+0xa1a57496U,0x129a1bccU, // 67 0
+0x5a46c65aU,0x0dc9e8aeU, // 69 0
+0xa0165199U,0x783a5c76U, // 63 0
+0xcde84874U,0x389d2bbdU, // 67 0
+0xf13f6c23U,0xfbe56802U, // 69 0
+0x706f29f2U,0xeadc4285U, // 69 0
+0x06844bbaU,0x6a07bf10U, // 63 0
+0xb3436a36U,0xc5270e03U, // 79 0
+0xd79cf1f1U,0x093dc80eU, // 61 0
+0xee04fcaaU,0xbd808634U, // 63 0
+0x71a29b32U,0x51fc1b89U, // 63 0
+0xe866a8f4U,0x51d46606U, // 69 0
+0xa39e19d3U,0x8038e07bU, // 75 0
+0x192e2a08U,0x5a756a3dU, // 67 0
+0xea2c2c76U,0xa9be7057U, // 61 0
+0xa04c36f0U,0x6d0e9012U, // 71 0
+0x1497fe7bU,0xd3a91e84U, // 73 0
+0x9e0bff3eU,0xb08df15dU, // 59 0
+0x93e919caU,0xe1f15989U, // 69 0
+0x592bb7daU,0x2ee30738U, // 63 0
+0x6f6b8f88U,0x5fe48801U, // 53 0
+0x4a5c7491U,0x3f7dc039U, // 75 0
+0xec1b09adU,0xbd36213bU, // 73 0
+0x476d3cbeU,0xf1fd8c93U, // 61 0
+0xfe2df0b0U,0x6e7d199bU, // 75 0
+0x1d48b1a0U,0xd4ef47d5U, // 71 0
+0xc18104aeU,0x0f15c621U, // 61 0
+0x685a439bU,0x9b9517b7U, // 69 0
+0xd6b67fb3U,0x3d0613caU, // 65 0
+0x0a7e25c5U,0x3b2f122dU, // 67 0
+0x784ae610U,0xc07869dcU, // 59 0
+0x00a45e52U,0x3b611718U, // 63 0
+0x9cd53c9fU,0xa86a66b4U, // 65 0
+0xd9e851f2U,0x16d59009U, // 69 0
+0x6d68e508U,0x61b90341U, // 71 0
+0x706f36b4U,0x4db98ef1U, // 71 0
+0xd1f81219U,0x6237c26bU, // 61 0
+0xbc63f418U,0x24cf6f49U, // 71 0
+0x9fb8d26fU,0x2de168e5U, // 69 0
+};
+)EOK"
+R"EOK(
+__constant ulong tinymt64_tmats[TINYMT64_NUM_PARAMS] = {
+0xc61e76dc733bf7a6UL,
+0x9f0a013eda466b96UL,
+0x5c479bcf06570252UL,
+0x12931760222a2ab6UL,
+0x66a422a6b59f1c56UL,
+0x0b4868059c343604UL,
+0x3d0ee51e0510d00cUL,
+0x48818175a9f10c10UL,
+0xc70916931d0f8266UL,
+0x627509e24f2688aaUL,
+0x5001dde18cc49222UL,
+0x98119eae58c5ad9cUL,
+0xd1c9f3d24ee62d64UL,
+0x842c5c7a8d70dcbeUL,
+0x6f76e5dd0e0f6ea6UL,
+0x6b20d71336ce2f84UL,
+0xa9009474ebf54472UL,
+0x77a2ca41597c3376UL,
+0xb781392bf0bfc4b4UL,
+0xb027756f18ed8dacUL,
+0x78b93a916583f234UL,
+0xf14850b22b56b45eUL,
+0x304096ca48b36764UL,
+0x34de9374ad1c249aUL,
+0x97cd98a0f1030b30UL,
+0xceb765ee20d18668UL,
+0xefb99d83f89e0b0eUL,
+0x22396289b7f3e55cUL,
+0xd21dca7d8cd102e6UL,
+0xce3ed18939cff55eUL,
+0x9acd63d0db9f608eUL,
+0xda511af03087b4b6UL,
+0x3176b816106aa1a4UL,
+0xd07300a5cc0c1f36UL,
+0xb41496f7da8b7eecUL,
+0x2bb342b288222e58UL,
+0xcc99f431756f7dfcUL,
+0x985903312765e89cUL,
+0xc8186c525ae7c922UL,
+0xcd9d03ed1d30a534UL,
+0xb4d2e4a76a3655b8UL,
+0xd01d592946e84c0cUL,
+0xd7846e170fd1b286UL,
+0xb20aa4c6c5792460UL,
+0x57278ed0d8e3328cUL,
+0x22adfac13a177eccUL,
+0x43086729e07ea1deUL,
+0x7a06ef67d1d616c2UL,
+0xbd931625bb1d0570UL,
+0x26018df7320886c4UL,
+0xdfad58fd604a7bb8UL,
+0x8009f559bcd5569cUL,
+0xaae74854348c95f4UL,
+0xae9d751bcd49fe94UL,
+0x74a69246929f5d76UL,
+0x2a58e0c52f4d498eUL,
+0xd3f07404e47ec01aUL,
+0x135115a3f76d235eUL,
+0x85de454a1e12404aUL,
+0x61cc7f7bc3a28ef8UL,
+0x13a13d34e1ab9592UL,
+0x043d9cd52e7b6ce4UL,
+0x05e1717232cb650eUL,
+0xe05304a5b7b41666UL,
+0x9fdd369691b9b70eUL,
+0x0dcc1faf90960004UL,
+0xfa01d97ecef39d82UL,
+0x9967c0f7aa621626UL,
+0x7ac26c744ae81976UL,
+0xb6e95af5fe96b6bcUL,
+0x5a292b3a75a9a298UL,
+0xf9587ee1491977caUL,
+0xf8757b26d95853a0UL,
+0x4e9d37b97f3ce0e4UL,
+0x618badf7355b40e2UL,
+0xa943c4f419b5f4a0UL,
+0xee12e2019293a44eUL,
+0x99cfe122d10abe84UL,
+0xb8d5914f5a4e0c44UL,
+0x35b895fc40e25028UL,
+0xc482c00dc72a2c0cUL,
+0xb52ffc64ad2b356cUL,
+0xbd339127c440179aUL,
+0x1b5edec912d0b212UL,
+0x0399214c1b31ebe6UL,
+0x08cdfc43a83491c2UL,
+0xcbcc845525b2bb12UL,
+0xdebe2c5565e86406UL,
+0x6bcf252ef0ff5a4cUL,
+0x144b013efaccc942UL,
+0xec3fa2c49df8e2e4UL,
+0x6641d708778b946aUL,
+0x129474107ee09d16UL,
+0x830158d943970632UL,
+0x474c6ea8f572e51aUL,
+0xd244f47f9e3cb748UL,
+0x073878ec666dfd14UL,
+0xd9a0222fcfdabb50UL,
+0xf837bbe4d6d8d0e4UL,
+0x7c732b78a2c45f2eUL,
+0x061692fdc4a3ecacUL,
+0x957dc73a211974e8UL,
+0x34104f56f077bd76UL,
+0xb212c34209b0c624UL,
+0x0c546b15f01556c8UL,
+0x904931345a9eb972UL,
+0x0716c960f194074eUL,
+0x6ebf2738ca9ff5d4UL,
+0x15fe7551540a01e4UL,
+0x341bc8f1c32713f0UL,
+0x1e9b5b259621864cUL,
+0x666d077388bae348UL,
+0xecf6f01beca1db6eUL,
+0x80300a696cf095e8UL,
+0x039141f7657a9f82UL,
+0xf9b097088bc63b20UL,
+0x4b0b7cbbae3039b6UL,
+0x1f944847072d322aUL,
+0xe95a406fc3c860faUL,
+0xcf97d22173f4187aUL,
+0xc406b96b7c17d490UL,
+0x429be564bdb1b4d4UL,
+0xa91f9f77074d7a60UL,
+0xd88f512dcad46b16UL,
+0xc2655a59e0fb1258UL,
+0x0e4c9ddc5c382accUL,
+0x7a2c08b1a685de82UL,
+0x6f4dbe7b1dcf528aUL,
+0xce109ce9c22058eeUL,
+0x483c0c59f0fdf2c6UL,
+0x61b10124ec399e42UL,
+0xf5b04875c1d29102UL,
+0xacfb8908e7e874beUL,
+0xe844077644b35d40UL,
+0x31e4c538c07a741eUL,
+0x43b428e3bd72b924UL,
+0x76f8657b98556f72UL,
+0x380c0262dedbe1d6UL,
+0x82f36aeb634ea308UL,
+0x8cb5b3946229d9caUL,
+0xbc4a87cf2111fe34UL,
+0x417f7f99a3098e2aUL,
+0x1f7d124912aef430UL,
+0xe156d1cfdd1ef906UL,
+0x905280fe2fe27474UL,
+0xc80bedf3e861414eUL,
+0xea62c845a177bce0UL,
+0xaf6f661d8c65420cUL,
+0x97c6719cc5c550b8UL,
+0x1e713136b4dc6a3eUL,
+0xdd585d7c391217e4UL,
+0xb310a5df31a2658cUL,
+0x0f8f773fd8f68e6aUL,
+0x32ebae53d43041daUL,
+0x61f31a419b6246bcUL,
+0x777d45ff491a7490UL,
+0x89458007dba12baeUL,
+0x3964c6437d527fdeUL,
+0x06cfb790b30b1f30UL,
+0xe0659ba1651d6698UL,
+0x369c07d191688ca0UL,
+0xf08602a5157c39f0UL,
+0xa04a77799a3ba462UL,
+0x762a4e0b738f5146UL,
+0x8ab2b54076b6893eUL,
+0xe21115e7e4ace390UL,
+0x3ae84099abe21d46UL,
+0x67849b9ac78e7a9eUL,
+0xf4697b4d9b899788UL,
+0xfb32eedb7d441034UL,
+0x63c51a30e22d9406UL,
+0x620a1c82fea6a5deUL,
+0x2b90f65d0c846708UL,
+0x946a5b4d91c9a7a6UL,
+0x2aa1eccbf008ab86UL,
+0xa43f66fdd3c7ecfcUL,
+0x99e27c5065aae100UL,
+0xddb7c8edc50f3216UL,
+0x17cf0d0e571dc844UL,
+0xea4c7728089a1100UL,
+0x461085544547f280UL,
+0xae0eadaa0f3636a2UL,
+0x07895c594c45d1c8UL,
+0xe89d12e284fee9a4UL,
+0x9fdfaaffd9d00436UL,
+0x052851b7a691ae2aUL,
+0x48a96a221b5dd680UL,
+0x8d74d312ca4997b2UL,
+0x20b5d335154128b0UL,
+0xed408215c38c4a4eUL,
+0xfbbf0f3904b2e566UL,
+0xbb42aec6827db7e6UL,
+0xbb02e8b9b83eb856UL,
+0xd72e6144936448d2UL,
+0x087ca4afebc6563eUL,
+0xd2c3666912f2fa2eUL,
+0xc492b2c050bae46eUL,
+0x734f2afef4d3d2b8UL,
+0x68438d9b9c59d7faUL,
+0xc5817c40cc472264UL,
+0xc3987f9f62cb3080UL,
+0xbb09c57b135e470eUL,
+0xa5ff54ffc2ce3d80UL,
+0x33bac16074f01c42UL,
+0x4b12af8c2adbf3a2UL,
+0x1061287c8fb771beUL,
+0xac00072d59fa9404UL,
+0x508f42662741252aUL,
+0x9dbe05ce7bc2deecUL,
+0x1a47559e68ec9502UL,
+0x3ea63d2294d4df0aUL,
+0x643b745418ded8f6UL,
+0xa9e45836abad8636UL,
+0x21d1f38773a8c112UL,
+0x6f9b8f4365040e12UL,
+0xdb80cc8d65cc142aUL,
+0xafd559c0c3a7f378UL,
+0x5d4e05b296fa9704UL,
+0xff1e2c7bd0d06610UL,
+0xb37d3550ff58d388UL,
+0x8c48d24ce48eee8aUL,
+0x400c6ca7a1444464UL,
+0x0fb68a2c294496eaUL,
+0x8fedff278e237bf8UL,
+0x0949f32102299a9aUL,
+0xf53bcb5a3aae6b2cUL,
+0x681f25efd9ff3128UL,
+0x9d74eb113ba26036UL,
+0x188bd26f9388596aUL,
+0x692766219e229704UL,
+0xd022717cb114c972UL,
+0x29d76a04b8d95a26UL,
+0x098ad83142992acaUL,
+0x291c8254bea8301aUL,
+0x35943fc2575dea56UL,
+0x1dda2a370e2509c0UL,
+0x2b260e2b3dfcfedcUL,
+0x0b524a57dca9a9a8UL,
+0x1195ead774863924UL,
+0x80184c9b20c56530UL,
+0x3d0b3d43bfef1b76UL,
+0x47f953e28c2cc604UL,
+0x433fd5a13e64eeecUL,
+0x5675a226fcf03faeUL,
+0x74131c4090b38806UL,
+0x8845849340a57ecaUL,
+0x774f4f507baf22deUL,
+0x231a98e5413a2f14UL,
+0xea80f25f8b2089c2UL,
+0xf8fb2755bd8389d2UL,
+0xc2028627896ce608UL,
+0xde07955a5ef735a6UL,
+0xd645ddc5fdcfa6e4UL,
+0x23a224a84ee06ed6UL,
+0x596720b4f3e84c0cUL,
+0xda5b72b087b4d07aUL,
+)EOK"
+R"EOK(
+0xa5ec3bda143565a2UL,
+0x85b0b2fc47d5cbbcUL,
+0xf97b0b8e78a481daUL,
+0xc3a72dce51cd6078UL,
+0x65f032fee8538722UL,
+0xd2d6357e52d45a20UL,
+0x29f7f58b6e599f42UL,
+0x9cffa585181f76f2UL,
+0x6c2c828d00b4842cUL,
+0x3cc4cd6cfe9e82c2UL,
+0x5b2d1f9076fcfcc0UL,
+0xff518d599efb1b70UL,
+0x76e34ffffbf12936UL,
+0xe69010665a8fb4d4UL,
+0xf71b7dccee7cea88UL,
+0x31bef9956f297a04UL,
+0x47878b10ef800a48UL,
+0xb9e33575d4a115b2UL,
+0xd3fcaed86d67110aUL,
+0x81bac18da3343d8eUL,
+0x9eb878cac6c5be30UL,
+0xcdd1c662c2d2dc8cUL,
+0x1bcb7f1e9d317c2cUL,
+0xc1b06ceb46e637a0UL,
+0xc330e1eec1dfc8baUL,
+0xef1350d628a2f364UL,
+0x8ae8238713753f28UL,
+0xc68ffda17d7c42daUL,
+0x3490f28301d17e8cUL,
+0xf1b60fd8defabb3cUL,
+0x4a119ca510fe3654UL,
+0x8bc989f56fc51728UL,
+0x22991f8e439ace28UL,
+0x0d1d598cd55aef6cUL,
+0x4b1a7473c6f91124UL,
+0xbe021351de1b68eaUL,
+0x0bf1a41a81dfdc1eUL,
+0xb262198b7dbb188cUL,
+0x11f9fe0a125b0202UL,
+0x0e5371c77ee566faUL,
+0x6fd6ac16527a4a92UL,
+0x72c81426a759a72eUL,
+0xc4324c4b617a36e0UL,
+0x154a4f870da469e2UL,
+0x41db62ae944353c0UL,
+0xfc1cc6538c115d00UL,
+0x6f5fcd4546365682UL,
+0x282349d7ecd5af54UL,
+0xf8d1fe906cffd250UL,
+0x139d61b0bc8527b8UL,
+0x66e65031ee4962f0UL,
+0x61d2023906991e08UL,
+0xa8dd17321ed9cafeUL,
+0x41dcc844777aacaeUL,
+0x9339cc2d240a626eUL,
+0xb007aa07cec8f8d8UL,
+0x1c51cae4cf3c5c70UL,
+0xefbe4f5370a7bbdcUL,
+0x0cc2e635ef38321eUL,
+0x69655ef4dbc8a926UL,
+0x9e7b543d537f2706UL,
+0xe89b18b121984f3aUL,
+0x0341cbb2c351b7deUL,
+0x978474f319562bf8UL,
+0xf12b893447764d20UL,
+0x02bedd2b4d3b8322UL,
+0x6dd142aa17d48de6UL,
+0x783313870f82e474UL,
+0xacbab2c648cbf822UL,
+0xa67d3ac044d63e08UL,
+0xa102d7e9738bbd5eUL,
+0x5d3913402af8affcUL,
+0xb026a306eb099a06UL,
+0x2f3d32addfa012f4UL,
+0x2705bfb6dd564e00UL,
+0x76cb1d9f4ede8ca4UL,
+0xd6bedaad43387becUL,
+0xd22eadb8eff744d0UL,
+0x832053291a008e82UL,
+0x395be8d93880e7baUL,
+0x173202e1334157d0UL,
+0xcf7f717bdc0c73f8UL,
+0xbbc022e2dbfd85b4UL,
+0x9508c2ea43e0ae5eUL,
+0xd5dfbedb842ffc9cUL,
+0xdc6a286e5b71ac00UL,
+0xb480d229d8cb38bcUL,
+0x3765c9c319a0fed0UL,
+0x75d01d0f8c5d63a8UL,
+0x1ac5d0e6f9bb12aaUL,
+0x386966f5702aaa44UL,
+0x46fa13870945c36cUL,
+0x4b5194a3783fdee6UL,
+0x2ca0bb0b4370d77aUL,
+0xd7a161ba7ed392d4UL,
+0x58d880c8963b131eUL,
+0x5b68856777a81270UL,
+0x994699b281f52214UL,
+0xff91052918c63b98UL,
+0x9b653afcf52b5af4UL,
+0xb23a8937d5253feaUL,
+0xb8934f838a6e096eUL,
+0x732c87fe88075bd8UL,
+0xc0d3a45e38ba27d4UL,
+0x7fc2621fe3c0dcecUL,
+0x4c8cd3bdb109c404UL,
+0xa47f0a9c3f9c6bf4UL,
+0xd307b9fefcc0d3a6UL,
+0x96918f55e0e8994cUL,
+0x6b0e8e2693b0b2ccUL,
+0x8447969683df9f5aUL,
+0xb3b50d8b5ec975fcUL,
+0x33e695a3b3a58994UL,
+0x95c940a4abac1128UL,
+0xe7b80eafc4ea25aaUL,
+0x0ffaf48a5f8ff5a2UL,
+0x79b3c317e1f33a46UL,
+0x0c7bad3b4b17b620UL,
+0x34ba8d0c45dd9d4cUL,
+0x99b401dcf527255aUL,
+0xbae150979c649538UL,
+0x161e5378293b1e0cUL,
+0x60bf7d64744e65f0UL,
+0x52d0dcdd5b939910UL,
+0x4145e9b8a9e6ddd4UL,
+0x093a44810e4c5cf0UL,
+0x3813b4f2f1e2abf0UL,
+0xaa2dd56b05fcf340UL,
+0xd8207cb489c041c2UL,
+0xa15f4f637fe9ed98UL,
+0x88e0193b3444103eUL,
+0xc101b29f34ad3292UL,
+0x90b68df6b4eb9498UL,
+0x7fbb3615045eee00UL,
+0x6b5469b707f91756UL,
+0xd3451a7361f99ca2UL,
+0xdc3cd6b603fde9f2UL,
+0x10fdf82392766fe0UL,
+0xe3f243ea1c7a9b1aUL,
+0x9ff98b405f6b03f6UL,
+0x6296c951354b7c04UL,
+0x9a3c66f812ade32aUL,
+0x52f9c0d874921752UL,
+0x720a54dbac765468UL,
+0x0eb2d7cf900f6228UL,
+0xdb9be4a7d0fa6d96UL,
+0xa5cc1af285f9eba4UL,
+0x5a0ea0e8e5cea0eeUL,
+0x6a95c4c1998318fcUL,
+0xe5b87a2c48ae358cUL,
+0x96689415f986d056UL,
+0x2df36d1e3f77e114UL,
+0xf0e102aeef3f1be0UL,
+0xbdf774dacd37fd66UL,
+0x3bd640c82a45e252UL,
+0xe4270fa8e875c824UL,
+0x75cf625c3ac9e96aUL,
+0x24c5ac516f6d9416UL,
+0x03ecb50a2780c68cUL,
+0xc8ba1d2aec3487acUL,
+0xaf31b440428a013aUL,
+0x80d9587f903d3f4cUL,
+0x3e83b8a0f6713b80UL,
+0x2b2a574a82c621caUL,
+0x120d8ac5091a8b8cUL,
+0x2584bdb4c968ee10UL,
+0x8e6195ca0f763baaUL,
+0x153178952a6040aeUL,
+0xd1d9b3900968b6a8UL,
+0xfd1885ae9e738202UL,
+0xa7a81c85049c2e36UL,
+0x945ae511b2431468UL,
+0xc57a08e3edb7ed5eUL,
+0x7a7b92f3fd245280UL,
+0x3eea44fe2c97e056UL,
+0xd88da41f7a861b58UL,
+0xd851d7d5d23932d0UL,
+0x119d3355078e3114UL,
+0x0e224755168a2362UL,
+0x2d38525ef4a00492UL,
+0x960eb789af9a2938UL,
+0xdd26e24a0b57e82cUL,
+0x9e3b8c4e6bfad464UL,
+0x7b9a1e2930ea1ed6UL,
+0x4968d7ce1108952aUL,
+0xef24ceacca101a70UL,
+0x7b8bdd39cc52e422UL,
+0x48f0674d46e40b10UL,
+0xa1f6959969f856eeUL,
+0xceb4fe41b0226b1eUL,
+0x7a694e7b3d9a48eaUL,
+0xcd3b3cdfad244094UL,
+0x81827b1e07ac3c60UL,
+0x821aeed843b3dc36UL,
+0xb32ba1a86a3c0c10UL,
+0x75eb7edfa7d7e0d8UL,
+0x2e015cc69b7f20f2UL,
+0xb2ad27fb067d47daUL,
+0x27628a7fe57ede72UL,
+0xf98d34c76122198cUL,
+0x6bba1b0d101b05a8UL,
+0x6fa18ca47b0ea832UL,
+0x35b6dd5ea2dcf80aUL,
+0x20ffce4ed747982aUL,
+0xc2dcc5319e204b4aUL,
+0xa7a4746e7bb8efacUL,
+0x405644eb6d418f08UL,
+0xebbbc06c9c3d90b2UL,
+0xb45413d207b5d04cUL,
+0xe9f0724dc876f7dcUL,
+0xdfe76c1a8aa6e868UL,
+0xfe09f732ebd5038aUL,
+0xa38889c4ea72b40eUL,
+0xfbec3869ff4b744eUL,
+0x21105609600c2ae0UL,
+0x6c6debd977c48f04UL,
+0x3a679538033af5f4UL,
+0xc5686531bc0d64c4UL,
+0x24d837d4fe56b684UL,
+0xa4340cb588a27d9cUL,
+0x96fd1468137c32e4UL,
+0xa47568eb13e54cc2UL,
+0xb08317daddfb03c2UL,
+0x0cf7cbf63a0626acUL,
+0x9ea42fc4f691a7beUL,
+0xb14be4a420526898UL,
+0x949b94ff01fe6a0eUL,
+0xe264b8bba7138c04UL,
+0xa6c771623aac0e44UL,
+0x12082f91d44a8de2UL,
+0x741a6293502e25f8UL,
+0xcfaf3c65ab1a765aUL,
+0xdfac97e475848f46UL,
+0xa425bf85b2569af6UL,
+0x78c3dd01b418b308UL,
+0xcab2b5eca14b8886UL,
+0xe316dac83d554320UL,
+0xf58e86046bc5eff0UL,
+0xcc683d12193d28f4UL,
+0xa615a8115088f168UL,
+0xdc544436ad456faeUL,
+0x570bd3a4a7cd101eUL,
+0x14f376a2601367daUL,
+0x8c47e2b54e65796cUL,
+0x0dc42d16f3631c3cUL,
+0x5b4e484a3383f0f0UL,
+0x96f02210121531f8UL,
+0xb60da8d72520fc10UL,
+0x0fc7a265baa1bb3cUL,
+0x5422644195c965f2UL,
+0xa88fec68319cb6d8UL,
+0x523e7523be40c7e8UL,
+0x85dd6d014e597ce6UL,
+0xf5afa3be58df6c22UL,
+0x79bef7781020e642UL,
+0x842d5cc6958d9546UL,
+)EOK"
+R"EOK(
+0x0bfc23cad48c433eUL,
+0x1d8026fd7bdee3feUL,
+0xefffab31e2950f06UL,
+0xd85983fee2e30b8aUL,
+0x86037e0c5d9eb8f4UL,
+0x97d9f8824306986aUL,
+0xf3ebfa09c9990caaUL,
+0x438c964fe10ac6dcUL,
+0xd1941f9aee802576UL,
+0x81ce06aee5144528UL,
+0xd910d38f45d4aed4UL,
+0x1a31a755bbc77466UL,
+0xaf9121e11048c7e2UL,
+0xac9a7acadd7518ceUL,
+0xeb80772844d93be8UL,
+0x177324980d4cee4aUL,
+0x76e708b367345582UL,
+0x3c67047226d25b54UL,
+0xcb8fe77e7bc62b42UL,
+0x1f17ee3399d670deUL,
+0x65be7ade39a816d4UL,
+0x75e2ee105c9b6bd8UL,
+0xf27a964dc151f5d8UL,
+0xb35af5dd7303552cUL,
+0xf15a11ef22d57238UL,
+0xc68f6a9638eb0b38UL,
+0x90b92f3be8dc42ccUL,
+0xd395b8df60199a88UL,
+0x848586a81233e7b4UL,
+0x4f45bbb79c39b276UL,
+0x528656bdc97c739aUL,
+0xe603732563730be4UL,
+0x67daa2ddfdc71deeUL,
+0xa5813571c8666922UL,
+0x9a7307e8d159cd4cUL,
+0x491fcf0463ec6170UL,
+0x0e7f6c8a1007ed6eUL,
+0x0f9882474c5000ecUL,
+0xaddd12e1e9547604UL,
+0xcf938098730fed68UL,
+0xb94e3cb21b127028UL,
+0xddc6ff2b53d40ec8UL,
+0x645e8f7b8d034576UL,
+0xef63eac195a8b5ccUL,
+0x5c6064dcf1a8515cUL,
+0x191a8b0c22ac914eUL,
+0xf07952aa40ec54caUL,
+0x5d938a197b4cd93eUL,
+0x11ac058b40d62e60UL,
+0xb02556da044b61d6UL,
+0x3e88eeba087cf2d6UL,
+0x43f49023356a825eUL,
+0x5ffa14f442c4d7c6UL,
+0x55ad41c40dd29a64UL,
+0x2391436617456e5eUL,
+0x8a0631b4bbcf7ca6UL,
+0x518d735d880e5938UL,
+0x26c977e0b349788eUL,
+0x2b83caa342650c2aUL,
+0x54fe7aacfbbfa84eUL,
+0x5f658e1f32b0550eUL,
+0xa5e6c471b3e13b20UL,
+0xfaa7d09b3e289410UL,
+0x872c7c0e437b13f8UL,
+0xa36ff0dcc120085eUL,
+0xf469b303a5e1003cUL,
+0x080c88976fa883deUL,
+0x35dd52080b59b106UL,
+0xc5a9792b547bcc20UL,
+0x256d060b2084b956UL,
+0xfd0185bf6e78ef04UL,
+0x4f1bd36db95e7440UL,
+0xb388cef9fcbea780UL,
+0x63bf54aabce96a12UL,
+0x3e3a040ecbbe1b72UL,
+0x3793c465e8c180a8UL,
+0x192ae8eb0c379a44UL,
+0x5708f371fd7339ceUL,
+0x274b87de5685a16cUL,
+0xbc8637a8d5b42ddcUL,
+0xc8cae5480d018ea4UL,
+0x721de84e6b785038UL,
+0xc00c88aaa2f9ac0aUL,
+0x32f64385c707679aUL,
+0x1d1d98f8d29630e6UL,
+0xd828e70ce4d4471cUL,
+0xf8020a478fb55250UL,
+0x1713e591ab1b44a4UL,
+0xede486adb7720ee8UL,
+0x33dcfa23845dedeaUL,
+0x48310ee9a017f4bcUL,
+0xcb78b7711a42449eUL,
+0x9f93e658b312d936UL,
+0xa437b5d6d650e308UL,
+0xd8e091da5dfdf9f2UL,
+0xf9e530f3d6c298ceUL,
+0xa11107a77afb5c5aUL,
+0xfe10325b8a7f18e8UL,
+0xcffc91c568eb55b8UL,
+0xc385cf92e14303c8UL,
+0x6e157c9f6d640ae8UL,
+0x578ba04a625d02c8UL,
+0x599a69c43957b6b8UL,
+0x4a3e15f3373f7b6aUL,
+0x78ca38e162ad9acaUL,
+0xa3a95e17939583f0UL,
+0x5ea71f98aa6d77d8UL,
+0x6f67fa46b72b81f8UL,
+0x519675a4b2a091feUL,
+0x0a47b38a0a5ea9bcUL,
+0x57204ffcac1ce75eUL,
+0xdd4fe40e91799280UL,
+0x23b5e230a40d5690UL,
+0x9118bc72af95eb54UL,
+0x113c400109d2255cUL,
+0xb169a830af9965d2UL,
+0xfe04136ef12deb2eUL,
+0x6dfa8421836ca802UL,
+0x03b243a07c240852UL,
+0x59213a589c7a6270UL,
+0x6ee22b0369a51fa6UL,
+0xb78dd3287c07a36aUL,
+0x47406345bfab6764UL,
+0xbedf4e3439c96848UL,
+0xf69dc467e6121da4UL,
+0xa7641a1562b60106UL,
+0x1970761422815d90UL,
+0xc93868ac4842609eUL,
+0xcee40889dd70bceeUL,
+0x3d045be979f518c6UL,
+0x058a5dd28b2b02acUL,
+0xf658fbfda56e9530UL,
+0x52b421a6ed60d9ccUL,
+0x80a682675fa26e72UL,
+0x9542f8f28e07b702UL,
+0x136f2e5d049bb5e2UL,
+0xfad30d3ab5267ceaUL,
+0x050e42922ec3e9d6UL,
+0xad28e14993def3f4UL,
+0xf352e1ef26f3a36eUL,
+0x404bc4a2929a8900UL,
+0xf3a3a361f2345fdaUL,
+0x95e035af560c0606UL,
+0x866a54f2abc753d6UL,
+0x4dfdb37e34095692UL,
+0xc7d4eda6f3642148UL,
+0x10e86d0bb36c1e6aUL,
+0x83edb39614fc2dd8UL,
+0x2d21d2461664892eUL,
+0xcb7541c6e11f12d0UL,
+0x83f72e68ebe6c9f4UL,
+0x5d151b39381b5c7eUL,
+0x9a2eff60f1ec547cUL,
+0xd9b2697cb678b730UL,
+0x54af43d8da5bd1fcUL,
+0xceaba99054fd0e4eUL,
+0xf8ec9095d2e60b3eUL,
+0xea59b223c647a1e4UL,
+0x8790689b66e4a7daUL,
+0xe5d370a13f9037f2UL,
+0x926a8a5136945ee6UL,
+0xdeeb0be5b7174b5eUL,
+0x6eebe43d794748fcUL,
+0x26717c75a1952474UL,
+0x5a49fdf502e889eeUL,
+0x6642c73ae5c5df6aUL,
+0x3c4a003262032bceUL,
+0x566ac799cd3e3d3aUL,
+0x33e0c675515fdd76UL,
+0x08d07e099ee45262UL,
+0x34fec527d5be05beUL,
+0x5daa04c59989028eUL,
+0x28127bd8d2d5a3f4UL,
+0x3981c1a043f0b0faUL,
+0x3f2e6e112bcf1932UL,
+0x1b253f680ff43e64UL,
+0x6b9cd2d842d9c2e2UL,
+0x136fdc7acf2395ccUL,
+0x0c09d8d8418a6758UL,
+0x60001d22c808025aUL,
+0x966789dab689e2b2UL,
+0x4679255ce47c32feUL,
+0xeec5561d7a556172UL,
+0xa939efec92d66f9eUL,
+0xbdd91741341097ceUL,
+0xbc58f23fa5e5f974UL,
+0x53437071c4ee9876UL,
+0x38316a7d11599394UL,
+0xb3710d51212c967aUL,
+0xa2e4b829cbc74da0UL,
+0xedc8de42c70b5936UL,
+0x36425de4808fa68aUL,
+0x111b611a7f6b060cUL,
+0x3c03b691a45899a4UL,
+0xc5661d30819d113aUL,
+0x54a0196b67c147e4UL,
+0x1eab5ac039cd567eUL,
+0xc9c45785e9b1ddeaUL,
+0x03e350448b0ee264UL,
+0xa5251131a6d7ee04UL,
+0x8762ceb8c01b5b16UL,
+0x5e6005035ff4059eUL,
+0xf4e95a9437f22200UL,
+0x5adcef47330ee330UL,
+0x6fefd4189fcab65cUL,
+0xd144fe3f098476aaUL,
+0x24ce1fe376c78deaUL,
+0xcc516160019728acUL,
+0x1421af368cdb8e78UL,
+0xd12b9307b2db9246UL,
+0xeb5234941319bc64UL,
+0x6d0c26a48141a418UL,
+0xbebf9a140896c118UL,
+0x7e9001dac5c6707cUL,
+0xa5fd0006037dcfc8UL,
+0x5e08dcc0a796f03cUL,
+0x3e380e904afee546UL,
+0x3fa465ba14ad5246UL,
+0xbd25eb14e4ff0c90UL,
+0x1006a398d5aba9c2UL,
+0x910ab4ce355e3aacUL,
+0x846e05c3a9954984UL,
+0xc7bf51b7796cd104UL,
+0xa838ea985d33b296UL,
+0xabbdd4c2075887a4UL,
+0xdb6718baa4d7bcfaUL,
+0xae64e67b55ad4a88UL,
+0x66e8902aa33d8cf6UL,
+0xaf8887d8d04d6010UL,
+0x3a0550cdff802a6aUL,
+0x93abf76d66908ee4UL,
+0x0d453cd6ed8ff52aUL,
+0x7ffb3562040cd26cUL,
+0x0f69340af12341f0UL,
+0xaee7806badd27018UL,
+0xfb2913d3fcb093aeUL,
+0xe8977ff39009748eUL,
+0x9ccb8af8e9639c6eUL,
+0xd3963a8f0070cdc0UL,
+0x0e1486e7877c3e04UL,
+0x744675c14b327cb0UL,
+0x6e3527a54b8d67caUL,
+0x73b6f15cce8fe572UL,
+0x1d270e76b5a64a50UL,
+0x1d004af2f5f96fa6UL,
+0xd7695f7437be39e2UL,
+0x8b6a0dc814552a46UL,
+0x161efe8585310588UL,
+0xe988f2529ad7aef2UL,
+0x85807b832035085eUL,
+0xd7ebe3611548c812UL,
+0x1bbda9c815e3f68eUL,
+0x641b25b6e0487036UL,
+0xb29f676cabdb03f4UL,
+0xdb1e9d82a5b1701eUL,
+0xad4d572eb918629eUL,
+)EOK"
+R"EOK(
+0xa8eadb279399052eUL,
+0x56959a0a1933dcbeUL,
+0xa9a93bfb6343a590UL,
+0x3bdacda4c341e8e8UL,
+0x2ecf0253f29938c4UL,
+0x4850afd8d3516d02UL,
+0x3175d924a6c34208UL,
+0xa1f56c868b1aa62cUL,
+0x1966bf3a32703a22UL,
+0xebabeb6d839fc088UL,
+0x3f0600ec09543c8eUL,
+0x9041f3029416ae36UL,
+0x15ea9a180297c772UL,
+0xdbbe28ec7f21207eUL,
+0xeb5977cac3bf3424UL,
+0x30d21215a7a6f42aUL,
+0xccb889a26b2b5af0UL,
+0x08f043674832a014UL,
+0xb193ea66dab7993aUL,
+0x595fe443836cbd98UL,
+0x1c46696cd4a09906UL,
+0x0dcae0922d5d5f10UL,
+0x9511b167b4804368UL,
+0x63c003c7753f5ff2UL,
+0x3ee8da052a06f2ceUL,
+0xdaf623cbd904e088UL,
+0x035e23c8d030a40cUL,
+0x9c983e9988218360UL,
+0x1aa44d86c70b2522UL,
+0xde48f19ebc182502UL,
+0x53a283de954ee308UL,
+0xf9d2cd5d12748bc6UL,
+0xe58ff7826b82ecd8UL,
+0x35a6fd2839113a3eUL,
+0x7386bcd36e8d739cUL,
+0x59ac6bc57f7bc56eUL,
+0x28e4774f533060daUL,
+0x86a94c4d7b71909aUL,
+0xd2b6c4dfd4f2c334UL,
+0xe4c42f36f5684170UL,
+0x23f067dc2ddda3a4UL,
+0xe5ef1c7219d07e18UL,
+0xd7d738192928161eUL,
+0xf656ece5c3e263fcUL,
+0xd66a35f8a9b8c4c6UL,
+0x785431dbecaed3d8UL,
+0xc0121ce29ebe83ecUL,
+0xd7d2838a3de8e33cUL,
+0x8bdf8e054d34229aUL,
+0x7e934f965c4bec04UL,
+0xdaea41ca46d626aaUL,
+0x4cc488d1222894b2UL,
+0x43a8efdd01e1e03cUL,
+0x7dd5e49932d3efaeUL,
+0xe450889ab8342a84UL,
+0x70f77e0a16a951eeUL,
+0x65764d083cd3bd30UL,
+0xe077e502b9c6a008UL,
+0x9926e2c18921f864UL,
+0x34916c16fab9d2c2UL,
+0x07746f81ba5c78caUL,
+0x9f9f70497c2b3932UL,
+0x137c9b981d6da012UL,
+0xd8828734493e3af2UL,
+0x14d6d988fc2cf758UL,
+0x1d7b09065f555f80UL,
+0x835eacb789a4ce18UL,
+0xa6bd17a8c29c985eUL,
+0xba9d416aadc350daUL,
+0x7185c5b8e5f0e578UL,
+0x430aa2c6822bcbb0UL,
+0x577d716e76f392b2UL,
+0x063c03489b77e370UL,
+0xafaa2af29cf2f5feUL,
+0xa438906060ff048aUL,
+0x356e4bed738ef092UL,
+0x7b4208407bf7a486UL,
+0x9822629339497642UL,
+0x5eda1ac42b8f2936UL,
+0x38384032818e250cUL,
+0xb6d3bff3a20b9beaUL,
+0x0e332c33736b5af2UL,
+0x6f0d26b22c7498c4UL,
+0xe6ad8b281fd03fa0UL,
+0x6d749e7754c43a8aUL,
+0x9365feda0e8de478UL,
+0x8820fe09c3b1fc5eUL,
+0x427d752a28cfc0c4UL,
+0x5b1bf6ee9e14bcd0UL,
+0x39f487b0880fc490UL,
+0x7b10f27f4d019692UL,
+0x590eaa3e200fe8b4UL,
+0x1a04791f3b821c9cUL,
+0xe63dd1b49d518ce0UL,
+0x7a8fecce557a99aaUL,
+0x6a86e6f848d3e20eUL,
+0x70b9d38f0a9b7416UL,
+0x792fa6040ba0e58aUL,
+0x58258811e426df5aUL,
+0x3dc29d3f189a1f84UL,
+0x2b4b53e0e32585aeUL,
+0xca0b2e13de6e98eaUL,
+0xe7456348ebba39acUL,
+0xe82edd11883546c0UL,
+0xc1edfd384999390aUL,
+0xa94b84a702bcfd72UL,
+0x0fe7c1668ccc2e7aUL,
+0x9d1c841306cc204cUL,
+0xb36c225081bedcfeUL,
+0xfde1159beecdd63eUL,
+0xd64d03117c41d7f2UL,
+0xa69c5211e586b628UL,
+0xfe8c13b18d9d2ab8UL,
+0x2272ff6dc2e201ecUL,
+0x990d70b3746d6ff0UL,
+0xea59f31f3d8fc300UL,
+0xb7694872f1b269c4UL,
+0x83653b0387c7a93cUL,
+0xdb434e6b93bda6aeUL,
+0xe1fdefb17a993198UL,
+0x580f17694b0ddf56UL,
+0x4fccf35def39eaacUL,
+0xf903a7d760f437a0UL,
+0xd9c70c7201446ea2UL,
+0x7b5e1b4d39ed849cUL,
+0x70ac3985a20bde5eUL,
+0xe5a92eb9a0fae82aUL,
+0xd5e92e1e8c0dbb8cUL,
+0x12ac87e21ed8845aUL,
+0x3149b77b628c8d26UL,
+0x8828375cc3c8953cUL,
+0x99dd07b925494f6cUL,
+0x8afc62cd0f509cf6UL,
+0x58f28c3cde1b0914UL,
+0x77d776bbdfb2ee88UL,
+0xbdb7dd3e1b5086d6UL,
+0xb4835d31de571ef4UL,
+0xe7bcaccca4b437bcUL,
+0x7383a7ff71a76c8aUL,
+0xbca35284326e0d04UL,
+0x754184ed4ede1f48UL,
+0xfaa102c966f8c268UL,
+0x2b48ffe328380494UL,
+0x18b0df2f4add93a4UL,
+0x489c780620ae99f8UL,
+0x1172744efafc1eb4UL,
+0x7e99dcc0610797aeUL,
+0x2e3c579a35f4ef7aUL,
+0x88e16b51b6695112UL,
+0x2e9b37ecfe018f46UL,
+0xd8b9e0b5c60d80e0UL,
+0xa1c95b92fb792f06UL,
+0xf9d9c16753ec977eUL,
+0x9f599424e79960f2UL,
+0x964d5b03a1a1a9b0UL,
+0x9fc1c05ec9e9804aUL,
+0x75cfe83a6d70690aUL,
+0x035bf6b1f9d3ee3aUL,
+0xb23e6f3a4f8a8c80UL,
+0x4b2153e4802cbc30UL,
+0x50686301a2487b78UL,
+0x936fb940a15ae1d2UL,
+0x63368b96071e1bb4UL,
+0x8d712457948a9432UL,
+0x4772ca0385480ca4UL,
+0xde013e6414cb38d0UL,
+0x627c472b45ea01b2UL,
+0x3919c3af14138e3aUL,
+0xf6233499a738ca94UL,
+0x36f3c92ebb1014d4UL,
+0x4c15bf1efc106368UL,
+0x4c5caa8adb2b4ee2UL,
+0x6e12636b74750974UL,
+0x86cfa26f6b236244UL,
+0xd3fc610d687104e2UL,
+0x24b781865b30ed98UL,
+0xa40834e45ce811d0UL,
+0x7f5c6b8ed3b7c7a4UL,
+0x249ef14ae8e507a6UL,
+0x6d32e09ebbd54d3cUL,
+0xcf07ec5f28433374UL,
+0x78aebf1bc133c860UL,
+0x5fac23630d738374UL,
+0x3adeda738731d1e0UL,
+0x87e0c8a8c3572ddcUL,
+0x33c3c67da2bf98a2UL,
+0x68511e0efa917d1aUL,
+0x1161eb8522a7a820UL,
+0x9ce9dd5e2b08ec7cUL,
+0xe369e37de36f38f6UL,
+0x1bf81f520d69e832UL,
+0xbd195d47ba1a3b54UL,
+0x831280ae7262c37cUL,
+0x54635a8caad93f3eUL,
+0x9c89e556d373bf76UL,
+0xed0c32fe26571f2cUL,
+0x63e77ab8ca226bacUL,
+0x1f88d9e0951b78baUL,
+0xa58eea99c9cfce48UL,
+0x6cb0e63e345bacbeUL,
+0x93e710291afc8866UL,
+0x88767c38234cd330UL,
+0x135992edde071db8UL,
+0xf5fab74c7237c26cUL,
+0x667512df1848ede8UL,
+0x9df6176bedc7dbc0UL,
+0x2a97879d583fc2d2UL,
+0x2fd9a14d8ccdbefeUL,
+0xde3091a83f8a3fd0UL,
+0xebb265d02347d91eUL,
+0x05a55eca1a69203cUL,
+0xd906705f2631e124UL,
+0xe2ca73c8f7db18feUL,
+0xe43d76ba4b515dd0UL,
+0x42a64d5e880888b0UL,
+0xa8cc4e7477e753e4UL,
+0xff09a292a54d64a8UL,
+0xea0200d9006f4946UL,
+0x0d6d5ad65ea93ed4UL,
+0x7bedb2dc237fd598UL,
+0xec02a87d48848ffaUL,
+0x3daf95b016661f64UL,
+0x20521e931f3beb68UL,
+0xf38f8c4f447c3a32UL,
+0xaef8bd9833e9490aUL,
+0xade76aaef256598cUL,
+0x43f66e8ac4f5eb48UL,
+0x1fe82eaa61f21986UL,
+0x40897e77637faf1aUL,
+0x1f976d155ccd5a2aUL,
+0x27ab4fa6848d2ac6UL,
+0x0caf08c1cf32a85eUL,
+0xcc42be13cee7652aUL,
+0x778d222a29c0d936UL,
+0xb0b160238847660aUL,
+0xd57ac7f9a6eb7b2aUL,
+0x44474d090aff934cUL,
+0x31c43b98e18b8a98UL,
+0xc91bf4160853e346UL,
+0x0e73fb65e6045436UL,
+0x4c78bdd1fa7225c8UL,
+0xd729cbb6d2f937c8UL,
+0x449e83aaf0abe8dcUL,
+0xa4ff933bbda6ef30UL,
+0x365ece482a6503f0UL,
+0xec69f81cb9728e68UL,
+0xea36b92cdbdb8bc8UL,
+0xaad37701dcbaad9eUL,
+0x8099648a4222a044UL,
+0xac444b1ea00275daUL,
+0xcbbef0d16c6c7dc0UL,
+0x07cf5f4b95abd1aaUL,
+0xb7668eae6e372a16UL,
+0x40273f20c9dc86aaUL,
+0x9b006b717d46183cUL,
+0xd51895288d5ae0c4UL,
+};
+
+/**
+Seeds tinymt64 RNG with the parameter set of instance id.
+
+@param state Variable, that holds state of the generator to be seeded.
+@param seed Value used for seeding.
+@param id Index of the instance of the generator.
+*/
+void tinymt64_seed_instance(tinymt64_state* state, ulong seed, uint id){
+	uint p = id % TINYMT64_NUM_PARAMS;
+	state->mat1=tinymt64_mats[2 * p];
+	state->mat2=tinymt64_mats[2 * p + 1];
+	state->tmat=tinymt64_tmats[p];
+	tinymt64_init(state, seed);
+}
+)EOK";
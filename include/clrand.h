@@ -50,10 +50,52 @@ enum clrandRngType {
     CLRAND_GENERATOR_XORSHIFT6432STAR = 21
 };
 
+// Order in which the numbers of the work-items are laid out in the stream
+enum clrandLayout {
+    CLRAND_LAYOUT_AUTO                = 0, // Blocked on CPU devices, interleaved otherwise
+    CLRAND_LAYOUT_INTERLEAVED         = 1, // Consecutive numbers come from consecutive work-items
+    CLRAND_LAYOUT_BLOCKED             = 2  // Each work-item writes a cache line of consecutive numbers per round
+};
+
+// Derivation of the seeds of the PRNG instances from the seed value
+enum clrandSeedScheme {
+    CLRAND_SEED_LEGACY                = 0, // Seed of instance i is (i << 1) + seed value
+    CLRAND_SEED_SPLITMIX64            = 1  // SplitMix64 hash of the seed value, stream id and instance
+};
+
 typedef
     struct clRAND
         clRAND;
 
+// Statistics on the temporary buffers of a stream object
+typedef struct {
+    size_t tmp_buffer_entries;   // Number of entries new fills of a temporary buffer hold
+    size_t tmp_buffer_bytes;     // Device memory currently held by all temporary buffers
+    size_t resize_count;         // Number of times temporary buffers were reallocated
+    size_t fill_count;           // Number of generate kernels launched
+    size_t request_count;        // Number of requests served
+    size_t last_request_fills;   // Number of generate kernels launched for the last request
+} clrandStreamStats;
+
+// Statistics on the caches of compiled programs, shared by all stream objects
+typedef struct {
+    size_t memory_hits;          // Programs found already compiled in this process
+    size_t disk_hits;            // Programs loaded from binaries in the cache directory
+    size_t disk_misses;          // Programs not found (or not usable) in the cache directory
+    size_t source_builds;        // Programs built from source
+    double load_seconds;         // Time spent loading programs from binaries
+    double build_seconds;        // Time spent building programs from source
+    size_t il_loads;             // Programs created from the SPIR-V embedded in the library
+} clrandCacheStats;
+
+// Work configuration of the generate kernels of a stream
+typedef struct {
+    size_t wkgrp_size;           // Number of work-items per work-group
+    size_t wkgrp_count;          // Number of work-groups
+    size_t buf_mult;             // Smallest number of entries per work-item in each fill of a temporary buffer
+    double seconds;              // Time of the autotuner benchmark with this configuration
+} clrandWorkConfig;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -63,6 +105,40 @@ CLRAND_DLL clRAND* clrand_create_stream();
 // Initialize the PRNG
 CLRAND_DLL cl_int clrand_initialize_prng(clRAND* p, cl_device_id dev_id, const char *name);
 
+// Use command queues shared with the other streams on the same
+// context and device (call before clrand_initialize_prng)
+CLRAND_DLL void clrand_set_shared_queue(clRAND* p, int enable);
+
+// Get the number of compiled programs held by the shared program cache
+CLRAND_DLL size_t clrand_get_num_cached_programs();
+
+// Set the directory in which compiled program binaries are kept between
+// runs. NULL falls back to the CLRAND_CACHE_DIR environment variable, and
+// an empty string disables the cache directory.
+CLRAND_DLL void clrand_set_cache_dir(const char* path);
+
+// Get statistics on the caches of compiled programs
+CLRAND_DLL void clrand_get_cache_stats(clrandCacheStats* stats);
+
+// Benchmark a grid of work-group sizes, work-group counts and numbers per
+// work-item for the PRNG and precision on the device, and return the
+// fastest configuration in best. The configuration is kept as the profile
+// of the device, driver, PRNG, precision and kernel options, and is used by
+// the streams created later (also in later runs, when a cache directory is
+// set). Streams without a set number of generators only take its numbers
+// per work-item, as their launch shape decides their numbers.
+CLRAND_DLL cl_int clrand_autotune(cl_device_id dev_id, cl_context ctx_id, clrandRngType rng_type, const char* precision, clrandWorkConfig* best);
+
+// Set the work configuration of the stream object (before
+// clrand_ready_stream), overriding the tuned profile. Zero fields keep the
+// profile, or the default configuration of the device.
+CLRAND_DLL void clrand_set_work_config(clRAND* p, size_t wkgrp_size, size_t wkgrp_count, size_t buf_mult);
+
+// Get the work configuration of the stream object (after
+// clrand_ready_stream), and a description of how it was chosen from the
+// resources used by the generate kernel
+CLRAND_DLL const char * clrand_get_work_config(clRAND* p, clrandWorkConfig* config);
+
 // Get the precision setting of the PRNG
 CLRAND_DLL const char * clrand_get_prng_precision(clRAND* p);
 
@@ -75,14 +151,182 @@ CLRAND_DLL const char * clrand_get_prng_name(clRAND* p);
 // Set the name setting of the PRNG
 CLRAND_DLL cl_int clrand_set_prng_name(clRAND* p, const char* name);
 
-// Seeds the random number generator in the stream object
+// Seeds the random number generator in the stream object. Numbers buffered
+// from the previous seed are dropped, so the stream restarts from the new seed.
 CLRAND_DLL void clrand_set_prng_seed(clRAND* p, ulong seedNum);
 
+// Set how the seeds of the PRNG instances are derived from the seed value.
+// The legacy scheme gives neighbouring instances nearly equal seeds, which
+// weakly mixing PRNGs (lcg6432, msws, mwc64x) take long to decorrelate.
+// CLRAND_SEED_SPLITMIX64 hashes the seed value, the stream id and the
+// instance on the device. Takes effect at the next seeding.
+CLRAND_DLL int clrand_set_seed_scheme(clRAND* p, clrandSeedScheme scheme);
+
+// Set the stream id hashed into the seeds by CLRAND_SEED_SPLITMIX64, so
+// streams with the same seed value give independent numbers. Takes
+// effect at the next seeding.
+CLRAND_DLL void clrand_set_stream_id(clRAND* p, cl_ulong id);
+
+// Seeds each PRNG of the stream object from its own seed (after
+// clrand_ready_stream), seeds[i] seeding PRNG i. num must be the number
+// of PRNGs (clrand_get_num_prngs). All PRNGs are seeded in one launch.
+CLRAND_DLL cl_int clrand_seed_from_array(clRAND* p, const cl_ulong* seeds, size_t num);
+
+// Same as clrand_seed_from_array, with the seeds in a device buffer of num
+// cl_ulong, so they need no copy through the host
+CLRAND_DLL cl_int clrand_seed_from_buffer(clRAND* p, cl_mem seeds, size_t num);
+
+// Leaves the seeding of the PRNGs to the first generate launch after each
+// seeding, which seeds the states in registers instead of loading them
+// (call before clrand_ready_stream). This saves the seeding launch and the
+// fill of the temporary buffers when the stream is readied, and gives the
+// same numbers as eager seeding.
+CLRAND_DLL int clrand_set_lazy_seeding(clRAND* p, int enable);
+
 // Readies the stream object for random number generation
 CLRAND_DLL cl_int clrand_ready_stream(clRAND* p);
 
+// Sets the number of temporary buffers the stream object cycles through.
+// Drained buffers are refilled in the background while the others are
+// copied from. Must be called before clrand_ready_stream.
+CLRAND_DLL int clrand_set_num_tmp_buffers(clRAND* p, size_t num);
+
+// Enables (default) or disables resizing the temporary buffers to the
+// sizes of recent requests
+CLRAND_DLL void clrand_set_adaptive_tmp_buffers(clRAND* p, int enable);
+
+// Have each work-item write runs of consecutive numbers with vector stores
+// (uint4, float4, ulong2, double2), which changes the order of the stream
+// (call before clrand_initialize_prng)
+CLRAND_DLL int clrand_set_vector_stores(clRAND* p, int enable);
+
+// Seed each instance of tinymt32 and tinymt64 with its own parameter set
+// (mat1, mat2, tmat) from a table of 1024 sets of full period, so that the
+// instances run distinct recursions rather than the same one from
+// different seeds. Other PRNGs are not affected. There is one set per
+// instance, so clrand_ready_stream fails for streams of more than 1024
+// PRNGs; clrand_set_num_generators keeps the number of PRNGs within the
+// table on any device (call before clrand_initialize_prng)
+CLRAND_DLL int clrand_set_instance_params(clRAND* p, int enable);
+
+// Set the layout of the numbers of the work-items in the stream. The
+// default picks the blocked layout on CPU devices, where work-items
+// writing to the same cache lines slow each other down, and the
+// interleaved layout elsewhere (call before clrand_initialize_prng)
+CLRAND_DLL int clrand_set_layout(clRAND* p, clrandLayout layout);
+
+// Get the layout of the numbers of the work-items in the stream
+CLRAND_DLL clrandLayout clrand_get_layout(clRAND* p);
+
+// Set extra options for building the kernels of the stream object, such
+// as -cl-mad-enable (call before clrand_initialize_prng)
+CLRAND_DLL void clrand_set_build_options(clRAND* p, const char* options);
+
+// Fill the temporary buffers with kernels built for their exact size, with
+// the launch configuration fixed at build time and the store loop unrolled
+// (call before clrand_ready_stream). One kernel is kept for the current
+// fill size, and rebuilt when adaptive sizing resizes the buffers.
+CLRAND_DLL void clrand_set_specialized_kernels(clRAND* p, int enable);
+
+// Set the number of store rounds unrolled in the specialized kernels
+CLRAND_DLL int clrand_set_unroll_factor(clRAND* p, size_t unroll);
+
+// Apply a transform to every number before it is stored (call before
+// clrand_initialize_prng). source is OpenCL C code defining
+//     T clrand_transform(T x, ulong idx, <params>)
+// where T is the precision of the stream and idx the position of the
+// number in the stream since it was last seeded. params declares extra
+// kernel parameters passed on to clrand_transform (e.g. "float lo, float
+// hi"), and may be NULL. A NULL source removes the transform.
+CLRAND_DLL int clrand_set_transform(clRAND* p, const char* source, const char* params);
+
+// Set the value of the extra kernel parameter at index of the transform,
+// as with clSetKernelArg (a NULL value gives local memory of size bytes)
+CLRAND_DLL int clrand_set_transform_arg(clRAND* p, size_t index, size_t size, const void* value);
+
+// Serve requests larger than the launch limit with a single launch of a
+// kernel looping over the whole destination, which loads and stores the
+// PRNG states once instead of once per launch
+CLRAND_DLL void clrand_set_persistent_kernel(clRAND* p, int enable);
+
+// Sets the upper limit on the number of random numbers generated by one
+// kernel launch. Larger requests are split over several launches.
+CLRAND_DLL int clrand_set_max_launch_count(clRAND* p, size_t num);
+
+// Sets the number of PRNG instances of the stream object (before
+// clrand_ready_stream), independent of the device and work configuration,
+// so the same seed gives the same stream everywhere. Work-items run
+// several instances each when there are more instances than work-items.
+// Zero (the default) runs one instance per work-item.
+CLRAND_DLL int clrand_set_num_generators(clRAND* p, size_t num);
+
+// Sets the upper limit in bytes of device memory used by all temporary buffers
+CLRAND_DLL void clrand_set_tmp_buffer_budget(clRAND* p, size_t bytes);
+
+// Get statistics on the temporary buffers of the stream object
+CLRAND_DLL void clrand_get_stream_stats(clRAND* p, clrandStreamStats* stats);
+
 // Generate random number using the stream object
-CLRAND_DLL cl_int clrand_generate_stream(clRAND* p, int count, cl_mem dst);
+CLRAND_DLL cl_int clrand_generate_stream(clRAND* p, size_t count, cl_mem dst);
+
+// Enqueue random number generation using the stream object without blocking.
+// The work starts after the events in wait_list, and out_event (if not NULL)
+// completes once dst is filled. The caller must release out_event.
+CLRAND_DLL cl_int clrand_generate_stream_async(clRAND* p, size_t count, cl_mem dst, cl_uint num_wait_events, const cl_event* wait_list, cl_event* out_event);
+
+// Generate random numbers using the stream object into host memory.
+// Devices sharing memory with the host write straight into dst, other
+// devices go through a pinned staging buffer.
+CLRAND_DLL cl_int clrand_generate_host(clRAND* p, size_t count, void* dst);
+
+// Generate random numbers using the stream object into n destinations.
+// counts[i] numbers are written to dsts[i] starting at entry offsets[i],
+// with the same results as n consecutive calls to clrand_generate_stream.
+// The stream advances by the whole batch once it is generated, so if
+// scattering it fails, the destinations may hold only part of the batch and
+// the rest of its numbers are skipped.
+CLRAND_DLL cl_int clrand_generate_batch(clRAND* p, size_t n, const cl_mem* dsts, const size_t* offsets, const size_t* counts);
+
+// Allow several host threads to generate from the stream object at once
+// (call before clrand_ready_stream). Each call to clrand_generate_stream
+// then reserves its own range of the stream.
+CLRAND_DLL int clrand_set_concurrent(clRAND* p, int enable);
+
+// Generate random numbers using the stream object in concurrent mode.
+// If position is not NULL, it is set to the position in the stream of
+// the first number written to dst.
+CLRAND_DLL cl_int clrand_generate_stream_concurrent(clRAND* p, size_t count, cl_mem dst, cl_ulong* position);
+
+// Get the OpenCL C source of the device API of the PRNG of the stream
+// object (NULL for xorshift1024). Prepended to the source of user kernels,
+// it declares clrand_state, clrand_load_state(stateBuf, id),
+// clrand_store_state(stateBuf, id, state) and clrand_next_<type>(state)
+// for uint, ulong, float and double.
+CLRAND_DLL const char * clrand_get_device_source(clRAND* p);
+
+// Get the buffer of PRNG states, to pass to user kernels using the device
+// API (after clrand_ready_stream). Waits for kernels already using the
+// states. User kernels must finish before the stream generates again.
+CLRAND_DLL cl_int clrand_get_state_buffer(clRAND* p, cl_mem* state);
+
+// Get the number of PRNGs (states) of the stream object
+CLRAND_DLL size_t clrand_get_num_prngs(clRAND* p);
+
+// Get the number of bytes needed to hold the PRNG states of the stream object
+CLRAND_DLL size_t clrand_get_state_size(clRAND* p);
+
+// Copy the PRNG states of the stream object to host memory. The states are
+// kept on the device otherwise, so this is the only call that reads them back.
+// Taking a checkpoint does not change the numbers generated afterwards: the
+// stream object keeps the numbers it has buffered, and a copy of them with
+// their position in the stream next to the checkpoint.
+CLRAND_DLL cl_int clrand_checkpoint_state(clRAND* p, void* hostPtr);
+
+// Overwrite the PRNG states of the stream object with a saved checkpoint.
+// The buffered numbers are replaced by those of the last checkpoint of the
+// stream object, so the stream replays from the position of that checkpoint.
+// A checkpoint taken by another stream object restores the states only.
+CLRAND_DLL cl_int clrand_restore_state(clRAND* p, const void* hostPtr);
 
 #ifdef __cplusplus
 }
@@ -1,5 +1,175 @@
 #include "clrand.hpp"
 
+#include <chrono>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+// Process-wide caches shared by the stream objects. Programs are keyed by
+// context, device, PRNG, precision, build options and kernel source, so
+// streams built for the same generator compile it once. Each stream still
+// creates its own cl::Kernel objects from the shared program, as kernel
+// arguments are not safe to set from several streams at once
+struct clrandProgramEntry {
+    cl::Program       program;             // Compiled program
+    size_t            refs;                // Number of stream objects using the program
+};
+
+struct clrandQueueEntry {
+    cl::CommandQueue  com_queue;           // Queue for copies and seeding
+    cl::CommandQueue  refill_queue;        // Queue for the generate kernels
+    size_t            refs;                // Number of stream objects using the queues
+};
+
+static std::mutex clrand_cache_mutex;
+static std::map<std::string, clrandProgramEntry> clrand_program_cache;
+static std::map<std::pair<cl_context, cl_device_id>, clrandQueueEntry> clrand_queue_cache;
+
+// Compiled programs are also kept on disk between runs, as binaries in the
+// cache directory. The file name is a hash of a key describing the source,
+// build options, device, driver and platform, and the file starts with the
+// full key so that hash collisions and stale binaries are detected.
+static bool clrand_cache_dir_set = false;
+static std::string clrand_cache_dir;
+static clrandCacheStats clrand_cache_stats = { 0, 0, 0, 0, 0.0, 0.0, 0 };
+
+static std::string clrandGetCacheDir() {
+    if (clrand_cache_dir_set) {
+        return clrand_cache_dir;
+    }
+    const char* env = getenv("CLRAND_CACHE_DIR");
+    return (env != NULL) ? std::string(env) : std::string();
+}
+
+// 64-bit FNV-1a hash, which unlike std::hash is the same in every process
+static cl_ulong clrandHash(const std::string& str) {
+    cl_ulong hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < str.length(); i++) {
+        hash ^= (unsigned char)(str[i]);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+#ifdef CLRAND_SPIRV
+// Kernel sources compiled to SPIR-V when the library was built (make
+// SPIRV=1), keyed by the hash and length of the source. The table is
+// generated by clrand_kernels.
+struct clrandSpirvBlob {
+    cl_ulong             source_hash;      // clrandHash of the kernel source
+    size_t               source_length;    // Length of the kernel source
+    const unsigned char* data;             // SPIR-V module
+    size_t               size;             // Size in bytes of the SPIR-V module
+};
+
+#include "clrand_spirv.inc"
+#endif
+
+static std::string clrandDeviceInfo(cl_device_id device, cl_device_info param) {
+    size_t size = 0;
+    if (clGetDeviceInfo(device, param, 0, NULL, &size) || (size == 0)) {
+        return std::string();
+    }
+    std::vector<char> info(size);
+    clGetDeviceInfo(device, param, size, &info[0], NULL);
+    return std::string(&info[0]);
+}
+
+static std::string clrandPlatformInfo(cl_platform_id platform, cl_platform_info param) {
+    size_t size = 0;
+    if (clGetPlatformInfo(platform, param, 0, NULL, &size) || (size == 0)) {
+        return std::string();
+    }
+    std::vector<char> info(size);
+    clGetPlatformInfo(platform, param, size, &info[0], NULL);
+    return std::string(&info[0]);
+}
+
+// Occupancy targets of the default work configuration on GPUs: work-items
+// resident on a compute unit, and bytes of scratch memory they may use
+// between them when the generate kernel spills
+#define CLRAND_RESIDENT_WORKITEMS 1024
+#define CLRAND_SCRATCH_BYTES 262144
+
+// Destinations served by each launch of the kernel scattering a batch
+#define CLRAND_BATCH_DESTS 8
+
+// Parameter sets in the tables compiled in with clrand_set_instance_params
+// (TINYMT32_NUM_PARAMS and TINYMT64_NUM_PARAMS)
+#define CLRAND_INSTANCE_PARAMS 1024
+
+// Tuned work configurations by device, driver, PRNG and precision. They are
+// also kept in the cache directory, one file per profile starting with its
+// key. The caller must hold clrand_cache_mutex.
+static std::map<std::string, clrandWorkConfig> clrand_work_profiles;
+
+static std::string clrandWorkProfilePath(const std::string& key) {
+    std::string cache_dir = clrandGetCacheDir();
+    if (cache_dir.empty()) {
+        return std::string();
+    }
+    std::ostringstream path;
+    path << cache_dir << "/clrand_tune_" << std::hex << clrandHash(key) << ".txt";
+    return path.str();
+}
+
+static bool clrandLoadWorkProfile(const std::string& key, clrandWorkConfig* config) {
+    std::map<std::string, clrandWorkConfig>::iterator it = clrand_work_profiles.find(key);
+    if (it != clrand_work_profiles.end()) {
+        *config = (*it).second;
+        return true;
+    }
+    std::string path = clrandWorkProfilePath(key);
+    if (path.empty()) {
+        return false;
+    }
+    std::ifstream file(path.c_str());
+    std::string header;
+    std::getline(file, header);
+    if ((!file) || (header != key)) {
+        return false;
+    }
+    file >> config->wkgrp_size >> config->wkgrp_count >> config->buf_mult >> config->seconds;
+    if ((!file) || (config->wkgrp_size == 0) || (config->wkgrp_count == 0) || (config->buf_mult == 0)) {
+        return false;
+    }
+    clrand_work_profiles[key] = *config;
+    return true;
+}
+
+static void clrandStoreWorkProfile(const std::string& key, const clrandWorkConfig& config) {
+    clrand_work_profiles[key] = config;
+    std::string path = clrandWorkProfilePath(key);
+    if (path.empty()) {
+        return;
+    }
+    std::ostringstream tmp_path;
+    tmp_path << path << ".tmp" << std::hex << (std::hash<std::thread::id>()(std::this_thread::get_id()) ^ (size_t)(std::chrono::steady_clock::now().time_since_epoch().count()));
+    std::ofstream file(tmp_path.str().c_str());
+    if (!file) {
+        return;
+    }
+    file << key << "\n" << config.wkgrp_size << " " << config.wkgrp_count << " " << config.buf_mult << " " << config.seconds << "\n";
+    file.close();
+    if ((!file) || std::rename(tmp_path.str().c_str(), path.c_str())) {
+        std::remove(tmp_path.str().c_str());
+    }
+}
+
+// Drops one reference to a program in the shared program cache. The caller
+// must hold clrand_cache_mutex.
+static void clrandReleaseCachedProgram(const std::string& key) {
+    std::map<std::string, clrandProgramEntry>::iterator it = clrand_program_cache.find(key);
+    if (it != clrand_program_cache.end()) {
+        if (--(*it).second.refs == 0) {
+            clrand_program_cache.erase(it);
+        }
+    }
+}
+
 // Main C interface functions
 
 // Main call to create a stream object
@@ -8,80 +178,261 @@ CLRAND_DLL clRAND* clrand_create_stream() {
 }
 
 // Main call to generate stream in the stream object
-CLRAND_DLL cl_int clrand_generate_stream(clRAND* p, int count, cl_mem dst) {
-    if (count < 0) {
-        std::cout << "ERROR: count must be a positive integer!" << std::endl;
-        return -1;
-    }
+CLRAND_DLL cl_int clrand_generate_stream(clRAND* p, size_t count, cl_mem dst) {
     cl_int err;
     if (p->IsInitialized() && p->IsSourceReady() && p->IsProgramReady() && p->IsSeeded() == false) {
         std::cout << "ERROR: stream is not fully ready!" << std::endl;
         return -2;
     }
-    for (; count > 0;) {
-        if ((count == 0) || (dst == NULL)) {
-            break;
+    if ((count == 0) || (dst == NULL)) {
+        return 0;
+    }
+    if (p->IsConcurrent()) {
+        return p->GenerateConcurrent(count, dst, NULL);
+    }
+    cl_event event = NULL;
+    err = p->GenerateStream(count, dst, 0, NULL, &event);
+    if (err) {
+        return err;
+    }
+    err = clWaitForEvents(1, &event);
+    clReleaseEvent(event);
+    if (err) {
+        std::cout << "ERROR: unable to wait for random bit stream to be generated!" << std::endl;
+    }
+    return err;
+}
+
+// Main call to generate stream in the stream object without blocking
+// the host. The generation is enqueued after the events in wait_list,
+// and out_event (if not NULL) is set to an event that completes once
+// dst holds the random numbers. The caller must release out_event.
+CLRAND_DLL cl_int clrand_generate_stream_async(clRAND* p, size_t count, cl_mem dst, cl_uint num_wait_events, const cl_event* wait_list, cl_event* out_event) {
+    if (p->IsInitialized() && p->IsSourceReady() && p->IsProgramReady() && p->IsSeeded() == false) {
+        std::cout << "ERROR: stream is not fully ready!" << std::endl;
+        return -2;
+    }
+    if (p->IsConcurrent()) {
+        std::cout << "ERROR: clrand_generate_stream_async is not supported for streams in concurrent mode!" << std::endl;
+        return CL_INVALID_OPERATION;
+    }
+    if ((num_wait_events > 0) && (wait_list == NULL)) {
+        std::cout << "ERROR: wait_list must not be NULL when num_wait_events is non-zero!" << std::endl;
+        return CL_INVALID_VALUE;
+    }
+    if (dst == NULL) {
+        count = 0;
+    }
+    return p->GenerateStream(count, dst, num_wait_events, wait_list, out_event);
+}
+
+// Main call to generate stream in the stream object into host memory
+CLRAND_DLL cl_int clrand_generate_host(clRAND* p, size_t count, void* dst) {
+    if (p->IsInitialized() && p->IsSourceReady() && p->IsProgramReady() && p->IsSeeded() == false) {
+        std::cout << "ERROR: stream is not fully ready!" << std::endl;
+        return -2;
+    }
+    if (p->IsConcurrent()) {
+        std::cout << "ERROR: clrand_generate_host is not supported for streams in concurrent mode!" << std::endl;
+        return CL_INVALID_OPERATION;
+    }
+    if ((count == 0) || (dst == NULL)) {
+        return 0;
+    }
+    return p->GenerateHost(count, dst);
+}
+
+// Main call to generate stream in the stream object for several
+// destination buffers at once
+CLRAND_DLL cl_int clrand_generate_batch(clRAND* p, size_t n, const cl_mem* dsts, const size_t* offsets, const size_t* counts) {
+    if (p->IsInitialized() && p->IsSourceReady() && p->IsProgramReady() && p->IsSeeded() == false) {
+        std::cout << "ERROR: stream is not fully ready!" << std::endl;
+        return -2;
+    }
+    if (p->IsConcurrent()) {
+        std::cout << "ERROR: clrand_generate_batch is not supported for streams in concurrent mode!" << std::endl;
+        return CL_INVALID_OPERATION;
+    }
+    if (n == 0) {
+        return 0;
+    }
+    if ((dsts == NULL) || (offsets == NULL) || (counts == NULL)) {
+        std::cout << "ERROR: destinations, offsets and counts of batch must not be NULL!" << std::endl;
+        return CL_INVALID_VALUE;
+    }
+    for (size_t i = 0; i < n; i++) {
+        if ((counts[i] > 0) && (dsts[i] == NULL)) {
+            std::cout << "ERROR: destination " << i << " of batch is NULL!" << std::endl;
+            return CL_INVALID_VALUE;
         }
-        if (p->GetNumValidEntries() <= 0) {
-            if (p->GetStateOfStateBuffer() == false) {
-                err = p->CopyStateToDevice();
-                if (err) {
-                    return err;
+    }
+    return p->GenerateBatch(n, dsts, offsets, counts);
+}
+
+// Main call to generate random numbers from a stream object shared by
+// several host threads. Each call reserves its own range of the stream,
+// and position (if not NULL) is set to the start of that range.
+CLRAND_DLL cl_int clrand_generate_stream_concurrent(clRAND* p, size_t count, cl_mem dst, cl_ulong* position) {
+    if (p->IsInitialized() && p->IsSourceReady() && p->IsProgramReady() && p->IsSeeded() == false) {
+        std::cout << "ERROR: stream is not fully ready!" << std::endl;
+        return -2;
+    }
+    if (p->IsConcurrent() == false) {
+        std::cout << "ERROR: stream is not in concurrent mode!" << std::endl;
+        return CL_INVALID_OPERATION;
+    }
+    if (dst == NULL) {
+        count = 0;
+    }
+    return p->GenerateConcurrent(count, dst, position);
+}
+
+// Main call to copy the PRNG states of the stream object to host memory.
+// The states stay resident on the device; this is the only point where
+// they are read back. hostPtr may be NULL to only refresh the host copy
+// kept by the stream object.
+CLRAND_DLL cl_int clrand_checkpoint_state(clRAND* p, void* hostPtr) {
+    return p->CheckpointState(hostPtr);
+}
+
+// Main call to overwrite the PRNG states of the stream object with
+// states previously saved by clrand_checkpoint_state
+CLRAND_DLL cl_int clrand_restore_state(clRAND* p, const void* hostPtr) {
+    return p->RestoreState(hostPtr);
+}
+
+// Number of compiled programs held by the shared program cache
+CLRAND_DLL size_t clrand_get_num_cached_programs() {
+    std::lock_guard<std::mutex> lock(clrand_cache_mutex);
+    return clrand_program_cache.size();
+}
+
+// Set the directory of compiled program binaries
+CLRAND_DLL void clrand_set_cache_dir(const char* path) {
+    std::lock_guard<std::mutex> lock(clrand_cache_mutex);
+    clrand_cache_dir_set = (path != NULL);
+    clrand_cache_dir = (path != NULL) ? std::string(path) : std::string();
+}
+
+// Statistics on the caches of compiled programs
+CLRAND_DLL void clrand_get_cache_stats(clrandCacheStats* stats) {
+    std::lock_guard<std::mutex> lock(clrand_cache_mutex);
+    *stats = clrand_cache_stats;
+}
+
+// Benchmark the work configurations of a PRNG and precision on a device,
+// and keep the fastest as the profile used by later streams
+CLRAND_DLL cl_int clrand_autotune(cl_device_id dev_id, cl_context ctx_id, clrandRngType rng_type, const char* precision, clrandWorkConfig* best) {
+    cl_int err;
+    size_t max_size = 0;
+    cl_uint compute_units = 0;
+    err = clGetDeviceInfo(dev_id, CL_DEVICE_MAX_WORK_GROUP_SIZE, sizeof(max_size), &max_size, NULL);
+    if (err == 0) {
+        err = clGetDeviceInfo(dev_id, CL_DEVICE_MAX_COMPUTE_UNITS, sizeof(compute_units), &compute_units, NULL);
+    }
+    if (err) {
+        std::cout << "ERROR: failed to query device to tune work configuration!" << std::endl;
+        return err;
+    }
+
+    // Each configuration generates count numbers into a device buffer, in
+    // requests served from the temporary buffers and one direct request
+    const size_t count = (size_t)(1) << 22;
+    const size_t num_small = 32;
+    const size_t max_state_bytes = (size_t)(64) << 20;
+    const size_t sizes[] = { 32, 64, 128, 256, 512, 1024 };
+    const size_t groups_per_unit[] = { 1, 2, 4, 8, 16, 32 };
+    const size_t buf_mults[] = { 2, 8, 32 };
+
+    // The probe holds a reference to the program in the shared cache until
+    // the search ends, so the streams of all configurations reuse it
+    // instead of rebuilding it from source
+    clRAND probe;
+    probe.Init(dev_id, ctx_id, rng_type);
+    if (probe.SetPrecision(precision)) {
+        return -1;
+    }
+    probe.BuildSource();
+    err = probe.BuildKernelProgram();
+    if (err) {
+        std::cout << "ERROR: unable to build program to tune work configuration!" << std::endl;
+        return err;
+    }
+    size_t kernel_size = 0;
+    clGetKernelWorkGroupInfo(probe.GetGenerateKernel(), dev_id, CL_KERNEL_WORK_GROUP_SIZE, sizeof(kernel_size), &kernel_size, NULL);
+    size_t elem_size = probe.GetPrecisionSize();
+    cl_mem dst = clCreateBuffer(ctx_id, CL_MEM_READ_WRITE, count * elem_size, NULL, &err);
+    if (err) {
+        std::cout << "ERROR: unable to create buffer to tune work configuration!" << std::endl;
+        return err;
+    }
+    bool local_state = (probe.GetLocalStateSize() > 0);
+    probe.SetStateSize();
+    size_t state_bytes = probe.GetStateStructSize();
+    probe.UpdateRunLength();
+    size_t run_length = probe.GetRunLength();
+    std::string key = probe.GetWorkConfigKey();
+
+    clrandWorkConfig best_config = { 0, 0, 0, 0.0 };
+    for (size_t si = 0; si < sizeof(sizes) / sizeof(sizes[0]); si++) {
+        // xorshift1024 runs work-groups of one warp
+        if ((sizes[si] > max_size) || ((kernel_size > 0) && (sizes[si] > kernel_size)) || (local_state && (sizes[si] != 32))) {
+            continue;
+        }
+        for (size_t gi = 0; gi < sizeof(groups_per_unit) / sizeof(groups_per_unit[0]); gi++) {
+            for (size_t mi = 0; mi < sizeof(buf_mults) / sizeof(buf_mults[0]); mi++) {
+                size_t num_prngs = sizes[si] * groups_per_unit[gi] * compute_units;
+                if ((num_prngs * buf_mults[mi] * run_length * 4 > count) || (num_prngs * state_bytes > max_state_bytes)) {
+                    continue;
                 }
-            }
-            err = p->FillBuffer();
-            if (err) {
-                std::cout << "ERROR: unable to generate random bit stream!" << std::endl;
-                if (p->GetStateOfStateBuffer()) {
-                    err = p->CopyStateToHost(p->GetHostStatePtr());
-                    if (err) {
-                        return err;
-                    }
+                clRAND stream;
+                stream.Init(dev_id, ctx_id, rng_type);
+                stream.SetPrecision(precision);
+                stream.BuildSource();
+                if (stream.BuildKernelProgram()) {
+                    continue;
                 }
-                return err;
-            }
-            p->SetNumValidEntries(p->GetNumBufferEntries());
-            p->SetBufferOffset(0);
-        }
-        size_t dst_offset = 0;
-        if (count <= p->GetNumValidEntries()) {
-	    err = p->CopyBufferEntries(dst, dst_offset, (size_t)(count));
-            if (err) {
-                std::cout << "ERROR: unable to copy random bit stream from buffer to dst!" << std::endl;
-                if (p->GetStateOfStateBuffer()) {
-                    err = p->CopyStateToHost(p->GetHostStatePtr());
-                    if (err) {
-                        return err;
-                    }
+                stream.SetWorkConfig(sizes[si], groups_per_unit[gi] * compute_units, buf_mults[mi]);
+                stream.SetAdaptiveTmpSize(false);
+                if (stream.ReadyGenerator()) {
+                    continue;
                 }
-                return err;
-            }
-            p->SetNumValidEntries(p->GetNumValidEntries() - count);
-            p->SetBufferOffset(count + p->GetBufferOffset());
-            break;
-        } else {
-	    err = p->CopyBufferEntries(dst, dst_offset, p->GetNumValidEntries());
-	    if (err) {
-                if (p->GetStateOfStateBuffer()) {
-                    err = p->CopyStateToHost(p->GetHostStatePtr());
-                    if (err) {
-                        return err;
-                    }
+                // One warm-up request, then the timed ones
+                err = clrand_generate_stream(&stream, count / num_small, dst);
+                std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                for (size_t r = 0; (r < num_small) && (err == 0); r++) {
+                    err = clrand_generate_stream(&stream, count / num_small, dst);
+                }
+                if (err == 0) {
+                    err = clrand_generate_stream(&stream, count, dst);
+                }
+                double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                if (err) {
+                    err = 0;
+                    continue;
+                }
+                if ((best_config.wkgrp_size == 0) || (seconds < best_config.seconds)) {
+                    best_config.wkgrp_size = sizes[si];
+                    best_config.wkgrp_count = groups_per_unit[gi] * compute_units;
+                    best_config.buf_mult = buf_mults[mi];
+                    best_config.seconds = seconds;
                 }
-	        return err;
-	    }
-            count -= p->GetNumValidEntries();
-            dst_offset += p->GetNumValidEntries();
-            p->SetNumValidEntries(0);
+            }
         }
     }
-    if (p->GetStateOfStateBuffer()) {
-        err = p->CopyStateToHost(p->GetHostStatePtr());
-        if (err) {
-            return err;
-        }
+    clReleaseMemObject(dst);
+    if (best_config.wkgrp_size == 0) {
+        std::cout << "ERROR: no work configuration could be run on the device!" << std::endl;
+        return -1;
     }
-    return err;
+    {
+        std::lock_guard<std::mutex> lock(clrand_cache_mutex);
+        clrandStoreWorkProfile(key, best_config);
+    }
+    if (best != NULL) {
+        *best = best_config;
+    }
+    return 0;
 }
 
 // Main call to initialize the stream object
@@ -96,11 +447,71 @@ clRAND::clRAND() {
     device = 0;
     context = 0;
     com_queue = 0;
+    refill_queue = 0;
+    refill_queue_id = NULL;
+    share_queue = false;
+    queue_shared = false;
+    program_key = "";
+    build_options = "";
+    specialized_kernels = false;
+    fixed_kernel.num = 0;
+    fixed_kernel.global_size = 0;
+    fixed_kernel.num_generators = 0;
+    unroll_factor = 4;
+    vector_stores = false;
+    instance_params = false;
+    layout = CLRAND_LAYOUT_AUTO;
+    seed_scheme = CLRAND_SEED_LEGACY;
+    lazy_seeding = false;
+    seed_pending = false;
+    stream_id = 0;
+    seeding_val = 0;
+    seeding_scheme = CLRAND_SEED_LEGACY;
+    seeding_stream_id = 0;
+    persistent_kernel = false;
+    buf_mult = 2;
+    num_generators = 0;
+    work_config.wkgrp_size = 0;
+    work_config.wkgrp_count = 0;
+    work_config.buf_mult = 0;
+    work_config.seconds = 0.0;
+    transform_source = "";
+    transform_params = "";
+    generated_count = 0;
+    checkpoint_count = 0;
+    checkpoint_capacity = 0;
+    checkpoint_tmp_buffer = 0;
+    checkpoint_position = 0;
+    checkpoint_window = 0;
+    run_length = 1;
+    vector_width = 1;
     total_count = 0;
     valid_count = 0;
     seedVal = (ulong)(time(NULL));
     offset = 0;
     local_state_mem = NULL;
+    loaded_state = false;
+    host_state_stale = false;
+    num_tmp_buffers = 2;
+    cur_tmp_buffer = 0;
+    filled_tmp_buffers = 0;
+    adaptive_tmp_size = true;
+    min_count = 0;
+    tmp_budget = 64 << 20;
+    memset(request_histogram, 0, sizeof(request_histogram));
+    request_total = 0;
+    resize_count = 0;
+    fill_count = 0;
+    request_count = 0;
+    last_request_fills = 0;
+    staging_capacity = 0;
+    host_unified = -1;
+    batch_capacity = 0;
+    max_launch_count = (size_t)(1) << 26;
+    concurrent = false;
+    conc_slots = NULL;
+    stream_position = 0;
+    next_fill_window = 0;
     wkgrp_size = 0;
     wkgrp_count = 0;
     init_flag = false;
@@ -112,21 +523,80 @@ clRAND::clRAND() {
 
 // Default destructor
 clRAND::~clRAND() {
+    for (size_t i = 0; i < tmpFillEvents.size(); i++) {
+        if (tmpFillEvents[i] != NULL) {
+            clReleaseEvent(tmpFillEvents[i]);
+        }
+        if (tmpDrainEvents[i] != NULL) {
+            clReleaseEvent(tmpDrainEvents[i]);
+        }
+    }
+    if (conc_slots != NULL) {
+        this->ResetConcurrentSlots();
+        delete [] conc_slots;
+    }
+    if (local_state_mem != NULL) {
+        free(local_state_mem);
+    }
+    this->ReleaseProgram();
+    this->ReleaseQueues();
 }
 
 // Internal function to initialize the stream object
 void clRAND::Init(cl_device_id dev_id, cl_context ctx_id, clrandRngType rng_type_) {
+    this->ReleaseQueues();
     this->device_id = dev_id;
     this->device = device_id;
     this->context_id = ctx_id;
     this->context = context_id;
-    cl_int err;
-    this->com_queue_id = clCreateCommandQueue(context_id, device_id, NULL, &err);
-    if (err) {
-        std::cout << "ERROR: Unable to create command queue!" << std::endl;
-        return;
+    if (share_queue) {
+        // Take the queues shared by the streams on this context and device,
+        // creating them for the first stream
+        std::lock_guard<std::mutex> lock(clrand_cache_mutex);
+        std::pair<cl_context, cl_device_id> key(context_id, device_id);
+        std::map<std::pair<cl_context, cl_device_id>, clrandQueueEntry>::iterator it = clrand_queue_cache.find(key);
+        if (it == clrand_queue_cache.end()) {
+            cl_int err;
+            clrandQueueEntry entry;
+            cl_command_queue queue_id = clCreateCommandQueue(context_id, device_id, 0, &err);
+            if (err) {
+                std::cout << "ERROR: Unable to create shared command queue!" << std::endl;
+                return;
+            }
+            entry.com_queue = queue_id;
+            queue_id = clCreateCommandQueue(context_id, device_id, 0, &err);
+            if (err) {
+                std::cout << "ERROR: Unable to create shared command queue to refill temporary buffers!" << std::endl;
+                return;
+            }
+            entry.refill_queue = queue_id;
+            entry.refs = 0;
+            it = clrand_queue_cache.insert(std::make_pair(key, entry)).first;
+        }
+        (*it).second.refs++;
+        this->com_queue = (*it).second.com_queue;
+        this->com_queue_id = com_queue();
+        this->refill_queue = (*it).second.refill_queue;
+        this->refill_queue_id = refill_queue();
+        this->queue_shared = true;
+    } else {
+        cl_int err;
+        this->com_queue_id = clCreateCommandQueue(context_id, device_id, NULL, &err);
+        if (err) {
+            std::cout << "ERROR: Unable to create command queue!" << std::endl;
+            return;
+        }
+        this->com_queue = com_queue_id;
+
+        // Second queue on which the temporary buffers are refilled, so that
+        // refills overlap with copies out of the other temporary buffers
+        this->refill_queue_id = clCreateCommandQueue(context_id, device_id, 0, &err);
+        if (err) {
+            std::cout << "ERROR: Unable to create command queue to refill temporary buffers!" << std::endl;
+            return;
+        }
+        this->refill_queue = refill_queue_id;
     }
-    this->com_queue = com_queue_id;
     this->SetRNGType(rng_type_);
     this->rng_precision = "uint";
     this->init_flag = true;
@@ -230,192 +700,634 @@ void clRAND::LookupPRNG() {
     }
 }
 
-// Internal function to generate the kernel codes for the PRNGs
-void clRAND::generateBufferKernel(std::string type) {
-    this->source_ready = false;
-    this->program_ready = false;
-    this->generator_ready = false;
-    this->rng_source = std::string((type=="double") ? " #pragma OPENCL EXTENSION cl_khr_fp64 : enable \n" : "");
+// Internal function that returns the OpenCL C source of the PRNG, with
+// its state type and the functions and macros drawing numbers from it
+std::string clRAND::GetPRNGSource() {
     switch(this->rng_type) {
         case CLRAND_GENERATOR_ISAAC :
-            this->rng_source += isaac_prng_kernel;
-            break;
+            return isaac_prng_kernel;
         case CLRAND_GENERATOR_KISS09 :
-            this->rng_source += kiss09_prng_kernel;
-            break;
+            return kiss09_prng_kernel;
         case CLRAND_GENERATOR_KISS99 :
-            this->rng_source += kiss99_prng_kernel;
-            break;
+            return kiss99_prng_kernel;
         case CLRAND_GENERATOR_LCG6432 :
-            this->rng_source += lcg6432_prng_kernel;
-            break;
+            return lcg6432_prng_kernel;
         case CLRAND_GENERATOR_LCG12864 :
-            this->rng_source += lcg12864_prng_kernel;
-            break;
+            return lcg12864_prng_kernel;
         case CLRAND_GENERATOR_LFIB :
-            this->rng_source += lfib_prng_kernel;
-            break;
+            return lfib_prng_kernel;
         case CLRAND_GENERATOR_MRG31K3P :
-            this->rng_source += mrg31k3p_prng_kernel;
-            break;
+            return mrg31k3p_prng_kernel;
         case CLRAND_GENERATOR_MRG63K3A :
-            this->rng_source += mrg63k3a_prng_kernel;
-            break;
+            return mrg63k3a_prng_kernel;
         case CLRAND_GENERATOR_MSWS :
-            this->rng_source += msws_prng_kernel;
-            break;
+            return msws_prng_kernel;
         case CLRAND_GENERATOR_MT19937 :
-            this->rng_source += mt19937_prng_kernel;
-            break;
+            return mt19937_prng_kernel;
         case CLRAND_GENERATOR_MWC64X :
-            this->rng_source += mwc64x_prng_kernel;
-            break;
+            return mwc64x_prng_kernel;
         case CLRAND_GENERATOR_PCG6432 :
-            this->rng_source += pcg6432_prng_kernel;
-            break;
+            return pcg6432_prng_kernel;
         case CLRAND_GENERATOR_PHILOX2X32_10 :
-            this->rng_source += philox2x32_10_prng_kernel;
-            break;
+            return philox2x32_10_prng_kernel;
         case CLRAND_GENERATOR_RAN2 :
-            this->rng_source += ran2_prng_kernel;
-            break;
+            return ran2_prng_kernel;
         case CLRAND_GENERATOR_TINYMT32 :
-            this->rng_source += tinymt32_prng_kernel;
-            break;
+            return tinymt32_prng_kernel;
         case CLRAND_GENERATOR_TINYMT64 :
-            this->rng_source += tinymt64_prng_kernel;
-            break;
+            return tinymt64_prng_kernel;
         case CLRAND_GENERATOR_TYCHE :
-            this->rng_source += tyche_prng_kernel;
-            break;
+            return tyche_prng_kernel;
         case CLRAND_GENERATOR_TYCHE_I :
-            this->rng_source += tyche_i_prng_kernel;
-            break;
+            return tyche_i_prng_kernel;
         case CLRAND_GENERATOR_WELL512 :
-            this->rng_source += well512_prng_kernel;
-            break;
+            return well512_prng_kernel;
         case CLRAND_GENERATOR_XORSHIFT1024 :
-            this->rng_source += xorshift1024_prng_kernel;
-            break;
+            return xorshift1024_prng_kernel;
         case CLRAND_GENERATOR_XORSHIFT6432STAR :
-            this->rng_source += xorshift6432star_prng_kernel;
-            break;
+            return xorshift6432star_prng_kernel;
         default :
             std::cout << "Unknown PRNG. No implementation found!" << std::endl;
-            break;
+            return std::string();
+    }
+}
+
+// Returns the OpenCL C source of the device API of the PRNG, for user
+// kernels drawing numbers inline from the states of the stream object.
+// Returns NULL for PRNGs keeping their states in local memory.
+const char* clRAND::GetDeviceSource() {
+    if (this->GetLocalStateSize() > 0) {
+        std::cout << "ERROR: PRNG shares its states in local memory, and has no device API!" << std::endl;
+        return NULL;
+    }
+    std::string prng_source = this->GetPRNGSource();
+    if (prng_source.empty()) {
+        return NULL;
+    }
+    this->device_source = prng_source + "\n"
+        "// clRAND device API. State id of the stateBuf of the stream may only\n"
+        "// be used by one work-item at a time, for id below the number of PRNGs.\n"
+        "// clrand_next_double needs cl_khr_fp64 to be enabled.\n"
+        "typedef " + this->rng_name + "_state clrand_state;\n"
+        "\n"
+        "clrand_state clrand_load_state(global clrand_state* stateBuf, uint id){\n"
+        "    return stateBuf[id];\n"
+        "}\n"
+        "\n"
+        "void clrand_store_state(global clrand_state* stateBuf, uint id, clrand_state state){\n"
+        "    stateBuf[id] = state;\n"
+        "}\n"
+        "\n"
+        "#define clrand_next_uint(state) " + this->rng_name + "_uint(state)\n"
+        "#define clrand_next_ulong(state) " + this->rng_name + "_ulong(state)\n"
+        "#define clrand_next_float(state) " + this->rng_name + "_float(state)\n"
+        "#define clrand_next_double(state) " + this->rng_name + "_double(state)\n";
+    return this->device_source.c_str();
+}
+
+// Returns the buffer of PRNG states for user kernels using the device API,
+// once the kernels already enqueued on the states have finished. The host
+// copy of the states is treated as stale from then on. User kernels must
+// finish before the stream object generates numbers again.
+cl_int clRAND::GetStateBuffer(cl_mem* state) {
+    if (this->generator_ready != true) {
+        std::cout << "ERROR: temporary buffers in stream object has not been set up!" << std::endl;
+        return -4;
+    }
+    if (this->concurrent) {
+        std::cout << "ERROR: state buffer is not available for streams in concurrent mode!" << std::endl;
+        return CL_INVALID_OPERATION;
+    }
+    cl_int err = this->FinishRefills();
+    if (err == 0) {
+        err = this->ResolvePendingSeed();
+    }
+    if (err) {
+        return err;
     }
+    this->host_state_stale = true;
+    *state = this->stateBuffer_id;
+    return err;
+}
+
+// Internal function to generate the kernel codes for the PRNGs
+void clRAND::generateBufferKernel(std::string type) {
+    this->source_ready = false;
+    this->program_ready = false;
+    this->generator_ready = false;
+    this->rng_source = std::string((type=="double") ? " #pragma OPENCL EXTENSION cl_khr_fp64 : enable \n" : "");
+    // Number of consecutive numbers each work-item writes per round
+    std::string run = std::to_string(this->run_length) + "u";
+    this->rng_source += this->GetPRNGSource();
+    if (this->HasInstanceParams()) {
+        this->rng_source += std::string("\n") + ((this->rng_type == CLRAND_GENERATOR_TINYMT32) ? tinymt32_params_kernel : tinymt64_params_kernel);
+    }
+    if (this->transform_source.empty() == false) {
+        this->rng_source += "\n" + this->transform_source + "\n";
+    }
+
+    // Seed of PRNG instance gid. The legacy scheme keeps the seeds of
+    // earlier releases. SplitMix64 hashes the seed value and stream id into
+    // a key, and the key and instance into the seed, so neighbouring
+    // instances and streams start from unrelated states.
+    this->rng_source += "\n"
+           "ulong clrand_splitmix64(ulong z){\n"
+           "    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9UL;\n"
+           "    z = (z ^ (z >> 27)) * 0x94D049BB133111EBUL;\n"
+           "    return z ^ (z >> 31);\n"
+           "}\n"
+           "\n"
+           "ulong clrand_derive_seed(ulong seedVal, uint gid, uint scheme, ulong stream_id){\n"
+           "    ulong seed;\n"
+           "    if (scheme == " + std::to_string((int)(CLRAND_SEED_SPLITMIX64)) + ") {\n"
+           "        ulong key = clrand_splitmix64(seedVal + 0x9E3779B97F4A7C15UL);\n"
+           "        key = clrand_splitmix64(key ^ (stream_id * 0xD1B54A32D192ED03UL));\n"
+           "        seed = clrand_splitmix64(key + ((ulong)(gid) + 1) * 0x9E3779B97F4A7C15UL);\n"
+           "    } else {\n"
+           "        seed = (ulong)(gid);\n"
+           "        seed <<= 1;\n"
+           "        seed += seedVal;\n"
+           "    }\n"
+           "    if (seed == 0) {\n"
+           "        seed += 1;\n"
+           "    }\n"
+           "    return seed;\n"
+           "}\n";
     switch(this->rng_type) {
         case CLRAND_GENERATOR_XORSHIFT1024 :
+            // The state of xorshift1024 is shared by the 32 workitems of a warp
+            // through local memory. Each workitem keeps its own word of the
+            // state in the global state buffer between kernel launches.
             this->rng_source += "\n"
-                   "kernel void seed_prng_by_value(ulong seedVal, global " + this->rng_name + "_state* state){\n"
-                   "    uint gid=get_global_id(0);\n"
-                   "    ulong seed = (ulong)(gid);\n"
-                   "    seed <<= 1;\n"
-                   "    seed += seedVal;\n"
-                   "    if (seed == 0) {\n"
-                   "        seed += 1;\n"
+                   "int xorshift1024_local_index(){\n"
+                   "    int tid = get_local_id(0);\n"
+                   "    int wid = tid / XORSHIFT1024_WARPSIZE;\n"
+                   "    int lid = tid % XORSHIFT1024_WARPSIZE;\n"
+                   "    return wid * (XORSHIFT1024_WARPSIZE + XORSHIFT1024_WORDSHIFT + 1) + XORSHIFT1024_WORDSHIFT + 1 + lid;\n"
+                   "}\n"
+                   "\n"
+                   "void xorshift1024_load(local " + this->rng_name + "_state* state, global " + this->rng_name + "_state* stateBuf){\n"
+                   "    int tid = get_local_id(0);\n"
+                   "    int lid = tid % XORSHIFT1024_WARPSIZE;\n"
+                   "    int idx = xorshift1024_local_index();\n"
+                   "    int woff = idx - lid;\n"
+                   "    uint mem = (XORSHIFT1024_WARPSIZE + XORSHIFT1024_WORDSHIFT + 1) * (get_local_size(0) / XORSHIFT1024_WARPSIZE) + XORSHIFT1024_WORDSHIFT + 1;\n"
+                   "    if (lid < XORSHIFT1024_WORDSHIFT + 1) {\n"
+                   "        state[woff - XORSHIFT1024_WORDSHIFT - 1 + lid] = 0;\n"
                    "    }\n"
+                   "    if (tid < XORSHIFT1024_WORDSHIFT + 1) {\n"
+                   "        state[mem - 1 - tid] = 0;\n"
+                   "    }\n"
+                   "    state[idx] = stateBuf[get_global_id(0)];\n"
+                   "    barrier(CLK_LOCAL_MEM_FENCE);\n"
+                   "}\n"
+                   "\n"
+                   "kernel void seed_prng_by_value(ulong seedVal, global " + this->rng_name + "_state* stateBuf, uint num_inst, uint scheme, ulong stream_id, local " + this->rng_name + "_state* state){\n"
+                   "    uint gid=get_global_id(0);\n"
+                   "    ulong seed = clrand_derive_seed(seedVal, gid, scheme, stream_id);\n"
                    "\n"
                    "    " + this->rng_name + "_seed(state,seed);\n"
-                   "}";
+                   "    stateBuf[gid] = state[xorshift1024_local_index()];\n"
+                   "}\n"
                    "\n"
-                   "kernel void seed_prng_by_array(global ulong* seedArr, global " + this->rng_name + "_state* state){\n"
+                   "kernel void seed_prng_by_array(global ulong* seedArr, global " + this->rng_name + "_state* stateBuf, uint num_inst, local " + this->rng_name + "_state* state){\n"
                    "    uint gid=get_global_id(0);\n"
                    "    ulong seed = seedArr[gid];\n"
                    "\n"
                    "    " + this->rng_name + "_seed(state,seed);\n"
-                   "}";
+                   "    stateBuf[gid] = state[xorshift1024_local_index()];\n"
+                   "}\n"
                    "\n"
-                   "kernel void generate(uint num, global ulong* seed, global " + type + "* res, global " + this->rng_name + "_state* stateBuf, local " + this->rng_name + "_state* state){\n"
+                   "kernel void generate(uint num, global " + this->rng_name + "_state* stateBuf, global " + type + "* res, ulong res_offset, uint num_inst, uint seed_mode, ulong seedVal, ulong stream_id, local " + this->rng_name + "_state* state" + this->GetTransformParams() + "){\n"
                    "    uint gid=get_global_id(0);\n"
                    "    uint gsize=get_global_size(0);\n"
                    "\n"
-                   "    state = stateBuf;\n"
-                   "    uint num_gsize = ((num - 1) / gsize + 1)*gsize; //next multiple of gsize, larger or equal to N\n"
-                   "    for (int i = gid; i<num_gsize; i += gsize) {\n"
-                   "        " + type + " val = " + this->rng_name + "_" + type + "(state); //all threads within workgroup must call generator, even if result is not needed!\n"
-                   "        if (i<num) {\n"
-                   "            res[i] = val;\n"
+                   "    xorshift1024_load(state, stateBuf);\n"
+                   "    res += res_offset;\n"
+                   "    uint num_gsize = ((num - 1) / (gsize*" + run + ") + 1)*(gsize*" + run + "); //next multiple of gsize runs, larger or equal to N\n"
+                   "    for (uint i = gid*" + run + "; i<num_gsize; i += gsize*" + run + ") {\n"
+                   "        for (uint j = i; j<i+" + run + "; j++) {\n"
+                   "            " + type + " val = " + this->rng_name + "_" + type + "(state); //all threads within workgroup must call generator, even if result is not needed!\n"
+                   "            if (j<num) {\n"
+                   "                res[j] = " + this->GetTransformSource("val", "j") + ";\n"
+                   "            }\n"
                    "        }\n"
                    "    }\n"
+                   "    stateBuf[gid] = state[xorshift1024_local_index()];\n"
                    "}";
                    break;
         default :
+            // Each work-item runs the PRNG instances gid, gid + launch size,
+            // ... below num_inst, so the stream only depends on the number of
+            // instances and not on the launch configuration. The generate
+            // kernels seed the states in registers instead of loading them
+            // when seed_mode is set (the scheme plus one), on the first
+            // launch after a lazy seeding.
             this->rng_source += "\n"
-                   "kernel void seed_prng_by_value(ulong seedVal, global " + this->rng_name + "_state* stateBuf){\n"
-                   "    uint gid=get_global_id(0);\n"
-                   "    ulong seed = (ulong)(gid);\n"
-                   "    seed <<= 1;\n"
-                   "    seed += seedVal;\n"
-                   "    if (seed == 0) {\n"
-                   "        seed += 1;\n"
+                   "kernel void seed_prng_by_value(ulong seedVal, global " + this->rng_name + "_state* stateBuf, uint num_inst, uint scheme, ulong stream_id){\n"
+                   "    for(uint gid=get_global_id(0);gid<num_inst;gid+=get_global_size(0)){\n"
+                   "        ulong seed = clrand_derive_seed(seedVal, gid, scheme, stream_id);\n"
+                   "        " + this->rng_name + "_state state;\n"
+                   "        " + this->GetSeedSource("seed") + "\n"
+                   "        stateBuf[gid] = state;\n"
                    "    }\n"
-                   "    " + this->rng_name + "_state state;\n"
-                   "    " + this->rng_name + "_seed(&state,seed);\n"
-                   "    stateBuf[gid] = state;\n"
                    "}"
                    "\n"
-                   "kernel void seed_prng_by_array(global ulong* seedArr, global " + this->rng_name + "_state* stateBuf){\n"
-                   "    uint gid=get_global_id(0);\n"
-                   "    ulong seed = seedArr[gid];\n"
-                   "    " + this->rng_name + "_state state;\n"
-                   "    " + this->rng_name + "_seed(&state,seed);\n"
-                   "    stateBuf[gid] = state;\n"
+                   "kernel void seed_prng_by_array(global ulong* seedArr, global " + this->rng_name + "_state* stateBuf, uint num_inst){\n"
+                   "    for(uint gid=get_global_id(0);gid<num_inst;gid+=get_global_size(0)){\n"
+                   "        ulong seed = seedArr[gid];\n"
+                   "        " + this->rng_name + "_state state;\n"
+                   "        " + this->GetSeedSource("seed") + "\n"
+                   "        stateBuf[gid] = state;\n"
+                   "    }\n"
                    "}"
                    "\n"
-                   "kernel void generate(uint num, global " + this->rng_name + "_state* stateBuf, global " + type + "* res){\n"
-                   "    uint gid=get_global_id(0);\n"
-                   "    uint gsize=get_global_size(0);\n"
-                   "    " + this->rng_name + "_state state;\n"
-                   "    state = stateBuf[gid];\n"
-                   "    for(uint i=gid;i<num;i+=gsize){\n"
-                   "        res[i]=" + this->rng_name + "_" + type + "(state);\n"
+                   "kernel void generate(uint num, global " + this->rng_name + "_state* stateBuf, global " + type + "* res, ulong res_offset, uint num_inst, uint seed_mode, ulong seedVal, ulong stream_id" + this->GetTransformParams() + "){\n"
+                   "    uint gsize=num_inst;\n"
+                   "    res += res_offset;\n"
+                   "    for(uint gid=get_global_id(0);gid<gsize;gid+=get_global_size(0)){\n"
+                   "        " + this->rng_name + "_state state;\n"
+                   "        if (seed_mode) {\n"
+                   "            " + this->GetSeedSource("clrand_derive_seed(seedVal, gid, seed_mode - 1, stream_id)") + "\n"
+                   "        } else {\n"
+                   "            state = stateBuf[gid];\n"
+                   "        }\n"
+                   + ((this->run_length == 1) ?
+                   "        for(uint i=gid;i<num;i+=gsize){\n"
+                   "            res[i]=" + this->GetTransformSource(this->rng_name + "_" + type + "(state)", "i") + ";\n"
+                   "        }\n"
+                   :
+                   "        for(uint i=gid*" + run + ";i<num;i+=gsize*" + run + "){\n"
+                   "            if(i+" + run + "<=num){\n"
+                   "                global " + type + "* out=res+i;\n"
+                   + this->GetRunStoreSource(type, "                ") +
+                   "            } else {\n"
+                   "                for(uint j=i;j<num;j++){\n"
+                   "                    res[j]=" + this->GetTransformSource(this->rng_name + "_" + type + "(state)", "j") + ";\n"
+                   "                }\n"
+                   "            }\n"
+                   "        }\n") +
+                   "        stateBuf[gid] = state;\n"
                    "    }\n"
-                   "    stateBuf[gid] = state;\n"
-                   "}";
+                   "}\n"
+                   "\n"
+                   "// Generate kernel serving a whole request in one launch. The state is\n"
+                   "// loaded once, and the output is walked in chunks of chunk numbers (a\n"
+                   "// multiple of the runs of all instances) so indexing within a chunk\n"
+                   "// stays 32-bit. num must be a multiple of the runs of all instances.\n"
+                   "kernel void generate_persistent(ulong num, global " + this->rng_name + "_state* stateBuf, global " + type + "* res, ulong res_offset, uint chunk, uint num_inst, uint seed_mode, ulong seedVal, ulong stream_id" + this->GetTransformParams() + "){\n"
+                   "    uint gsize=num_inst;\n"
+                   "    res += res_offset;\n"
+                   "    for(uint gid=get_global_id(0);gid<gsize;gid+=get_global_size(0)){\n"
+                   "        " + this->rng_name + "_state state;\n"
+                   "        if (seed_mode) {\n"
+                   "            " + this->GetSeedSource("clrand_derive_seed(seedVal, gid, seed_mode - 1, stream_id)") + "\n"
+                   "        } else {\n"
+                   "            state = stateBuf[gid];\n"
+                   "        }\n"
+                   "        for(ulong base=0;base<num;base+=chunk){\n"
+                   "            global " + type + "* res_chunk=res+base;\n"
+                   "            uint n=(uint)min(num-base,(ulong)chunk);\n"
+                   "            for(uint i=gid*" + run + ";i<n;i+=gsize*" + run + "){\n"
+                   "                global " + type + "* out=res_chunk+i;\n"
+                   + this->GetRunStoreSource(type, "                ") +
+                   "            }\n"
+                   "        }\n"
+                   "        stateBuf[gid] = state;\n"
+                   "    }\n"
+                   "}\n"
+                   "\n"
+                   "#ifdef CLRAND_FIXED_NUM\n"
+                   "// Generate kernel specialized to one fill size and configuration. Each of\n"
+                   "// the CLRAND_FIXED_GSIZE instances stores CLRAND_FIXED_NUM /\n"
+                   "// CLRAND_FIXED_GSIZE numbers, in the same positions as the generic\n"
+                   "// kernel, without bounds checks.\n"
+                   "__attribute__((reqd_work_group_size(CLRAND_FIXED_LSIZE, 1, 1)))\n"
+                   "kernel void generate_fixed(global " + this->rng_name + "_state* stateBuf, global " + type + "* res, ulong res_offset, uint seed_mode, ulong seedVal, ulong stream_id" + this->GetTransformParams() + "){\n"
+                   "    res += res_offset;\n"
+                   "    for(uint gid=get_global_id(0);gid<CLRAND_FIXED_GSIZE;gid+=get_global_size(0)){\n"
+                   "        " + this->rng_name + "_state state;\n"
+                   "        if (seed_mode) {\n"
+                   "            " + this->GetSeedSource("clrand_derive_seed(seedVal, gid, seed_mode - 1, stream_id)") + "\n"
+                   "        } else {\n"
+                   "            state = stateBuf[gid];\n"
+                   "        }\n"
+                   "        global " + type + "* res_gid=res+gid*" + run + ";\n"
+                   "        for(uint i=0;i<CLRAND_FIXED_NUM/(CLRAND_FIXED_GSIZE*" + run + ");i+=CLRAND_FIXED_UNROLL){\n"
+                   "            for(uint j=0;j<CLRAND_FIXED_UNROLL;j++){\n"
+                   "                global " + type + "* out=res_gid+(i+j)*CLRAND_FIXED_GSIZE*" + run + ";\n"
+                   + this->GetRunStoreSource(type, "                ") +
+                   "            }\n"
+                   "        }\n"
+                   "        stateBuf[gid] = state;\n"
+                   "    }\n"
+                   "}\n"
+                   "#endif";
                    break;
     }
-}
 
-// Internal function to build the kernel source codes
-// for the program of the stream object
-void clRAND::BuildSource() {
-    this->source_ready = false;
-    this->program_ready = false;
-    this->generator_ready = false;
-    this->generateBufferKernel(std::string(rng_precision));
-    this->source_ready = true;
+    // Scatter kernel of batches: destination k receives the numbers of src
+    // from starts[k] up to starts[k+1] (num for the last one) at entry
+    // offsets[k]. Unused destinations have empty ranges.
+    std::string dsts;
+    std::string ranges;
+    for (int k = 0; k < CLRAND_BATCH_DESTS; k++) {
+        std::string idx = std::to_string(k);
+        std::string next = (k + 1 < CLRAND_BATCH_DESTS) ? ("starts.s" + std::to_string(k + 1)) : std::string("num");
+        dsts += ", global " + type + "* dst" + idx;
+        ranges += "    for(ulong i=starts.s" + idx + "+get_global_id(0);i<" + next + ";i+=get_global_size(0)){\n"
+                  "        dst" + idx + "[offsets.s" + idx + "+i-starts.s" + idx + "]=src[i];\n"
+                  "    }\n";
+    }
+    this->rng_source += "\n"
+           "kernel void scatter_batch(global const " + type + "* src, ulong num, ulong8 starts, ulong8 offsets" + dsts + "){\n"
+           + ranges +
+           "}\n";
 }
 
-// Internal function to compile and link the kernel source
-// codes into the program of the stream object
+// Internal function that emits the kernel code writing one run of
+// run_length numbers of the PRNG state to the pointer out. With vector
+// stores, the run is written vector_width numbers at a time with vstoreN.
+// Vector components are assigned one by one, as the evaluation order of
+// a vector literal is unspecified.
+std::string clRAND::GetRunStoreSource(std::string type, std::string indent) {
+    std::string gen = this->rng_name + "_" + type + "(state)";
+    if (this->run_length == 1) {
+        return indent + "out[0]=" + this->GetTransformSource(gen, "out-res") + ";\n";
+    }
+    if (this->vector_width == 1) {
+        return indent + "for(uint k=0;k<" + std::to_string(this->run_length) + "u;k++){\n" +
+               indent + "    out[k]=" + this->GetTransformSource(gen, "out-res+k") + ";\n" +
+               indent + "}\n";
+    }
+    std::string width = std::to_string(this->vector_width);
+    std::string code = indent + "for(uint k=0;k<" + std::to_string(this->run_length) + "u;k+=" + width + "u){\n" +
+                       indent + "    " + type + width + " val;\n";
+    for (size_t k = 0; k < this->vector_width; k++) {
+        code += indent + "    val.s" + std::to_string(k) + "=" + this->GetTransformSource(gen, "out-res+k+" + std::to_string(k)) + ";\n";
+    }
+    code += indent + "    vstore" + width + "(val,0,out+k);\n" +
+            indent + "}\n";
+    return code;
+}
+
+// Internal function that returns the kernel parameters taken by the
+// transform: the position of the first number of the launch in the stream,
+// then the extra parameters of clrand_transform
+std::string clRAND::GetTransformParams() {
+    if (this->transform_source.empty()) {
+        return std::string();
+    }
+    std::string params = ", ulong clrand_pos";
+    if (this->transform_params.empty() == false) {
+        params += ", " + this->transform_params;
+    }
+    return params;
+}
+
+// Internal function that returns the source of the number stored at index
+// (from the start of the output of the launch) with the value given by
+// value, applying the transform if one is set
+std::string clRAND::GetTransformSource(std::string value, std::string index) {
+    if (this->transform_source.empty()) {
+        return value;
+    }
+    std::string call = "clrand_transform(" + value + ",clrand_pos+(ulong)(" + index + ")";
+    for (size_t i = 0; i < this->transform_arg_names.size(); i++) {
+        call += "," + this->transform_arg_names[i];
+    }
+    return call + ")";
+}
+
+// Internal function that picks the number of consecutive numbers each
+// work-item writes per round, and how they are stored, from the options
+// of the stream object. Entry i of the stream is the
+// ((i / (run_length * gsize)) * run_length + i % run_length)-th number of
+// work-item (i / run_length) % gsize.
+void clRAND::UpdateRunLength() {
+    this->run_length = 1;
+    this->vector_width = 1;
+    if (this->vector_stores) {
+        // uint4, float4, ulong2 or double2
+        this->vector_width = (this->GetPrecisionSize() == 4) ? 4 : 2;
+        this->run_length = this->vector_width;
+    }
+    if (this->GetLayout() == CLRAND_LAYOUT_BLOCKED) {
+        // A 64-byte cache line of numbers per round, so no two work-items
+        // write to the same cache line
+        this->run_length = 64 / this->GetPrecisionSize();
+    }
+    if (this->GetLocalStateSize() > 0) {
+        // xorshift1024 keeps its scalar stores, with the same ordering
+        this->vector_width = 1;
+    }
+}
+
+// Returns the layout of the stream, resolving the automatic choice from
+// the type of the device
+clrandLayout clRAND::GetLayout() {
+    if (this->layout != CLRAND_LAYOUT_AUTO) {
+        return this->layout;
+    }
+    if (this->init_flag) {
+        cl_int err;
+        cl_device_type dev_type = this->device.getInfo<CL_DEVICE_TYPE>(&err);
+        if ((err == 0) && (dev_type & CL_DEVICE_TYPE_CPU)) {
+            return CLRAND_LAYOUT_BLOCKED;
+        }
+    }
+    return CLRAND_LAYOUT_INTERLEAVED;
+}
+
+// Sets the layout of the numbers of the work-items in the stream. This
+// changes the order of the stream, and must be set before the kernel
+// source is built.
+int clRAND::SetLayout(clrandLayout layout_) {
+    if (this->source_ready) {
+        std::cout << "ERROR: kernel source of stream object is already built!" << std::endl;
+        return -2;
+    }
+    if ((layout_ != CLRAND_LAYOUT_AUTO) && (layout_ != CLRAND_LAYOUT_INTERLEAVED) && (layout_ != CLRAND_LAYOUT_BLOCKED)) {
+        std::cout << "ERROR: unknown layout of stream!" << std::endl;
+        return -1;
+    }
+    this->layout = layout_;
+    return 0;
+}
+
+// Sets how the seeds of the PRNG instances are derived from the seed
+// value. The scheme is a kernel argument, so it takes effect at the next
+// seeding without rebuilding the program.
+int clRAND::SetSeedScheme(clrandSeedScheme scheme) {
+    if ((scheme != CLRAND_SEED_LEGACY) && (scheme != CLRAND_SEED_SPLITMIX64)) {
+        std::cout << "ERROR: unknown seed scheme!" << std::endl;
+        return -1;
+    }
+    this->seed_scheme = scheme;
+    return 0;
+}
+
+// Sets whether each work-item writes its numbers with vector stores. This
+// changes the order of the stream, and must be set before the kernel
+// source is built.
+int clRAND::SetVectorStores(bool enable) {
+    if (this->source_ready) {
+        std::cout << "ERROR: kernel source of stream object is already built!" << std::endl;
+        return -2;
+    }
+    this->vector_stores = enable;
+    return 0;
+}
+
+// Sets whether PRNGs with parameter sets (tinymt32 and tinymt64) seed
+// each instance with its own set from a table compiled into the program,
+// rather than every instance with the same set. This changes the stream,
+// and must be set before the kernel source is built.
+int clRAND::SetInstanceParams(bool enable) {
+    if (this->source_ready) {
+        std::cout << "ERROR: kernel source of stream object is already built!" << std::endl;
+        return -2;
+    }
+    this->instance_params = enable;
+    return 0;
+}
+
+// Internal function that returns whether the PRNG instances are seeded
+// with their own parameter sets
+bool clRAND::HasInstanceParams() {
+    return this->instance_params && ((this->rng_type == CLRAND_GENERATOR_TINYMT32) || (this->rng_type == CLRAND_GENERATOR_TINYMT64));
+}
+
+// Internal function that emits the kernel code seeding the PRNG instance
+// gid in the variable state from seed
+std::string clRAND::GetSeedSource(std::string seed) {
+    if (this->HasInstanceParams()) {
+        return this->rng_name + "_seed_instance(&state," + seed + ",gid);";
+    }
+    return this->rng_name + "_seed(&state," + seed + ");";
+}
+
+// Sets the transform applied to the numbers in the generate kernels, with
+// its extra kernel parameters. This must be set before the kernel source
+// is built.
+int clRAND::SetTransform(const char* source, const char* params) {
+    if (this->source_ready) {
+        std::cout << "ERROR: kernel source of stream object is already built!" << std::endl;
+        return -2;
+    }
+    std::vector<std::string> names;
+    std::string param_str = (params != NULL) ? std::string(params) : std::string();
+    if ((source != NULL) && (param_str.find_first_not_of(" \t\n") != std::string::npos)) {
+        // The name of each parameter is the last identifier of its declaration
+        std::stringstream decls(param_str);
+        std::string decl;
+        while (std::getline(decls, decl, ',')) {
+            size_t end = decl.find_last_not_of(" \t\n");
+            size_t start = (end == std::string::npos) ? std::string::npos : decl.find_last_not_of("abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_", end);
+            start = (start == std::string::npos) ? 0 : start + 1;
+            if ((end == std::string::npos) || (start > end) || isdigit((unsigned char)(decl[start]))) {
+                std::cout << "ERROR: unable to find the name of transform parameter \"" << decl << "\"!" << std::endl;
+                return -1;
+            }
+            names.push_back(decl.substr(start, end - start + 1));
+        }
+        param_str = param_str.substr(param_str.find_first_not_of(" \t\n"), param_str.find_last_not_of(" \t\n") - param_str.find_first_not_of(" \t\n") + 1);
+    } else {
+        param_str = "";
+    }
+    this->transform_source = (source != NULL) ? std::string(source) : std::string();
+    this->transform_params = param_str;
+    this->transform_arg_names = names;
+    clrandTransformArg unset = { 0, std::vector<unsigned char>(), false };
+    this->transform_args.assign(names.size(), unset);
+    return 0;
+}
+
+// Sets the value of an extra kernel argument of the transform, which is
+// passed to the generate kernels at every launch
+int clRAND::SetTransformArg(size_t index, size_t size, const void* value) {
+    if (index >= this->transform_args.size()) {
+        std::cout << "ERROR: transform has no parameter " << index << "!" << std::endl;
+        return -1;
+    }
+    this->transform_args[index].size = size;
+    if (value != NULL) {
+        this->transform_args[index].value.assign((const unsigned char*)(value), (const unsigned char*)(value) + size);
+    } else {
+        this->transform_args[index].value.clear();
+    }
+    this->transform_args[index].set = true;
+    return 0;
+}
+
+// Internal function that sets the arguments of the transform to a generate
+// kernel, from argument index first on. position is the position in the
+// stream of the first number generated by the launch.
+cl_int clRAND::SetTransformArgs(cl::Kernel& kernel, cl_uint first, cl_ulong position) {
+    if (this->transform_source.empty()) {
+        return 0;
+    }
+    cl_int err = kernel.setArg<cl_ulong>(first, position);
+    if (err) {
+        std::cout << "ERROR: Unable to set stream position argument of transform!" << std::endl;
+        return err;
+    }
+    for (size_t i = 0; i < this->transform_args.size(); i++) {
+        clrandTransformArg& arg = this->transform_args[i];
+        if (arg.set == false) {
+            std::cout << "ERROR: transform parameter " << this->transform_arg_names[i] << " has not been set!" << std::endl;
+            return CL_INVALID_KERNEL_ARGS;
+        }
+        err = clSetKernelArg(kernel(), first + 1 + (cl_uint)(i), arg.size, arg.value.empty() ? NULL : &arg.value[0]);
+        if (err) {
+            std::cout << "ERROR: Unable to set argument " << this->transform_arg_names[i] << " of transform!" << std::endl;
+            return err;
+        }
+    }
+    return err;
+}
+
+// Internal function to build the kernel source codes
+// for the program of the stream object
+void clRAND::BuildSource() {
+    this->source_ready = false;
+    this->program_ready = false;
+    this->generator_ready = false;
+    this->UpdateRunLength();
+    this->generateBufferKernel(std::string(rng_precision));
+    this->source_ready = true;
+}
+
+// Internal function to compile and link the kernel source
+// codes into the program of the stream object
 cl_int clRAND::BuildKernelProgram() {
     this->program_ready = false;
     this->generator_ready = false;
     cl_int err;
     if (init_flag && source_ready) {
-        cl::Program::Sources sources(1, std::make_pair(rng_source.c_str(), rng_source.length()));
-#ifdef DEBUG1
-        std::cout << "Preparing to build program..." << std::endl;
-#endif
-        this->rng_program = cl::Program(context, sources);
-        std::string build_args = "-cl-std=CL1.2 -cl-kernel-arg-info";
-        err = this->rng_program.build(std::vector<cl::Device>({device}), build_args.c_str());
-#ifdef DEBUG1
-        std::cout << "Built program..." << std::endl;
-#endif
+        std::string build_args = this->GetBuildArgs();
+
+        // Release the programs of a previous build before taking the new one
+        this->ReleaseProgram();
+        std::string key;
+        err = this->AcquireProgram(build_args, &(this->rng_program), &key);
         if (err) {
-            std::cout << "ERROR: Unable to build PRNG program!" << std::endl;
             return err;
         }
+        this->program_key = key;
 #ifdef DEBUG1
         std::cout << "Create kernel to seed PRNG..." << std::endl;
 #endif DEBUG1
         this->seed_rng = cl::Kernel(rng_program, "seed_prng_by_value");
+        this->seed_rng_array = cl::Kernel(rng_program, "seed_prng_by_array");
 #ifdef DEBUG1
         std::cout << "Create kernel to generate random bitstream..." << std::endl;
 #endif DEBUG1
         this->generate_bitstream = cl::Kernel(rng_program, "generate");
+        if (this->GetLocalStateSize() == 0) {
+            this->generate_persistent = cl::Kernel(rng_program, "generate_persistent");
+        }
+        this->scatter_batch = cl::Kernel(rng_program, "scatter_batch");
         this->program_ready = true;
         return err;
     }
@@ -423,6 +1335,338 @@ cl_int clRAND::BuildKernelProgram() {
     return -1;
 }
 
+// Internal function that returns the options used to build the programs
+std::string clRAND::GetBuildArgs() {
+    std::string build_args = "-cl-std=CL1.2 -cl-kernel-arg-info";
+    if (this->build_options.empty() == false) {
+        build_args += " " + this->build_options;
+    }
+    return build_args;
+}
+
+// Internal function that returns the generate kernel specialized to fills
+// of num entries with the current launch configuration, or NULL if it is
+// not the kernel built for the current fill size. Kernels are only built
+// when the fill size is set, never on the path of a request.
+cl::Kernel* clRAND::GetFixedKernel(size_t num) {
+    if ((this->fixed_kernel.num != num) || (this->fixed_kernel.kernel() == NULL)) {
+        return NULL;
+    }
+    if ((this->fixed_kernel.global_size != this->GetLaunchSize()) || (this->fixed_kernel.num_generators != this->GetNumberOfRNGs())) {
+        return NULL;
+    }
+    return &(this->fixed_kernel.kernel);
+}
+
+// Internal function that builds the generate kernel specialized to fills
+// of num entries, replacing the one built for the previous fill size.
+// Variants are built from the same source with the sizes defined as
+// macros, so they are shared through the program caches like the generic
+// program.
+void clRAND::BuildFixedKernel(size_t num) {
+    if (this->specialized_kernels == false) {
+        return;
+    }
+    size_t global_size = this->GetLaunchSize();
+    if ((this->fixed_kernel.num == num) && (this->fixed_kernel.global_size == global_size) && (this->fixed_kernel.num_generators == this->GetNumberOfRNGs())) {
+        return;
+    }
+    this->ReleaseFixedKernel();
+    if ((num == 0) || (this->GetLocalStateSize() > 0) || (num % this->GetFillGranularity() != 0)) {
+        return;
+    }
+
+    // The inner loop is unrolled by the largest factor up to unroll_factor
+    // that divides the number of rounds
+    size_t rounds = num / this->GetFillGranularity();
+    size_t unroll = (this->unroll_factor < rounds) ? this->unroll_factor : rounds;
+    while (rounds % unroll != 0) {
+        unroll--;
+    }
+    std::ostringstream build_args;
+    build_args << this->GetBuildArgs()
+               << " -DCLRAND_FIXED_NUM=" << num << "u"
+               << " -DCLRAND_FIXED_GSIZE=" << this->GetNumberOfRNGs() << "u"
+               << " -DCLRAND_FIXED_LSIZE=" << this->wkgrp_size
+               << " -DCLRAND_FIXED_UNROLL=" << unroll << "u";
+    // A failed variant is kept too, so it is not rebuilt until the fill
+    // size changes again
+    this->fixed_kernel.num = num;
+    this->fixed_kernel.global_size = global_size;
+    this->fixed_kernel.num_generators = this->GetNumberOfRNGs();
+    cl::Program program;
+    cl_int err = this->AcquireProgram(build_args.str(), &program, &(this->fixed_kernel.program_key));
+    if (err == 0) {
+        this->fixed_kernel.kernel = cl::Kernel(program, "generate_fixed", &err);
+        if (err) {
+            std::cout << "ERROR: Unable to create specialized kernel to generate bitstream!" << std::endl;
+            this->fixed_kernel.kernel = cl::Kernel();
+        }
+    }
+}
+
+// Internal function that drops the specialized kernel and its reference to
+// its program in the shared program cache
+void clRAND::ReleaseFixedKernel() {
+    if (this->fixed_kernel.program_key.empty() == false) {
+        std::lock_guard<std::mutex> lock(clrand_cache_mutex);
+        clrandReleaseCachedProgram(this->fixed_kernel.program_key);
+    }
+    this->fixed_kernel.kernel = cl::Kernel();
+    this->fixed_kernel.program_key = "";
+    this->fixed_kernel.num = 0;
+    this->fixed_kernel.global_size = 0;
+    this->fixed_kernel.num_generators = 0;
+}
+
+// Sets the number of store rounds unrolled in the specialized kernels
+int clRAND::SetUnrollFactor(size_t unroll) {
+    if (unroll < 1) {
+        std::cout << "ERROR: unroll factor must be at least 1!" << std::endl;
+        return -1;
+    }
+    this->unroll_factor = unroll;
+    return 0;
+}
+
+// Internal function that takes the program built from the kernel source
+// with build_args out of the shared program cache, building it (or loading
+// its binary from the cache directory) on a miss. key is set to the key of
+// the program in the cache, to be released when the stream is done with it.
+cl_int clRAND::AcquireProgram(const std::string& build_args, cl::Program* program, std::string* key) {
+    cl_int err;
+    std::ostringstream cache_key;
+    cache_key << (void*)context_id << ":" << (void*)device_id << ":" << rng_type << ":"
+              << rng_precision << ":" << build_args << ":" << std::hash<std::string>()(rng_source);
+
+    std::lock_guard<std::mutex> lock(clrand_cache_mutex);
+    std::map<std::string, clrandProgramEntry>::iterator it = clrand_program_cache.find(cache_key.str());
+    if (it == clrand_program_cache.end()) {
+        clrandProgramEntry entry;
+        std::string cache_dir = clrandGetCacheDir();
+        std::string binary_key;
+        std::string binary_path;
+        err = -1;
+        if (cache_dir.empty() == false) {
+            binary_key = this->GetBinaryCacheKey(build_args);
+            std::ostringstream path;
+            path << cache_dir << "/clrand_" << std::hex << clrandHash(binary_key) << ".bin";
+            binary_path = path.str();
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            err = this->LoadProgramBinary(binary_path, binary_key, build_args, &entry.program);
+            if (err == 0) {
+                clrand_cache_stats.disk_hits++;
+                clrand_cache_stats.load_seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            } else {
+                clrand_cache_stats.disk_misses++;
+            }
+        }
+        if (err) {
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            err = this->LoadProgramIL(build_args, &entry.program);
+            if (err == 0) {
+                clrand_cache_stats.il_loads++;
+                clrand_cache_stats.load_seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                if (binary_path.empty() == false) {
+                    this->StoreProgramBinary(binary_path, binary_key, entry.program);
+                }
+            }
+        }
+        if (err) {
+            cl::Program::Sources sources(1, std::make_pair(rng_source.c_str(), rng_source.length()));
+#ifdef DEBUG1
+            std::cout << "Preparing to build program..." << std::endl;
+#endif
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            entry.program = cl::Program(context, sources);
+            err = entry.program.build(std::vector<cl::Device>({device}), build_args.c_str());
+#ifdef DEBUG1
+            std::cout << "Built program..." << std::endl;
+#endif
+            if (err) {
+                std::cout << "ERROR: Unable to build PRNG program!" << std::endl;
+                return err;
+            }
+            clrand_cache_stats.source_builds++;
+            clrand_cache_stats.build_seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            if (binary_path.empty() == false) {
+                this->StoreProgramBinary(binary_path, binary_key, entry.program);
+            }
+        }
+        entry.refs = 0;
+        it = clrand_program_cache.insert(std::make_pair(cache_key.str(), entry)).first;
+    } else {
+        clrand_cache_stats.memory_hits++;
+        err = CL_SUCCESS;
+    }
+    (*it).second.refs++;
+    *program = (*it).second.program;
+    *key = cache_key.str();
+    return err;
+}
+
+// Internal function that describes everything the compiled program depends
+// on: kernel source, build options, device, driver and platform
+std::string clRAND::GetBinaryCacheKey(const std::string& build_args) {
+    cl_platform_id platform = NULL;
+    clGetDeviceInfo(this->device_id, CL_DEVICE_PLATFORM, sizeof(platform), &platform, NULL);
+    std::ostringstream key;
+    key << "clrand-binary-1"
+        << "|" << clrandPlatformInfo(platform, CL_PLATFORM_NAME)
+        << "|" << clrandPlatformInfo(platform, CL_PLATFORM_VERSION)
+        << "|" << clrandDeviceInfo(this->device_id, CL_DEVICE_NAME)
+        << "|" << clrandDeviceInfo(this->device_id, CL_DEVICE_VERSION)
+        << "|" << clrandDeviceInfo(this->device_id, CL_DRIVER_VERSION)
+        << "|" << build_args
+        << "|" << std::hex << clrandHash(this->rng_source) << ":" << std::dec << this->rng_source.length();
+    std::string str = key.str();
+    for (size_t i = 0; i < str.length(); i++) {
+        if (str[i] == '\n') {
+            str[i] = ' ';
+        }
+    }
+    return str;
+}
+
+// Internal function that loads the program from a binary in the cache
+// directory. Fails if the file is missing, was written for a different
+// key, or the driver rejects the binary.
+cl_int clRAND::LoadProgramBinary(const std::string& path, const std::string& key, const std::string& build_args, cl::Program* program) {
+    std::ifstream file(path.c_str(), std::ios::in | std::ios::binary);
+    if (!file) {
+        return -1;
+    }
+    std::string header;
+    std::getline(file, header);
+    if (header != key) {
+        return -1;
+    }
+    std::string binary((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (binary.empty()) {
+        return -1;
+    }
+    const unsigned char* binary_ptr = (const unsigned char*)(binary.data());
+    size_t binary_size = binary.size();
+    cl_int binary_status;
+    cl_int err;
+    cl_program program_id = clCreateProgramWithBinary(this->context_id, 1, &(this->device_id), &binary_size, &binary_ptr, &binary_status, &err);
+    if (err || binary_status) {
+        if (program_id != NULL) {
+            clReleaseProgram(program_id);
+        }
+        return (err) ? err : binary_status;
+    }
+    err = clBuildProgram(program_id, 1, &(this->device_id), build_args.c_str(), NULL, NULL);
+    if (err) {
+        clReleaseProgram(program_id);
+        return err;
+    }
+    *program = cl::Program(program_id);
+    return err;
+}
+
+// Internal function that creates the program from the SPIR-V the kernel
+// source was compiled to when the library was built. Fails if the library
+// holds no SPIR-V for this source and build options, or the device does
+// not take it, in which case the program is built from source.
+cl_int clRAND::LoadProgramIL(const std::string& build_args, cl::Program* program) {
+#if defined(CLRAND_SPIRV) && defined(CL_VERSION_2_1)
+    // The SPIR-V was compiled without macros, so it does not hold the
+    // specialized kernels
+    if (build_args.find("-D") != std::string::npos) {
+        return -1;
+    }
+    if (clrandDeviceInfo(this->device_id, CL_DEVICE_IL_VERSION).find("SPIR-V") == std::string::npos) {
+        return -1;
+    }
+    cl_uint address_bits = 0;
+    clGetDeviceInfo(this->device_id, CL_DEVICE_ADDRESS_BITS, sizeof(address_bits), &address_bits, NULL);
+    if (address_bits != 64) {
+        return -1;
+    }
+    cl_ulong source_hash = clrandHash(this->rng_source);
+    for (size_t i = 0; i < sizeof(clrand_spirv_blobs) / sizeof(clrand_spirv_blobs[0]); i++) {
+        if ((clrand_spirv_blobs[i].source_hash != source_hash) || (clrand_spirv_blobs[i].source_length != this->rng_source.length())) {
+            continue;
+        }
+        cl_int err;
+        cl_program program_id = clCreateProgramWithIL(this->context_id, clrand_spirv_blobs[i].data, clrand_spirv_blobs[i].size, &err);
+        if (err) {
+            return err;
+        }
+        err = clBuildProgram(program_id, 1, &(this->device_id), build_args.c_str(), NULL, NULL);
+        if (err) {
+            clReleaseProgram(program_id);
+            return err;
+        }
+        *program = cl::Program(program_id);
+        return err;
+    }
+#else
+    (void)build_args;
+    (void)program;
+#endif
+    return -1;
+}
+
+// Internal function that writes the binary of a program built from source
+// to the cache directory. The file is written under a temporary name and
+// renamed, so concurrent processes never read a partial binary. Failures
+// only mean the next run builds from source again.
+void clRAND::StoreProgramBinary(const std::string& path, const std::string& key, const cl::Program& program) {
+    size_t binary_size = 0;
+    cl_int err = clGetProgramInfo(program(), CL_PROGRAM_BINARY_SIZES, sizeof(binary_size), &binary_size, NULL);
+    if (err || (binary_size == 0)) {
+        return;
+    }
+    std::vector<unsigned char> binary(binary_size);
+    unsigned char* binary_ptr = &binary[0];
+    err = clGetProgramInfo(program(), CL_PROGRAM_BINARIES, sizeof(binary_ptr), &binary_ptr, NULL);
+    if (err) {
+        return;
+    }
+    std::ostringstream tmp_path;
+    tmp_path << path << ".tmp" << std::hex << (std::hash<std::thread::id>()(std::this_thread::get_id()) ^ (size_t)(std::chrono::steady_clock::now().time_since_epoch().count()));
+    std::ofstream file(tmp_path.str().c_str(), std::ios::out | std::ios::binary);
+    if (!file) {
+        return;
+    }
+    file << key << "\n";
+    file.write((const char*)(binary_ptr), binary_size);
+    file.close();
+    if ((!file) || std::rename(tmp_path.str().c_str(), path.c_str())) {
+        std::remove(tmp_path.str().c_str());
+    }
+}
+
+// Internal function to drop the references of the stream object to its
+// programs in the shared program cache
+void clRAND::ReleaseProgram() {
+    this->ReleaseFixedKernel();
+    if (program_key.empty() == false) {
+        std::lock_guard<std::mutex> lock(clrand_cache_mutex);
+        clrandReleaseCachedProgram(program_key);
+    }
+    this->program_key = "";
+}
+
+// Internal function to drop the reference of the stream object to the
+// shared command queues
+void clRAND::ReleaseQueues() {
+    if (!queue_shared) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(clrand_cache_mutex);
+    std::pair<cl_context, cl_device_id> key(context_id, device_id);
+    std::map<std::pair<cl_context, cl_device_id>, clrandQueueEntry>::iterator it = clrand_queue_cache.find(key);
+    if (it != clrand_queue_cache.end()) {
+        if (--(*it).second.refs == 0) {
+            clrand_queue_cache.erase(it);
+        }
+    }
+    this->queue_shared = false;
+}
+
 // Internal function that is the second phase of the initialization step.
 // The number of workitems per workgroup supported by the device is
 // discovered. The buffers of the PRNG are created to support the number
@@ -438,8 +1682,8 @@ cl_int clRAND::ReadyGenerator() {
     }
 
     // Initialize the counters that tracks available random number generators
-    size_t numPRNGs = (size_t)(this->wkgrp_count * this->wkgrp_size);
-    size_t bufMult = 2;
+    size_t numPRNGs = this->GetNumberOfRNGs();
+    size_t bufMult = this->buf_mult;
 
     err = this->SetupStreamBuffers(bufMult, numPRNGs);
 
@@ -453,19 +1697,25 @@ cl_int clRAND::ReadyGenerator() {
         return err;
     }
 
-    // Generate a set of random numbers to fill the temporary buffer
-    err = this->FillBuffer();
+    // Generate a set of random numbers to fill the temporary buffers.
+    // This also initializes the counters that track the number of valid
+    // random numbers in the temporary buffers. With lazy seeding the
+    // buffers are left empty, and the first request fills them.
+    if (this->lazy_seeding) {
+        return err;
+    }
+    if (this->concurrent) {
+        std::lock_guard<std::mutex> lock(this->refill_mutex);
+        err = this->RefillConcurrentSlots();
+    } else {
+        err = this->RefillTmpBuffers();
+    }
     if (err) {
         std::cout << "ERROR: failed to fill temporary buffer while readying PRNG" << std::endl;
         this->generator_ready = false;
         return err;
     }
 
-    // Initialize counters that track number of valid random numbers
-    // in the temporary buffer
-    this->offset = 0;
-    this->valid_count = bufMult * numPRNGs;
-
     return err;
 }
 
@@ -483,19 +1733,217 @@ cl_int clRAND::SetupWorkConfigurations() {
         return err;
     }
 
+    cl_uint max_size = this->wkgrp_size;
+    cl_uint compute_units = this->wkgrp_count;
+    std::ostringstream report;
+    std::ostringstream rationale;
+
     // Upper limit for number of workitems per workgroup is set at 256...
     if (this->wkgrp_size > 256) {
         this->wkgrp_size = 256;
     }
 
+    // ...and lowered to what the generate kernel can run. On GPUs the
+    // work-groups are also sized from the preferred multiple and local
+    // memory of the kernel, and from whether it spills, so that as many
+    // work-items as possible are resident on each compute unit. These
+    // queries depend on the driver, and without a set number of generators
+    // the launch shape is the number of PRNGs, so such streams keep one
+    // work-group per compute unit like CPUs do.
+    if (this->program_ready) {
+        size_t kernel_size = 0;
+        size_t multiple = 1;
+        cl_ulong private_mem = 0;
+        cl_ulong local_mem = 0;
+        cl_ulong device_local_mem = 0;
+        cl_device_type dev_type = 0;
+        clGetKernelWorkGroupInfo(this->generate_bitstream(), this->device_id, CL_KERNEL_WORK_GROUP_SIZE, sizeof(kernel_size), &kernel_size, NULL);
+        clGetKernelWorkGroupInfo(this->generate_bitstream(), this->device_id, CL_KERNEL_PREFERRED_WORK_GROUP_SIZE_MULTIPLE, sizeof(multiple), &multiple, NULL);
+        clGetKernelWorkGroupInfo(this->generate_bitstream(), this->device_id, CL_KERNEL_PRIVATE_MEM_SIZE, sizeof(private_mem), &private_mem, NULL);
+        clGetKernelWorkGroupInfo(this->generate_bitstream(), this->device_id, CL_KERNEL_LOCAL_MEM_SIZE, sizeof(local_mem), &local_mem, NULL);
+        clGetDeviceInfo(this->device_id, CL_DEVICE_LOCAL_MEM_SIZE, sizeof(device_local_mem), &device_local_mem, NULL);
+        clGetDeviceInfo(this->device_id, CL_DEVICE_TYPE, sizeof(dev_type), &dev_type, NULL);
+        if (multiple == 0) {
+            multiple = 1;
+        }
+        report << "kernel limit " << kernel_size << " work-items, multiple of " << multiple
+               << ", " << private_mem << " bytes of private and " << local_mem << " bytes of local memory";
+        if ((kernel_size > 0) && (kernel_size < max_size)) {
+            max_size = (cl_uint)(kernel_size);
+        }
+        if (this->wkgrp_size > max_size) {
+            this->wkgrp_size = max_size;
+        }
+        if ((dev_type & CL_DEVICE_TYPE_GPU) && (this->num_generators > 0)) {
+            // Work-items resident on a compute unit. GPU drivers report as
+            // private memory what the kernel keeps outside of registers
+            // (spills and scratch arrays), not its register use, which is
+            // not queryable. A kernel that spills has its residency limited
+            // by the scratch memory it then uses
+            size_t resident = CLRAND_RESIDENT_WORKITEMS;
+            if ((private_mem > 0) && (CLRAND_SCRATCH_BYTES / private_mem < resident)) {
+                resident = (size_t)(CLRAND_SCRATCH_BYTES / private_mem);
+                rationale << "; kernel spills, scratch memory limits residency to " << resident << " work-items per compute unit";
+            }
+            size_t size = (this->wkgrp_size < resident) ? this->wkgrp_size : resident;
+            if (size >= multiple) {
+                size -= size % multiple;
+            } else {
+                size = (multiple <= max_size) ? multiple : max_size;
+            }
+            if (std::string(this->rng_name) == "xorshift1024") {
+                size = 32;
+            }
+            this->wkgrp_size = (cl_uint)(size);
+
+            // Work-groups per compute unit, limited by local memory
+            size_t groups = (resident > size) ? (resident / size) : 1;
+            cl_ulong group_local = local_mem + this->GetLocalStateSize();
+            if ((group_local > 0) && (device_local_mem > 0) && ((size_t)(device_local_mem / group_local) < groups)) {
+                groups = (size_t)(device_local_mem / group_local);
+                if (groups < 1) {
+                    groups = 1;
+                }
+                rationale << "; local memory limits residency to " << groups << " work-groups per compute unit";
+            }
+            this->wkgrp_count = (cl_uint)(groups * compute_units);
+        }
+    }
+    this->buf_mult = 2;
+
+    // The tuned profile of the device, PRNG, precision and kernel options
+    // replaces the defaults, and the configuration set on the stream
+    // replaces both. Without a set number of generators, the launch shape
+    // is the number of PRNGs and so part of the stream, and a profile
+    // found in the cache directory must not change the numbers of a seed.
+    // Only the fill size of the profile, which leaves the stream as it is,
+    // is used then.
+    clrandWorkConfig profile;
+    bool tuned;
+    {
+        std::lock_guard<std::mutex> lock(clrand_cache_mutex);
+        tuned = clrandLoadWorkProfile(this->GetWorkConfigKey(), &profile);
+    }
+    if (tuned) {
+        if (this->num_generators > 0) {
+            this->wkgrp_size = (cl_uint)(profile.wkgrp_size);
+            this->wkgrp_count = (cl_uint)(profile.wkgrp_count);
+        }
+        this->buf_mult = profile.buf_mult;
+    }
+    if (this->work_config.wkgrp_size > 0) {
+        this->wkgrp_size = (cl_uint)(this->work_config.wkgrp_size);
+    }
+    if (this->work_config.wkgrp_count > 0) {
+        this->wkgrp_count = (cl_uint)(this->work_config.wkgrp_count);
+    }
+    if (this->work_config.buf_mult > 0) {
+        this->buf_mult = this->work_config.buf_mult;
+    }
+
     // Upper limit for number of workitems per workgroup is lowered if
     // the PRNG is based on xorshift1024
     if (std::string(this->rng_name) == "xorshift1024") {
         this->wkgrp_size = 32;
     }
+    if (this->wkgrp_size > max_size) {
+        std::cout << "ERROR: work-groups of " << this->wkgrp_size << " work-items are too large for the device!" << std::endl;
+        return -1;
+    }
+
+    // The warps of xorshift1024 share their state through local memory,
+    // so each work-item runs exactly one of its PRNG instances
+    if ((this->num_generators > 0) && (std::string(this->rng_name) == "xorshift1024")) {
+        if (this->num_generators % this->wkgrp_size != 0) {
+            std::cout << "ERROR: number of xorshift1024 generators must be a multiple of " << this->wkgrp_size << "!" << std::endl;
+            return -1;
+        }
+        this->wkgrp_count = (cl_uint)(this->num_generators / this->wkgrp_size);
+    }
+
+    // With instance parameter sets, each PRNG instance runs a recursion of
+    // its own, so there may not be more instances than sets
+    if (this->HasInstanceParams() && (this->GetNumberOfRNGs() > CLRAND_INSTANCE_PARAMS)) {
+        std::cout << "ERROR: " << this->GetNumberOfRNGs() << " PRNG instances, but only " << CLRAND_INSTANCE_PARAMS
+                  << " instance parameter sets (see clrand_set_num_generators)!" << std::endl;
+        return -1;
+    }
+    std::ostringstream config;
+    config << this->wkgrp_count << " work-groups of " << this->wkgrp_size << " work-items, "
+           << this->buf_mult << " entries per work-item per fill";
+    if (this->num_generators > 0) {
+        config << ", " << this->num_generators << " generators";
+    }
+    if (this->work_config.wkgrp_size || this->work_config.wkgrp_count || this->work_config.buf_mult) {
+        config << " (set on the stream)";
+    } else if (tuned && (this->num_generators > 0)) {
+        config << " (tuned profile)";
+    } else if (tuned) {
+        config << " (fill size of tuned profile)";
+    }
+    // The residency rationale only explains a launch shape chosen here,
+    // not one taken from the profile or set on the stream
+    bool shape_set = (tuned && (this->num_generators > 0)) || (this->work_config.wkgrp_size > 0) || (this->work_config.wkgrp_count > 0);
+    if (shape_set == false) {
+        report << rationale.str();
+    }
+    if (report.str().empty() == false) {
+        config << "; " << report.str();
+    }
+    this->work_config_report = config.str();
+#ifdef DEBUG1
+    std::cout << "Work configuration: " << this->work_config_report << std::endl;
+#endif
     return err;
 }
 
+// Returns the work configuration chosen for the stream object, with a
+// description of how it was chosen
+const char* clRAND::GetWorkConfig(clrandWorkConfig* config) {
+    if (config != NULL) {
+        config->wkgrp_size = this->wkgrp_size;
+        config->wkgrp_count = this->wkgrp_count;
+        config->buf_mult = this->buf_mult;
+        config->seconds = 0.0;
+    }
+    return this->work_config_report.c_str();
+}
+
+// Sets the work configuration of the stream object. Zero fields keep the
+// tuned profile or the default configuration of the device.
+void clRAND::SetWorkConfig(size_t wkgrp_size_, size_t wkgrp_count_, size_t buf_mult_) {
+    this->work_config.wkgrp_size = wkgrp_size_;
+    this->work_config.wkgrp_count = wkgrp_count_;
+    this->work_config.buf_mult = buf_mult_;
+}
+
+// Internal function that describes what the tuned work configuration
+// depends on: device, driver, platform, PRNG, precision and the options
+// changing the generate kernels (layout, vector stores, persistent kernel
+// and transform)
+std::string clRAND::GetWorkConfigKey() {
+    cl_platform_id platform = NULL;
+    clGetDeviceInfo(this->device_id, CL_DEVICE_PLATFORM, sizeof(platform), &platform, NULL);
+    std::ostringstream key;
+    key << "clrand-tune-2"
+        << "|" << clrandPlatformInfo(platform, CL_PLATFORM_NAME)
+        << "|" << clrandPlatformInfo(platform, CL_PLATFORM_VERSION)
+        << "|" << clrandDeviceInfo(this->device_id, CL_DEVICE_NAME)
+        << "|" << clrandDeviceInfo(this->device_id, CL_DEVICE_VERSION)
+        << "|" << clrandDeviceInfo(this->device_id, CL_DRIVER_VERSION)
+        << "|" << this->rng_name << "|" << this->rng_precision
+        << "|" << (int)(this->GetLayout()) << "|" << (this->vector_stores ? 1 : 0)
+        << "|" << (this->persistent_kernel ? 1 : 0)
+        << "|" << ((this->transform_source.empty() && this->transform_params.empty()) ? (cl_ulong)(0) : clrandHash(this->transform_source + "|" + this->transform_params));
+    std::string str = key.str();
+    for (size_t i = 0; i < str.length(); i++) {
+        if (str[i] == '\n') {
+            str[i] = ' ';
+        }
+    }
+    return str;
+}
+
 cl_int clRAND::SetupStreamBuffers(size_t bufMult, size_t numPRNGs) {
     cl_int err;
     // Determine the number of bytes for each random number generated
@@ -522,15 +1970,74 @@ cl_int clRAND::SetupStreamBuffers(size_t bufMult, size_t numPRNGs) {
     }
     this->stateBuffer = stateBuffer_id;
 
-    // Create the temporary buffer in which random numbers are generated.
-    // These numbers will be copied to the desired destination when required.
-    this->total_count = bufMult * numPRNGs;
-    this->tmpOutputBuffer_id = clCreateBuffer(this->context_id, CL_MEM_READ_WRITE, this->total_count * typeSize, NULL, &err);
-    if (err) {
-        std::cout << "ERROR: Unable to create temporary buffer or PRNG!" << std::endl;
-        return err;
+    // Host side mirror of the PRNG states. It is only brought up to date
+    // when the states are explicitly checkpointed.
+    if (this->local_state_mem != NULL) {
+        free(this->local_state_mem);
+    }
+    this->local_state_mem = malloc(stateBufSize);
+    if (this->local_state_mem == NULL) {
+        std::cout << "ERROR: Unable to allocate host memory for PRNG states!" << std::endl;
+        return CL_OUT_OF_HOST_MEMORY;
+    }
+    this->loaded_state = false;
+    this->host_state_stale = false;
+
+    // Create the ring of temporary buffers in which random numbers are
+    // generated. These numbers will be copied to the desired destination
+    // when required.
+    err = this->FinishRefills();
+    if (err) {
+        return err;
+    }
+    for (size_t i = 0; i < this->tmpFillEvents.size(); i++) {
+        if (this->tmpFillEvents[i] != NULL) {
+            clReleaseEvent(this->tmpFillEvents[i]);
+        }
+        if (this->tmpDrainEvents[i] != NULL) {
+            clReleaseEvent(this->tmpDrainEvents[i]);
+        }
+    }
+    this->total_count = bufMult * numPRNGs * this->run_length;
+    this->tmpOutputBuffers.clear();
+    for (size_t i = 0; i < this->num_tmp_buffers; i++) {
+        cl_mem tmpOutputBuffer_id = clCreateBuffer(this->context_id, CL_MEM_READ_WRITE, this->total_count * typeSize, NULL, &err);
+        if (err) {
+            std::cout << "ERROR: Unable to create temporary buffer or PRNG!" << std::endl;
+            return err;
+        }
+        this->tmpOutputBuffers.push_back(cl::Buffer(tmpOutputBuffer_id));
+    }
+    this->tmpFillEvents.assign(this->num_tmp_buffers, (cl_event)(NULL));
+    this->tmpDrainEvents.assign(this->num_tmp_buffers, (cl_event)(NULL));
+    this->tmpBufferCounts.assign(this->num_tmp_buffers, this->total_count);
+    this->tmpBufferCapacity.assign(this->num_tmp_buffers, this->total_count);
+    this->min_count = this->total_count;
+    this->BuildFixedKernel(this->total_count);
+    this->cur_tmp_buffer = 0;
+    this->filled_tmp_buffers = 0;
+    this->valid_count = 0;
+    this->offset = 0;
+    this->checkpoint_segments.clear();
+    this->checkpoint_capacity = 0;
+
+    // In concurrent mode the temporary buffers are tracked as windows of
+    // the stream instead of as a ring
+    if (this->conc_slots != NULL) {
+        this->ResetConcurrentSlots();
+        delete [] this->conc_slots;
+        this->conc_slots = NULL;
+    }
+    if (this->concurrent) {
+        this->conc_slots = new clrandConcurrentSlot[this->num_tmp_buffers];
+        for (size_t i = 0; i < this->num_tmp_buffers; i++) {
+            this->conc_slots[i].window = 0;
+            this->conc_slots[i].consumed = 0;
+            this->conc_slots[i].fill_event = NULL;
+        }
+        this->stream_position = 0;
+        this->next_fill_window = 0;
     }
-    this->tmpOutputBuffer = tmpOutputBuffer_id;
     return err;
 }
 
@@ -611,48 +2118,736 @@ void clRAND::SetStateSize() {
 // Sets the current offset of the temporary buffer store
 // Entries preceding the offset are invalid
 void clRAND::SetBufferOffset(size_t ptr) {
-    if ((std::string)(this->rng_precision) == "double") {
-        this->offset = ptr * 8;
-    } else {
-        this->offset = ptr * 4;
-    }
+    this->offset = ptr * this->GetPrecisionSize();
 }
 
 // Returns the current offset of the temporary buffer
 size_t clRAND::GetBufferOffset() {
-    if ((std::string)(this->rng_precision) == "double") {
-        return (this->offset / 8);
-    }
-    return (this->offset / 4);
+    return (this->offset / this->GetPrecisionSize());
 }
 
 // Function to copy random numbers from temporary buffer to desired destination
 cl_int clRAND::CopyBufferEntries(cl_mem dst, size_t dst_offset, size_t count) {
+    cl_event eventFlag;
+    cl_int err = this->EnqueueCopyBufferEntries(dst, dst_offset, count, 0, NULL, &eventFlag);
+    if (err) {
+        return err;
+    }
+
+    // Wait for copy in device side to complete before returning
+    err = clWaitForEvents(1, &eventFlag);
+    clReleaseEvent(eventFlag);
+    if (err) {
+        std::cout << "ERROR: unable to wait for copy buffer to complete in CopyBufferEntries!" << std::endl;
+        return err;
+    }
+    return err;
+}
+
+// Function to enqueue a copy of random numbers from temporary buffer to
+// desired destination. The copy starts after the events in wait_list and
+// does not block the host.
+cl_int clRAND::EnqueueCopyBufferEntries(cl_mem dst, size_t dst_offset, size_t count, cl_uint num_wait_events, const cl_event* wait_list, cl_event* event) {
     size_t numBytes = 4;
     if (((std::string)(this->rng_precision) == "double") || ((std::string)(this->rng_precision) == "ulong")) {
         numBytes = 8;
     }
 
+    // The copy must also wait for the last refill of the temporary buffer,
+    // which runs on the refill queue
+    std::vector<cl_event> events(wait_list, wait_list + num_wait_events);
+    if (this->tmpFillEvents[this->cur_tmp_buffer] != NULL) {
+        events.push_back(this->tmpFillEvents[this->cur_tmp_buffer]);
+    }
+
     // Copy buffer data in device
-    cl_event eventFlag;
-    cl_int err = clEnqueueCopyBuffer(this->com_queue_id, this->tmpOutputBuffer_id, dst, this->offset, dst_offset * numBytes, count * numBytes, 0, NULL, &eventFlag);
+    cl_event copy_event;
+    cl_int err = clEnqueueCopyBuffer(this->com_queue_id, this->tmpOutputBuffers[this->cur_tmp_buffer](), dst, this->offset, dst_offset * numBytes, count * numBytes, (cl_uint)(events.size()), events.empty() ? NULL : &events[0], &copy_event);
     if (err) {
         std::cout << "ERROR: unable to copy buffer entries in CopyBufferEntries!" << std::endl;
         return err;
     }
 
-    // Wait for copy in device side to complete before returning
-    err = clWaitForEvents(1, &eventFlag);
+    // The next refill of the temporary buffer must wait for this copy
+    if (this->tmpDrainEvents[this->cur_tmp_buffer] != NULL) {
+        clReleaseEvent(this->tmpDrainEvents[this->cur_tmp_buffer]);
+    }
+    this->tmpDrainEvents[this->cur_tmp_buffer] = copy_event;
+    if (event != NULL) {
+        clRetainEvent(copy_event);
+        *event = copy_event;
+    }
+    return err;
+}
+
+// Internal function that enqueues the commands needed to write count
+// random numbers to dst. Copies out of the temporary buffers and any
+// refills are chained through events so nothing here waits on the device.
+// Whole multiples of the temporary buffer are generated directly in dst
+// once the numbers already in the temporary buffers are used up, so the
+// temporary buffers only serve the head and tail of the request. The
+// first command writing to dst waits on wait_list, and event (if not NULL)
+// is set to the last command writing to dst.
+cl_int clRAND::GenerateStream(size_t count, cl_mem dst, cl_uint num_wait_events, const cl_event* wait_list, cl_event* event) {
+    cl_int err = 0;
+    if (this->total_count == 0) {
+        std::cout << "ERROR: temporary buffers in stream object has not been set up!" << std::endl;
+        return -4;
+    }
+    if (this->loaded_state == false) {
+        err = this->CopyStateToDevice();
+        if (err) {
+            return err;
+        }
+    }
+
+    size_t fills_before = this->fill_count;
+    this->RecordRequestSize(count);
+
+    cl_event prev_event = NULL;
+    cl_event next_event = NULL;
+    size_t dst_offset = 0;
+    while (count > 0) {
+        // Only the first command in the chain depends on the wait list
+        // from the caller. The rest depend on the command before them.
+        cl_uint num_events = (prev_event == NULL) ? num_wait_events : 1;
+        const cl_event* events = (prev_event == NULL) ? wait_list : &prev_event;
+        next_event = NULL;
+        if ((this->filled_tmp_buffers == 0) && (count >= this->total_count)) {
+            // The request spans at least one whole temporary buffer, so
+            // generate those numbers straight into dst. The kernel is
+            // launched for a multiple of the number of PRNGs, which
+            // produces the same stream as repeated fill-and-copy rounds.
+            size_t num = (count / this->GetFillGranularity()) * this->GetFillGranularity();
+            err = this->EnqueueGenerate(dst, dst_offset, num, num_events, events, &next_event);
+            if (err) {
+                std::cout << "ERROR: unable to generate random bit stream in dst!" << std::endl;
+                break;
+            }
+            count -= num;
+            dst_offset += num;
+        } else if (this->filled_tmp_buffers == 0) {
+            err = this->RefillTmpBuffers();
+            if (err) {
+                std::cout << "ERROR: unable to generate random bit stream!" << std::endl;
+                break;
+            }
+        } else {
+            size_t num = (count < this->valid_count) ? count : this->valid_count;
+            err = this->EnqueueCopyBufferEntries(dst, dst_offset, num, num_events, events, &next_event);
+            if (err) {
+                std::cout << "ERROR: unable to copy random bit stream from buffer to dst!" << std::endl;
+                break;
+            }
+            this->valid_count -= num;
+            this->SetBufferOffset(this->GetBufferOffset() + num);
+            count -= num;
+            dst_offset += num;
+
+            // Move on to the next temporary buffer in the ring. The drained
+            // one is refilled once this request no longer needs the stream
+            // position it would be filled at.
+            if (this->valid_count == 0) {
+                this->cur_tmp_buffer = (this->cur_tmp_buffer + 1) % this->num_tmp_buffers;
+                this->filled_tmp_buffers--;
+                this->valid_count = (this->filled_tmp_buffers > 0) ? this->tmpBufferCounts[this->cur_tmp_buffer] : 0;
+                this->SetBufferOffset(0);
+            }
+        }
+        if (next_event != NULL) {
+            if (prev_event != NULL) {
+                clReleaseEvent(prev_event);
+            }
+            prev_event = next_event;
+        }
+    }
+
+    // Refill the drained temporary buffers in the background
+    if (err == 0) {
+        err = this->RefillTmpBuffers();
+    }
+    this->last_request_fills = this->fill_count - fills_before;
+    this->request_count++;
     if (err) {
-        std::cout << "ERROR: unable to wait for copy buffer to complete in CopyBufferEntries!" << std::endl;
+        if (prev_event != NULL) {
+            clReleaseEvent(prev_event);
+        }
+        return err;
+    }
+
+    // Nothing was enqueued, but the returned event must still complete
+    // after the events the caller asked us to wait on
+    if ((prev_event == NULL) && (event != NULL)) {
+        err = clEnqueueMarkerWithWaitList(this->com_queue_id, num_wait_events, wait_list, &prev_event);
+        if (err) {
+            std::cout << "ERROR: unable to enqueue marker for random bit stream!" << std::endl;
+            return err;
+        }
+    }
+    clFlush(this->com_queue_id);
+    clFlush(this->refill_queue_id);
+    if (event != NULL) {
+        *event = prev_event;
+    } else if (prev_event != NULL) {
+        clReleaseEvent(prev_event);
+    }
+    return err;
+}
+
+// Internal function that writes count random numbers to host memory.
+// On devices sharing memory with the host, dst is wrapped in a buffer so
+// the numbers are written in place. Otherwise they are generated into a
+// pinned staging buffer, which is mapped and copied from in chunks.
+cl_int clRAND::GenerateHost(size_t count, void* dst) {
+    cl_int err = 0;
+    size_t numBytes = this->GetPrecisionSize();
+    cl_event event = NULL;
+    if (this->IsHostUnified()) {
+        cl_mem hostBuffer = clCreateBuffer(this->context_id, CL_MEM_READ_WRITE | CL_MEM_USE_HOST_PTR, count * numBytes, dst, &err);
+        if (err) {
+            std::cout << "ERROR: unable to wrap host memory in a buffer!" << std::endl;
+            return err;
+        }
+        err = this->GenerateStream(count, hostBuffer, 0, NULL, &event);
+        if (err == 0) {
+            // Mapping makes the numbers visible in dst, without a copy
+            // unless the device had to move the buffer
+            void* mapped = clEnqueueMapBuffer(this->com_queue_id, hostBuffer, CL_TRUE, CL_MAP_READ, 0, count * numBytes, 1, &event, NULL, &err);
+            if (err) {
+                std::cout << "ERROR: unable to map host memory of random numbers!" << std::endl;
+            } else {
+                err = clEnqueueUnmapMemObject(this->com_queue_id, hostBuffer, mapped, 0, NULL, NULL);
+                if (err == 0) {
+                    err = clFinish(this->com_queue_id);
+                }
+            }
+            clReleaseEvent(event);
+        }
+        clReleaseMemObject(hostBuffer);
+        return err;
+    }
+
+    // The staging buffer is kept between calls, and only grows up to
+    // the budget of the temporary buffers
+    size_t chunk = this->tmp_budget / numBytes;
+    if (chunk > count) {
+        chunk = count;
+    }
+    if (this->staging_capacity < chunk) {
+        cl_mem staging_id = clCreateBuffer(this->context_id, CL_MEM_READ_WRITE | CL_MEM_ALLOC_HOST_PTR, chunk * numBytes, NULL, &err);
+        if (err) {
+            std::cout << "ERROR: unable to create pinned staging buffer!" << std::endl;
+            return err;
+        }
+        this->stagingBuffer = cl::Buffer(staging_id);
+        this->staging_capacity = chunk;
+    }
+    if (this->staging_capacity > chunk) {
+        chunk = this->staging_capacity;
+    }
+    // Kernels writing the next chunk may run on the refill queue, so they
+    // wait for the staging buffer to be unmapped on the main queue
+    cl_event unmap_event = NULL;
+    for (size_t done = 0; done < count; ) {
+        size_t num = (count - done < chunk) ? (count - done) : chunk;
+        err = this->GenerateStream(num, this->stagingBuffer(), (unmap_event != NULL) ? 1 : 0, (unmap_event != NULL) ? &unmap_event : NULL, &event);
+        if (unmap_event != NULL) {
+            clReleaseEvent(unmap_event);
+            unmap_event = NULL;
+        }
+        if (err) {
+            return err;
+        }
+        void* mapped = clEnqueueMapBuffer(this->com_queue_id, this->stagingBuffer(), CL_TRUE, CL_MAP_READ, 0, num * numBytes, 1, &event, NULL, &err);
+        clReleaseEvent(event);
+        if (err) {
+            std::cout << "ERROR: unable to map pinned staging buffer!" << std::endl;
+            return err;
+        }
+        memcpy((char*)(dst) + done * numBytes, mapped, num * numBytes);
+        err = clEnqueueUnmapMemObject(this->com_queue_id, this->stagingBuffer(), mapped, 0, NULL, &unmap_event);
+        if (err) {
+            std::cout << "ERROR: unable to unmap pinned staging buffer!" << std::endl;
+            return err;
+        }
+        done += num;
+    }
+    if (unmap_event != NULL) {
+        err = clWaitForEvents(1, &unmap_event);
+        clReleaseEvent(unmap_event);
+    }
+    return err;
+}
+
+// Internal function that writes counts[i] random numbers to dsts[i] at
+// entry offsets[i]. The whole batch is one contiguous range of the
+// stream, generated into the batch buffer in one request (so the bulk of
+// it is a single kernel launch) and then scattered to the destinations by
+// one launch per CLRAND_BATCH_DESTS destinations.
+cl_int clRAND::GenerateBatch(size_t n, const cl_mem* dsts, const size_t* offsets, const size_t* counts) {
+    cl_int err = 0;
+    size_t numBytes = this->GetPrecisionSize();
+    size_t total = 0;
+    for (size_t i = 0; i < n; i++) {
+        total += counts[i];
+    }
+    if (total == 0) {
         return err;
     }
+    if (this->batch_capacity < total) {
+        cl_mem batch_id = clCreateBuffer(this->context_id, CL_MEM_READ_WRITE, total * numBytes, NULL, &err);
+        if (err) {
+            std::cout << "ERROR: unable to create buffer for batch of random numbers!" << std::endl;
+            return err;
+        }
+        this->batchBuffer = cl::Buffer(batch_id);
+        this->batch_capacity = total;
+    }
+
+    cl_event event;
+    err = this->GenerateStream(total, this->batchBuffer(), 0, NULL, &event);
+    if (err) {
+        return err;
+    }
+
+    // Scatter the range to the destinations, in the order of the batch.
+    // Launches on the same queue run in order, so only the last is waited
+    // for. Unused destination arguments point at the batch buffer.
+    size_t global_size = (size_t)(this->wkgrp_size) * (size_t)(this->wkgrp_count);
+    if (global_size > total) {
+        global_size = total;
+    }
+    cl_event scatter_event = NULL;
+    size_t src_offset = 0;
+    size_t i = 0;
+    while ((err == 0) && (i < n)) {
+        cl_ulong8 starts;
+        cl_ulong8 dst_offsets;
+        cl_uint used = 0;
+        for (; (i < n) && (used < CLRAND_BATCH_DESTS); i++) {
+            if (counts[i] == 0) {
+                continue;
+            }
+            starts.s[used] = src_offset;
+            dst_offsets.s[used] = offsets[i];
+            err = this->scatter_batch.setArg<cl_mem>(4 + used, dsts[i]);
+            if (err) {
+                break;
+            }
+            src_offset += counts[i];
+            used++;
+        }
+        for (cl_uint k = used; (err == 0) && (k < CLRAND_BATCH_DESTS); k++) {
+            starts.s[k] = src_offset;
+            dst_offsets.s[k] = 0;
+            err = this->scatter_batch.setArg<cl_mem>(4 + k, this->batchBuffer());
+        }
+        if (err == 0) {
+            err = this->scatter_batch.setArg<cl::Buffer>(0, this->batchBuffer);
+        }
+        if (err == 0) {
+            err = this->scatter_batch.setArg<cl_ulong>(1, (cl_ulong)(src_offset));
+        }
+        if (err == 0) {
+            err = this->scatter_batch.setArg<cl_ulong8>(2, starts);
+        }
+        if (err == 0) {
+            err = this->scatter_batch.setArg<cl_ulong8>(3, dst_offsets);
+        }
+        if (err) {
+            std::cout << "ERROR: Unable to set arguments to kernel to scatter batch of random numbers!" << std::endl;
+            break;
+        }
+        if (used == 0) {
+            break;
+        }
+        cl_event wait_event = (scatter_event != NULL) ? scatter_event : event;
+        cl_event launch_event;
+        err = clEnqueueNDRangeKernel(this->com_queue_id, this->scatter_batch(), 1, NULL, &global_size, NULL, 1, &wait_event, &launch_event);
+        if (err) {
+            std::cout << "ERROR: Unable to enqueue kernel to scatter batch of random numbers!" << std::endl;
+            break;
+        }
+        if (scatter_event != NULL) {
+            clReleaseEvent(scatter_event);
+        }
+        scatter_event = launch_event;
+    }
+    clReleaseEvent(event);
+    if (scatter_event != NULL) {
+        cl_int wait_err = clWaitForEvents(1, &scatter_event);
+        clReleaseEvent(scatter_event);
+        if ((err == 0) && wait_err) {
+            std::cout << "ERROR: unable to wait for batch of random numbers to be scattered!" << std::endl;
+            err = wait_err;
+        }
+    }
     return err;
 }
 
+// Internal function that switches the stream object to concurrent mode,
+// in which several host threads may generate from it at once. It must be
+// called before the temporary buffers are set up.
+int clRAND::SetConcurrent(bool enable) {
+    if (this->tmpOutputBuffers.empty() == false) {
+        std::cout << "ERROR: temporary buffers of stream object are already set up!" << std::endl;
+        return -2;
+    }
+    this->concurrent = enable;
+    return 0;
+}
+
+// Internal function that writes count random numbers to dst in concurrent
+// mode. The range of the stream is reserved with a single atomic add, so
+// threads sharing the stream object get disjoint ranges without a lock.
+// Each window of the range is copied out of its temporary buffer once it
+// has been generated. A thread finding its window missing refills the
+// temporary buffers, unless another thread is already doing so.
+cl_int clRAND::GenerateConcurrent(size_t count, cl_mem dst, cl_ulong* position) {
+    cl_int err = 0;
+    if (this->conc_slots == NULL) {
+        std::cout << "ERROR: temporary buffers in stream object has not been set up!" << std::endl;
+        return -4;
+    }
+    size_t numBytes = this->GetPrecisionSize();
+    size_t window_size = this->total_count;
+    cl_ulong start = this->stream_position.fetch_add((cl_ulong)(count));
+    if (position != NULL) {
+        *position = start;
+    }
+
+    // Copies that have been enqueued but not waited on yet. A window only
+    // counts as consumed once the copies out of it have completed.
+    std::vector<cl_event> copy_events;
+    std::vector<size_t> copy_slots;
+    std::vector<size_t> copy_counts;
+    size_t done = 0;
+    while (done < count) {
+        cl_ulong window = (start + done) / window_size;
+        size_t idx = (size_t)(window % this->num_tmp_buffers);
+        if (this->conc_slots[idx].window.load(std::memory_order_acquire) != window + 1) {
+            // Before waiting on a window, release the windows already copied
+            // from, as the missing window may need their temporary buffers
+            if (copy_events.empty() == false) {
+                err = this->ReleaseConcurrentCopies(copy_events, copy_slots, copy_counts);
+                if (err) {
+                    break;
+                }
+                continue;
+            }
+            if (this->refill_mutex.try_lock()) {
+                err = this->RefillConcurrentSlots();
+                this->refill_mutex.unlock();
+                if (err) {
+                    std::cout << "ERROR: unable to generate random bit stream!" << std::endl;
+                    break;
+                }
+            }
+            std::this_thread::yield();
+            continue;
+        }
+
+        size_t slot_offset = (size_t)(start + done - window * window_size);
+        size_t num = window_size - slot_offset;
+        if (num > count - done) {
+            num = count - done;
+        }
+        cl_event copy_event;
+        err = clEnqueueCopyBuffer(this->com_queue_id, this->tmpOutputBuffers[idx](), dst, slot_offset * numBytes, done * numBytes, num * numBytes, 1, &(this->conc_slots[idx].fill_event), &copy_event);
+        if (err) {
+            std::cout << "ERROR: unable to copy random bit stream from buffer to dst!" << std::endl;
+            break;
+        }
+        clFlush(this->com_queue_id);
+        copy_events.push_back(copy_event);
+        copy_slots.push_back(idx);
+        copy_counts.push_back(num);
+        done += num;
+    }
+    if (copy_events.empty() == false) {
+        cl_int wait_err = this->ReleaseConcurrentCopies(copy_events, copy_slots, copy_counts);
+        if (err == 0) {
+            err = wait_err;
+        }
+    }
+    return err;
+}
+
+// Internal function that waits for copies out of the temporary buffers in
+// concurrent mode, and marks the entries they copied as consumed
+cl_int clRAND::ReleaseConcurrentCopies(std::vector<cl_event>& events, std::vector<size_t>& slots, std::vector<size_t>& counts) {
+    cl_int err = clWaitForEvents((cl_uint)(events.size()), &events[0]);
+    if (err) {
+        std::cout << "ERROR: unable to wait for random bit stream to be copied!" << std::endl;
+    }
+    for (size_t i = 0; i < events.size(); i++) {
+        clReleaseEvent(events[i]);
+        this->conc_slots[slots[i]].consumed.fetch_add(counts[i], std::memory_order_release);
+    }
+    events.clear();
+    slots.clear();
+    counts.clear();
+    return err;
+}
+
+// Internal function that enqueues fills of the next windows of the stream
+// into the temporary buffers whose windows have been consumed. The caller
+// must hold refill_mutex, which keeps the generate kernels in stream order.
+cl_int clRAND::RefillConcurrentSlots() {
+    cl_int err = 0;
+    for (size_t i = 0; i < this->num_tmp_buffers; i++) {
+        size_t idx = (size_t)(this->next_fill_window % this->num_tmp_buffers);
+        clrandConcurrentSlot& slot = this->conc_slots[idx];
+        if ((slot.window.load(std::memory_order_acquire) != 0) && (slot.consumed.load(std::memory_order_acquire) < this->total_count)) {
+            break;
+        }
+        // Every copy out of the previous window has completed, so the
+        // kernel does not need to wait for anything
+        cl_event fill_event;
+        err = this->EnqueueGenerate(this->tmpOutputBuffers[idx](), 0, this->total_count, 0, NULL, &fill_event);
+        if (err) {
+            return err;
+        }
+        if (slot.fill_event != NULL) {
+            clReleaseEvent(slot.fill_event);
+        }
+        slot.fill_event = fill_event;
+        slot.consumed.store(0, std::memory_order_relaxed);
+        slot.window.store(this->next_fill_window + 1, std::memory_order_release);
+        this->next_fill_window++;
+    }
+    clFlush(this->refill_queue_id);
+    return err;
+}
+
+// Internal function that empties the temporary buffers in concurrent mode
+// and restarts the reservations at the head of the stream. No thread may
+// be generating from the stream object while this runs.
+void clRAND::ResetConcurrentSlots() {
+    for (size_t i = 0; i < this->num_tmp_buffers; i++) {
+        if (this->conc_slots[i].fill_event != NULL) {
+            clReleaseEvent(this->conc_slots[i].fill_event);
+            this->conc_slots[i].fill_event = NULL;
+        }
+        this->conc_slots[i].window = 0;
+        this->conc_slots[i].consumed = 0;
+    }
+    this->stream_position = 0;
+    this->next_fill_window = 0;
+}
+
+// Internal function that checks whether the device shares its memory with
+// the host, as CPU devices do
+bool clRAND::IsHostUnified() {
+    if (this->host_unified < 0) {
+        cl_int err;
+        cl_device_type dev_type = this->device.getInfo<CL_DEVICE_TYPE>(&err);
+        cl_bool unified = this->device.getInfo<CL_DEVICE_HOST_UNIFIED_MEMORY>(&err);
+        this->host_unified = ((dev_type & CL_DEVICE_TYPE_CPU) || (unified == CL_TRUE)) ? 1 : 0;
+    }
+    return (this->host_unified == 1);
+}
+
+// Internal function that enqueues refills of the drained temporary
+// buffers on the refill queue. Buffers are refilled in ring order after
+// the ones still holding numbers, which keeps the order in which numbers
+// are handed out the same as the order in which they were generated.
+cl_int clRAND::RefillTmpBuffers() {
+    cl_int err = 0;
+    while (this->filled_tmp_buffers < this->num_tmp_buffers) {
+        size_t idx = (this->cur_tmp_buffer + this->filled_tmp_buffers) % this->num_tmp_buffers;
+        err = this->ResizeTmpBuffer(idx);
+        if (err) {
+            return err;
+        }
+
+        // Do not overwrite the buffer before the last copy out of it is done
+        cl_event drain_event = this->tmpDrainEvents[idx];
+        cl_event fill_event;
+        err = this->EnqueueGenerate(this->tmpOutputBuffers[idx](), 0, this->tmpBufferCounts[idx], (drain_event != NULL) ? 1 : 0, (drain_event != NULL) ? &drain_event : NULL, &fill_event);
+        if (err) {
+            return err;
+        }
+        if (this->tmpFillEvents[idx] != NULL) {
+            clReleaseEvent(this->tmpFillEvents[idx]);
+        }
+        this->tmpFillEvents[idx] = fill_event;
+        if (this->filled_tmp_buffers == 0) {
+            this->valid_count = this->tmpBufferCounts[idx];
+            this->SetBufferOffset(0);
+        }
+        this->filled_tmp_buffers++;
+    }
+    clFlush(this->refill_queue_id);
+    return err;
+}
+
+// Internal function that brings the size of a drained temporary buffer in
+// line with the current number of entries per fill. The buffer is only
+// reallocated when it is too small, or much larger than needed.
+cl_int clRAND::ResizeTmpBuffer(size_t idx) {
+    cl_int err = 0;
+    size_t capacity = this->tmpBufferCapacity[idx];
+    if ((this->total_count > capacity) || (this->total_count * 4 < capacity)) {
+        // Commands still using the old buffer keep it alive until they complete
+        cl_mem tmpOutputBuffer_id = clCreateBuffer(this->context_id, CL_MEM_READ_WRITE, this->total_count * this->GetPrecisionSize(), NULL, &err);
+        if (err) {
+            std::cout << "ERROR: Unable to resize temporary buffer of PRNG!" << std::endl;
+            return err;
+        }
+        this->tmpOutputBuffers[idx] = cl::Buffer(tmpOutputBuffer_id);
+        this->tmpBufferCapacity[idx] = this->total_count;
+        this->resize_count++;
+    }
+    this->tmpBufferCounts[idx] = this->total_count;
+
+    // The specialized kernel follows the fill size, so it is rebuilt here
+    // when the size changes rather than when a fill is launched
+    this->BuildFixedKernel(this->total_count);
+    return err;
+}
+
+// Internal function that adds a request to the histogram of recent request
+// sizes, and picks the number of entries of future temporary buffer fills
+// so that nine in ten recent requests fit in a single temporary buffer.
+// Larger requests are generated directly in their destination anyway.
+void clRAND::RecordRequestSize(size_t count) {
+    if (count == 0) {
+        return;
+    }
+    size_t bucket = 0;
+    while ((bucket < 63) && ((count >> (bucket + 1)) != 0)) {
+        bucket++;
+    }
+    this->request_histogram[bucket]++;
+    this->request_total++;
+
+    // Halve the counts regularly so that old requests fade out
+    if (this->request_total >= 1024) {
+        this->request_total = 0;
+        for (size_t i = 0; i < 64; i++) {
+            this->request_histogram[i] >>= 1;
+            this->request_total += this->request_histogram[i];
+        }
+    }
+    if ((this->adaptive_tmp_size == false) || (this->min_count == 0)) {
+        return;
+    }
+
+    size_t seen = 0;
+    for (bucket = 0; bucket < 63; bucket++) {
+        seen += this->request_histogram[bucket];
+        if (seen * 10 >= this->request_total * 9) {
+            break;
+        }
+    }
+    size_t granularity = this->GetFillGranularity();
+    size_t target = (bucket < 62) ? ((size_t)(2) << bucket) : ~(size_t)(0) / 2;
+    size_t limit = this->tmp_budget / (this->num_tmp_buffers * this->GetPrecisionSize());
+    if (target > limit) {
+        target = limit;
+    }
+    target = ((target + granularity - 1) / granularity) * granularity;
+    if (target < this->min_count) {
+        target = this->min_count;
+    }
+    this->total_count = target;
+}
+
+// Returns the number of bytes of each random number generated
+size_t clRAND::GetPrecisionSize() {
+    if (((std::string)(this->rng_precision) == "double") || ((std::string)(this->rng_precision) == "ulong")) {
+        return 8;
+    }
+    return 4;
+}
+
+// Fills in statistics on the temporary buffers of the stream object
+void clRAND::GetStreamStats(clrandStreamStats* stats) {
+    stats->tmp_buffer_entries = this->total_count;
+    stats->tmp_buffer_bytes = 0;
+    for (size_t i = 0; i < this->tmpBufferCapacity.size(); i++) {
+        stats->tmp_buffer_bytes += this->tmpBufferCapacity[i] * this->GetPrecisionSize();
+    }
+    stats->resize_count = this->resize_count;
+    stats->fill_count = this->fill_count;
+    stats->request_count = this->request_count;
+    stats->last_request_fills = this->last_request_fills;
+}
+
+// Internal function that waits for all kernels advancing the PRNG states
+// to finish, before the state buffer is read or written directly
+cl_int clRAND::FinishRefills() {
+    if (this->refill_queue_id == NULL) {
+        return 0;
+    }
+    cl_int err = clFinish(this->refill_queue_id);
+    if (err) {
+        std::cout << "ERROR: unable to wait for refills of temporary buffers to finish!" << std::endl;
+    }
+    return err;
+}
+
+// Sets the number of temporary buffers in the ring. Takes effect when the
+// stream buffers are set up.
+int clRAND::SetNumTmpBuffers(size_t num) {
+    if (this->tmpOutputBuffers.empty() == false) {
+        std::cout << "ERROR: temporary buffers of stream object are already set up!" << std::endl;
+        return -2;
+    }
+    if (num < 1) {
+        std::cout << "ERROR: stream object needs at least one temporary buffer!" << std::endl;
+        return -1;
+    }
+    this->num_tmp_buffers = num;
+    return 0;
+}
+
+// Sets the upper limit on the number of entries generated by one kernel
+// launch. Keeping launches short avoids driver watchdogs on large requests.
+// The kernels index entries within a launch with 32 bits, which caps the
+// limit at 2^31 entries.
+int clRAND::SetMaxLaunchCount(size_t num) {
+    if ((num < 1) || (num > ((size_t)(1) << 31))) {
+        std::cout << "ERROR: number of entries per kernel launch must be between 1 and 2^31!" << std::endl;
+        return -1;
+    }
+    this->max_launch_count = num;
+    return 0;
+}
+
+// Sets the number of PRNG instances of the stream object, independent of
+// the launch configuration. Each work-item runs the instances gid,
+// gid + launch size, ... so the same seed gives the same stream on any
+// device or work configuration. Zero (the default) runs one instance per
+// work-item.
+int clRAND::SetNumGenerators(size_t num) {
+    if (this->generator_ready) {
+        std::cout << "ERROR: generators of stream object are already set up!" << std::endl;
+        return -2;
+    }
+    if (num > (size_t)(UINT_MAX)) {
+        std::cout << "ERROR: number of generators must be less than 2^32!" << std::endl;
+        return -1;
+    }
+    this->num_generators = num;
+    return 0;
+}
+
+// Internal function that returns the number of work-items launched to run
+// the PRNG instances: the launch configuration, cut down to the whole
+// work-groups covering the instances when there are fewer of them
+size_t clRAND::GetLaunchSize() {
+    size_t global_size = (size_t)(this->wkgrp_size) * (size_t)(this->wkgrp_count);
+    size_t needed = this->GetNumberOfRNGs();
+    needed = ((needed + this->wkgrp_size - 1) / this->wkgrp_size) * this->wkgrp_size;
+    return (needed < global_size) ? needed : global_size;
+}
+
 // Internal function that seeds the PRNGs in the
-// stream object
-cl_int clRAND::SeedGenerator() {
+// stream object, from the seed value or, if seeds is not NULL, from one
+// seed per PRNG in the device buffer seeds
+cl_int clRAND::SeedGenerator(cl_mem seeds) {
     this->seeded = false;
     if (this->init_flag != true) {
         std::cout << "ERROR: stream object has not been initialized!" << std::endl;
@@ -670,11 +2865,55 @@ cl_int clRAND::SeedGenerator() {
         std::cout << "ERROR: temporary buffers in stream object has not been set up!" << std::endl;
         return -4;
     }
+    // Kernels still generating from the current states must finish first
+    cl_int err = this->FinishRefills();
+    if (err) {
+        return err;
+    }
+    // The seed value, scheme and stream id are taken now, so that setting
+    // them again before a pending seeding runs only affects the next seeding
+    this->seeding_val = this->seedVal;
+    this->seeding_scheme = this->seed_scheme;
+    this->seeding_stream_id = this->stream_id;
+
+    // In lazy mode, seeding from the seed value is left to the first
+    // generate launch, which seeds the states in registers
+    if ((seeds == NULL) && this->lazy_seeding && (this->GetLocalStateSize() == 0)) {
+        this->seed_pending = true;
+    } else {
+        err = this->LaunchSeedKernel(seeds);
+        if (err) {
+            return err;
+        }
+    }
+    // The freshly seeded states live on the device only
+    this->loaded_state = true;
+    this->host_state_stale = true;
+    this->seeded = true;
+
+    // Numbers buffered from the previous states are dropped, so the
+    // stream restarts from the new seed
+    this->DropBufferedNumbers();
+    this->generated_count = 0;
+#ifdef DEBUG1
+    std::cout << "Done seeding generator" << std::endl;
+#endif
+    return err;
+}
+
+// Internal function that runs the kernel seeding the PRNG states, from
+// the seed value or, if seeds is not NULL, from the device buffer seeds
+cl_int clRAND::LaunchSeedKernel(cl_mem seeds) {
     cl_int err;
+    cl::Kernel& seed_kernel = (seeds != NULL) ? this->seed_rng_array : this->seed_rng;
 #ifdef DEBUG1
     std::cout << "Setting seedVal" << std::endl;
 #endif
-    err = this->seed_rng.setArg<ulong>(0, this->seedVal);
+    if (seeds != NULL) {
+        err = seed_kernel.setArg<cl_mem>(0, seeds);
+    } else {
+        err = seed_kernel.setArg<ulong>(0, this->seeding_val);
+    }
     if (err != 0) {
         std::cout << "ERROR: Unable to set first argument to kernel to seed PRNG!" << std::endl;
         return err;
@@ -682,17 +2921,41 @@ cl_int clRAND::SeedGenerator() {
 #ifdef DEBUG1
     std::cout << "Setting stateBuffer" << std::endl;
 #endif
-    err = seed_rng.setArg<cl::Buffer>(1, this->stateBuffer);
+    err = seed_kernel.setArg<cl::Buffer>(1, this->stateBuffer);
     if (err) {
         std::cout << "ERROR: Unable to set second argument to kernel to seed PRNG!" << std::endl;
         return err;
     }
+    err = seed_kernel.setArg<cl_uint>(2, (cl_uint)(this->GetNumberOfRNGs()));
+    if (err) {
+        std::cout << "ERROR: Unable to set third argument to kernel to seed PRNG!" << std::endl;
+        return err;
+    }
+    cl_uint local_arg = 3;
+    if (seeds == NULL) {
+        err = seed_kernel.setArg<cl_uint>(3, (cl_uint)(this->seeding_scheme));
+        if (err == 0) {
+            err = seed_kernel.setArg<cl_ulong>(4, this->seeding_stream_id);
+        }
+        if (err) {
+            std::cout << "ERROR: Unable to set seed scheme arguments to kernel to seed PRNG!" << std::endl;
+            return err;
+        }
+        local_arg = 5;
+    }
+    if (this->GetLocalStateSize() > 0) {
+        err = clSetKernelArg(seed_kernel(), local_arg, this->GetLocalStateSize(), NULL);
+        if (err) {
+            std::cout << "ERROR: Unable to set local state argument to kernel to seed PRNG!" << std::endl;
+            return err;
+        }
+    }
     cl_event event_id;
     cl::Event event;
 #ifdef DEBUG1
     std::cout << "Executing kernel to seed generator" << std::endl;
 #endif
-    err = this->com_queue.enqueueNDRangeKernel(this->seed_rng, cl::NDRange(0), cl::NDRange((size_t)(this->wkgrp_count * this->wkgrp_size)), cl::NDRange((size_t)(this->wkgrp_size)), NULL, &event);
+    err = this->com_queue.enqueueNDRangeKernel(seed_kernel, cl::NDRange(0), cl::NDRange(this->GetLaunchSize()), cl::NDRange((size_t)(this->wkgrp_size)), NULL, &event);
     if (err) {
         std::cout << "ERROR: Unable to enqueue kernel to seed PRNG!" << std::endl;
         return err;
@@ -703,29 +2966,115 @@ cl_int clRAND::SeedGenerator() {
         std::cout << "ERROR: Unable to wait for kernel to seed PRNG!" << std::endl;
         return err;
     }
-    if (local_state_mem == NULL) {
-        static void *tmp_mem = malloc(state_size * (size_t)(this->wkgrp_size * this->wkgrp_count));
-        this->local_state_mem = tmp_mem;
-    } else {
-        free(this->local_state_mem);
-        static void *tmp_mem = malloc(state_size * (size_t)(this->wkgrp_size * this->wkgrp_count));
-        this->local_state_mem = tmp_mem;
+    this->seed_pending = false;
+    return err;
+}
+
+// Sets whether seeding from the seed value is left to the first generate
+// launch, which seeds the states in registers instead of loading them.
+// This saves the seeding launch and its wait, and the fill of the
+// temporary buffers when the stream is readied. Must be set before the
+// stream object is readied. xorshift1024, which seeds through local
+// memory, is always seeded by its own launch.
+int clRAND::SetLazySeeding(bool enable) {
+    if (this->generator_ready) {
+        std::cout << "ERROR: generators of stream object are already set up!" << std::endl;
+        return -2;
     }
-    err = this->CopyStateToHost(this->local_state_mem);
-    this->seeded = true;
-#ifdef DEBUG1
-    std::cout << "Done seeding generator" << std::endl;
-#endif
+    this->lazy_seeding = enable;
+    return 0;
+}
+
+// Internal function that sets the arguments of a generate kernel from
+// first on that seed the states on the first launch after lazy seeding
+cl_int clRAND::SetSeedArgs(cl::Kernel& kernel, cl_uint first) {
+    cl_uint seed_mode = this->seed_pending ? ((cl_uint)(this->seeding_scheme) + 1) : 0;
+    cl_int err = kernel.setArg<cl_uint>(first, seed_mode);
+    if (err == 0) {
+        err = kernel.setArg<cl_ulong>(first + 1, (cl_ulong)(this->seeding_val));
+    }
+    if (err == 0) {
+        err = kernel.setArg<cl_ulong>(first + 2, this->seeding_stream_id);
+    }
+    if (err) {
+        std::cout << "ERROR: Unable to set seed arguments to kernel to generate bitstream!" << std::endl;
+    }
+    return err;
+}
+
+// Internal function that runs the seeding left to the first generate
+// launch by lazy seeding, for uses of the states other than generating
+cl_int clRAND::ResolvePendingSeed() {
+    if (this->seed_pending == false) {
+        return 0;
+    }
+    return this->LaunchSeedKernel(NULL);
+}
+
+
+// Seeds each PRNG of the stream object from its own seed, with seeds[i]
+// seeding PRNG i. num must be the number of PRNGs of the stream object.
+// The seeds are copied to the device and all PRNGs are seeded in one
+// launch.
+cl_int clRAND::SeedFromArray(const cl_ulong* seeds, size_t num) {
+    if (this->generator_ready != true) {
+        std::cout << "ERROR: temporary buffers in stream object has not been set up!" << std::endl;
+        return -4;
+    }
+    if ((seeds == NULL) || (num != this->GetNumberOfRNGs())) {
+        std::cout << "ERROR: expected " << this->GetNumberOfRNGs() << " seeds, one per PRNG!" << std::endl;
+        return CL_INVALID_VALUE;
+    }
+    cl_int err;
+    cl_mem seedBuffer = clCreateBuffer(this->context_id, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, num * sizeof(cl_ulong), (void*)(seeds), &err);
+    if (err) {
+        std::cout << "ERROR: unable to create buffer for seeds!" << std::endl;
+        return err;
+    }
+    err = this->SeedFromBuffer(seedBuffer, num);
+    clReleaseMemObject(seedBuffer);
     return err;
 }
 
+// Seeds each PRNG of the stream object from its own seed in the device
+// buffer seeds (num cl_ulong, num being the number of PRNGs), without a
+// copy through the host. Writes to seeds must have finished.
+cl_int clRAND::SeedFromBuffer(cl_mem seeds, size_t num) {
+    if (this->generator_ready != true) {
+        std::cout << "ERROR: temporary buffers in stream object has not been set up!" << std::endl;
+        return -4;
+    }
+    size_t size = 0;
+    cl_int err = (seeds != NULL) ? clGetMemObjectInfo(seeds, CL_MEM_SIZE, sizeof(size), &size, NULL) : CL_INVALID_MEM_OBJECT;
+    if (err) {
+        std::cout << "ERROR: invalid buffer of seeds!" << std::endl;
+        return err;
+    }
+    if ((num != this->GetNumberOfRNGs()) || (size < num * sizeof(cl_ulong))) {
+        std::cout << "ERROR: expected a buffer of " << this->GetNumberOfRNGs() << " seeds, one per PRNG!" << std::endl;
+        return CL_INVALID_VALUE;
+    }
+    err = this->SeedGenerator(seeds);
+    if (err) {
+        std::cout << "ERROR: failed to seed generator from buffer of seeds!" << std::endl;
+    }
+    return err;
+}
 
 // Internal function that copies the PRNG states from
 // host side to device side
 cl_int clRAND::CopyStateToDevice() {
+    if (this->local_state_mem == NULL) {
+        std::cout << "ERROR: no PRNG states on host side to copy to device!" << std::endl;
+        return -1;
+    }
+    cl_int err = this->FinishRefills();
+    if (err) {
+        return err;
+    }
     // Copy PRNG states from host side to device side
     cl::Event event;
-    cl_int err = this->com_queue.enqueueWriteBuffer(this->stateBuffer, true, 0, this->state_size * (size_t)(this->wkgrp_count * this->wkgrp_size), this->local_state_mem, NULL, &event);
+    err = this->com_queue.enqueueWriteBuffer(this->stateBuffer, true, 0, this->GetStateBufferSize(), this->local_state_mem, NULL, &event);
     if (err) {
         std::cout << "ERROR: unable to copy state from host to device!" << std::endl;
         return err;
@@ -736,15 +3085,25 @@ cl_int clRAND::CopyStateToDevice() {
         std::cout << "ERROR: unable to wait for copy state from host to device to finish!" << std::endl;
         return err;
     }
-
+    this->loaded_state = true;
+    this->host_state_stale = false;
+    this->seed_pending = false;
+    return err;
 }
 
 // Internal function that copies the PRNG states from
 // device side to host side
 cl_int clRAND::CopyStateToHost(void* hostPtr) {
+    cl_int err = this->FinishRefills();
+    if (err == 0) {
+        err = this->ResolvePendingSeed();
+    }
+    if (err) {
+        return err;
+    }
     // Copy PRNG states from device side back to host side
     cl::Event event;
-    cl_int err = this->com_queue.enqueueReadBuffer(this->stateBuffer, true, 0, this->state_size * (size_t)(this->wkgrp_count * this->wkgrp_size), hostPtr, NULL, &event);
+    err = this->com_queue.enqueueReadBuffer(this->stateBuffer, true, 0, this->GetStateBufferSize(), hostPtr, NULL, &event);
     if (err) {
         std::cout << "ERROR: unable to copy state from host to device!" << std::endl;
         return err;
@@ -755,25 +3114,288 @@ cl_int clRAND::CopyStateToHost(void* hostPtr) {
         std::cout << "ERROR: unable to wait for copy state from host to device to finish!" << std::endl;
         return err;
     }
+    if (hostPtr == this->local_state_mem) {
+        this->host_state_stale = false;
+    }
+    return err;
+}
+
+// Internal function that refreshes the host side copy of the PRNG
+// states if the device side states have advanced since the last copy
+cl_int clRAND::SyncStateToHost() {
+    if ((this->loaded_state == false) || (this->host_state_stale == false)) {
+        return 0;
+    }
+    return this->CopyStateToHost(this->local_state_mem);
+}
+
+// Copies the PRNG states to hostPtr, or only to the host copy kept by the
+// stream object when hostPtr is NULL. The states are past the numbers
+// still buffered in the temporary buffers, so the stream object keeps a
+// copy of those numbers and their position next to the checkpoint. The
+// stream itself carries on as if no checkpoint was taken.
+cl_int clRAND::CheckpointState(void* hostPtr) {
+    cl_int err = this->FinishRefills();
+    if (err == 0) {
+        err = this->SyncStateToHost();
+    }
+    if (err == 0) {
+        err = this->SaveBufferedNumbers();
+    }
+    if (err) {
+        return err;
+    }
+    if (hostPtr != NULL) {
+        memcpy(hostPtr, this->local_state_mem, this->GetStateBufferSize());
+    }
+    this->checkpoint_count = this->generated_count;
+    return err;
+}
+
+// Overwrites the PRNG states with a checkpoint. The numbers buffered from
+// the replaced states are dropped, and the numbers buffered at the last
+// checkpoint of the stream object are put back where they were, so the
+// stream replays from the position of that checkpoint. The count of
+// numbers passed to the transform restarts from there too.
+cl_int clRAND::RestoreState(const void* hostPtr) {
+    if ((hostPtr == NULL) || (this->local_state_mem == NULL)) {
+        std::cout << "ERROR: stream object has no state to restore!" << std::endl;
+        return -1;
+    }
+    cl_int err = this->FinishRefills();
+    if (err) {
+        return err;
+    }
+    memcpy(this->local_state_mem, hostPtr, this->GetStateBufferSize());
+    err = this->CopyStateToDevice();
+    if (err) {
+        return err;
+    }
+    this->DropBufferedNumbers();
+    err = this->LoadBufferedNumbers();
+    if (err) {
+        return err;
+    }
+    this->generated_count = this->checkpoint_count;
+    return err;
+}
+
+// Internal function that copies the numbers of the temporary buffers not
+// handed out yet to the checkpoint buffer, and records where they are in
+// the stream. Refills must have finished, and in concurrent mode no thread
+// may be generating from the stream object.
+cl_int clRAND::SaveBufferedNumbers() {
+    cl_int err = 0;
+    this->checkpoint_segments.clear();
+    if (this->conc_slots != NULL) {
+        // Windows from the one holding the next position of the stream up
+        // to the last one filled
+        size_t window_size = this->total_count;
+        cl_ulong position = this->stream_position.load();
+        for (cl_ulong window = position / window_size; window < this->next_fill_window; window++) {
+            clrandCheckpointSegment segment;
+            segment.buffer = (size_t)(window % this->num_tmp_buffers);
+            segment.offset = (position > window * window_size) ? (size_t)(position - window * window_size) : 0;
+            segment.count = window_size - segment.offset;
+            segment.size = window_size;
+            this->checkpoint_segments.push_back(segment);
+        }
+        this->checkpoint_position = position;
+        this->checkpoint_window = this->next_fill_window;
+    } else {
+        for (size_t i = 0; i < this->filled_tmp_buffers; i++) {
+            clrandCheckpointSegment segment;
+            segment.buffer = (this->cur_tmp_buffer + i) % this->num_tmp_buffers;
+            segment.offset = (i == 0) ? this->GetBufferOffset() : 0;
+            segment.count = (i == 0) ? this->valid_count : this->tmpBufferCounts[segment.buffer];
+            segment.size = this->tmpBufferCounts[segment.buffer];
+            this->checkpoint_segments.push_back(segment);
+        }
+        this->checkpoint_tmp_buffer = this->cur_tmp_buffer;
+    }
+
+    size_t total = 0;
+    for (size_t i = 0; i < this->checkpoint_segments.size(); i++) {
+        total += this->checkpoint_segments[i].count;
+    }
+    if (total == 0) {
+        return err;
+    }
+    size_t numBytes = this->GetPrecisionSize();
+    if (this->checkpoint_capacity < total) {
+        cl_mem checkpoint_id = clCreateBuffer(this->context_id, CL_MEM_READ_WRITE, total * numBytes, NULL, &err);
+        if (err) {
+            std::cout << "ERROR: unable to create buffer for checkpoint of random numbers!" << std::endl;
+            this->checkpoint_segments.clear();
+            return err;
+        }
+        this->checkpointBuffer = cl::Buffer(checkpoint_id);
+        this->checkpoint_capacity = total;
+    }
+
+    // The copies only read the temporary buffers, so they wait for their
+    // fills and nothing else
+    std::vector<cl_event> events;
+    size_t done = 0;
+    for (size_t i = 0; (i < this->checkpoint_segments.size()) && (err == 0); i++) {
+        const clrandCheckpointSegment& segment = this->checkpoint_segments[i];
+        cl_event fill_event = (this->conc_slots != NULL) ? this->conc_slots[segment.buffer].fill_event : this->tmpFillEvents[segment.buffer];
+        cl_event copy_event;
+        err = clEnqueueCopyBuffer(this->com_queue_id, this->tmpOutputBuffers[segment.buffer](), this->checkpointBuffer(), segment.offset * numBytes, done * numBytes, segment.count * numBytes, (fill_event != NULL) ? 1 : 0, (fill_event != NULL) ? &fill_event : NULL, &copy_event);
+        if (err) {
+            std::cout << "ERROR: unable to copy buffered random numbers to checkpoint!" << std::endl;
+            break;
+        }
+        events.push_back(copy_event);
+        done += segment.count;
+    }
+    if (events.empty() == false) {
+        cl_int wait_err = clWaitForEvents((cl_uint)(events.size()), &events[0]);
+        if ((err == 0) && wait_err) {
+            std::cout << "ERROR: unable to wait for checkpoint of random numbers to finish!" << std::endl;
+            err = wait_err;
+        }
+        for (size_t i = 0; i < events.size(); i++) {
+            clReleaseEvent(events[i]);
+        }
+    }
+    if (err) {
+        this->checkpoint_segments.clear();
+    }
+    return err;
+}
+
+// Internal function that puts the numbers saved by the last checkpoint back
+// into the temporary buffers they were taken from, at the same position of
+// the stream. The temporary buffers must have been emptied.
+cl_int clRAND::LoadBufferedNumbers() {
+    cl_int err = 0;
+    size_t numBytes = this->GetPrecisionSize();
+    size_t done = 0;
+    for (size_t i = 0; i < this->checkpoint_segments.size(); i++) {
+        const clrandCheckpointSegment& segment = this->checkpoint_segments[i];
+
+        // The buffer may have been shrunk since the checkpoint
+        if (this->tmpBufferCapacity[segment.buffer] < segment.size) {
+            cl_mem tmpOutputBuffer_id = clCreateBuffer(this->context_id, CL_MEM_READ_WRITE, segment.size * numBytes, NULL, &err);
+            if (err) {
+                std::cout << "ERROR: Unable to resize temporary buffer of PRNG!" << std::endl;
+                return err;
+            }
+            this->tmpOutputBuffers[segment.buffer] = cl::Buffer(tmpOutputBuffer_id);
+            this->tmpBufferCapacity[segment.buffer] = segment.size;
+            this->resize_count++;
+        }
+
+        // Do not overwrite the buffer before the last copy out of it is done
+        cl_event drain_event = this->tmpDrainEvents[segment.buffer];
+        cl_event copy_event;
+        err = clEnqueueCopyBuffer(this->com_queue_id, this->checkpointBuffer(), this->tmpOutputBuffers[segment.buffer](), done * numBytes, segment.offset * numBytes, segment.count * numBytes, (drain_event != NULL) ? 1 : 0, (drain_event != NULL) ? &drain_event : NULL, &copy_event);
+        if (err) {
+            std::cout << "ERROR: unable to copy checkpoint of random numbers to buffer!" << std::endl;
+            this->DropBufferedNumbers();
+            return err;
+        }
+        done += segment.count;
+
+        // Copies out of the buffer wait for this copy as they would for a fill
+        if (this->conc_slots != NULL) {
+            clrandConcurrentSlot& slot = this->conc_slots[segment.buffer];
+            if (slot.fill_event != NULL) {
+                clReleaseEvent(slot.fill_event);
+            }
+            slot.fill_event = copy_event;
+            slot.consumed.store(segment.offset, std::memory_order_relaxed);
+            slot.window.store(this->checkpoint_position / this->total_count + i + 1, std::memory_order_release);
+        } else {
+            if (this->tmpFillEvents[segment.buffer] != NULL) {
+                clReleaseEvent(this->tmpFillEvents[segment.buffer]);
+            }
+            this->tmpFillEvents[segment.buffer] = copy_event;
+            this->tmpBufferCounts[segment.buffer] = segment.size;
+        }
+    }
+    clFlush(this->com_queue_id);
+
+    if (this->conc_slots != NULL) {
+        this->stream_position = this->checkpoint_position;
+        this->next_fill_window = this->checkpoint_window;
+    } else if (this->checkpoint_segments.empty() == false) {
+        this->cur_tmp_buffer = this->checkpoint_tmp_buffer;
+        this->filled_tmp_buffers = this->checkpoint_segments.size();
+        this->valid_count = this->checkpoint_segments[0].count;
+        this->SetBufferOffset(this->checkpoint_segments[0].offset);
+    }
     return err;
 }
 
+// Internal function that empties the temporary buffers, so the next
+// request generates from the current states. Kernels refilling them must
+// have finished.
+void clRAND::DropBufferedNumbers() {
+    this->filled_tmp_buffers = 0;
+    this->valid_count = 0;
+    this->SetBufferOffset(0);
+    if (this->conc_slots != NULL) {
+        this->ResetConcurrentSlots();
+    }
+}
+
 // Internal function that generates random stream
 // in the stream object by calling the kernel.
 cl_int clRAND::FillBuffer() {
-    // Set up kernel to generate random bitstream
+    cl_event event;
+    cl_int err = this->EnqueueFillBuffer(0, NULL, &event);
+    if (err) {
+        return err;
+    }
+    err = clWaitForEvents(1, &event);
+    clReleaseEvent(event);
+    if (err) {
+        std::cout << "ERROR: unable to wait for kernel to generate bitstream to finish!" << std::endl;
+    }
 #ifdef DEBUG1
-    std::cout << "Setting total number of generators for kernel argument" << std::endl;
+    std::cout << "Buffer of stream object is filled" << std::endl;
 #endif
-    cl_int err = this->generate_bitstream.setArg<uint>(0, (uint)(this->total_count));
+    return err;
+}
+
+// Internal function that enqueues the kernel generating random stream
+// in the stream object. The kernel starts after the events in wait_list
+// and does not block the host.
+cl_int clRAND::EnqueueFillBuffer(cl_uint num_wait_events, const cl_event* wait_list, cl_event* event) {
+    // The refill must also wait for the last copy out of the buffer
+    std::vector<cl_event> events(wait_list, wait_list + num_wait_events);
+    if (this->tmpDrainEvents[this->cur_tmp_buffer] != NULL) {
+        events.push_back(this->tmpDrainEvents[this->cur_tmp_buffer]);
+    }
+    cl_event fill_event;
+    cl_int err = this->EnqueueGenerate(this->tmpOutputBuffers[this->cur_tmp_buffer](), 0, this->tmpBufferCounts[this->cur_tmp_buffer], (cl_uint)(events.size()), events.empty() ? NULL : &events[0], &fill_event);
     if (err) {
-        std::cout << "ERROR: Unable to set first argument to kernel to generate bitstream!" << std::endl;
         return err;
     }
+    if (this->tmpFillEvents[this->cur_tmp_buffer] != NULL) {
+        clReleaseEvent(this->tmpFillEvents[this->cur_tmp_buffer]);
+    }
+    this->tmpFillEvents[this->cur_tmp_buffer] = fill_event;
+    if (event != NULL) {
+        clRetainEvent(fill_event);
+        *event = fill_event;
+    }
+    return err;
+}
+
+// Internal function that enqueues the kernel generating num random numbers
+// straight into res, starting at entry res_offset. num should be a multiple
+// of the number of PRNGs so that every PRNG advances by the same amount.
+// All kernels advancing the PRNG states run on the refill queue, which
+// keeps them in order.
+cl_int clRAND::EnqueueGenerate(cl_mem res, size_t res_offset, size_t num, cl_uint num_wait_events, const cl_event* wait_list, cl_event* event) {
+    // Set up kernel to generate random bitstream
 #ifdef DEBUG1
     std::cout << "Setting state buffer for kernel argument" << std::endl;
 #endif
-    err = this->generate_bitstream.setArg<cl::Buffer>(1, this->stateBuffer);
+    cl_int err = this->generate_bitstream.setArg<cl::Buffer>(1, this->stateBuffer);
     if (err) {
         std::cout << "ERROR: Unable to set second argument to kernel to generate bitstream!" << std::endl;
         return err;
@@ -781,33 +3403,182 @@ cl_int clRAND::FillBuffer() {
 #ifdef DEBUG1
     std::cout << "Setting output buffer for kernel argument" << std::endl;
 #endif
-    err = this->generate_bitstream.setArg<cl::Buffer>(2, this->tmpOutputBuffer);
+    err = this->generate_bitstream.setArg<cl_mem>(2, res);
     if (err) {
         std::cout << "ERROR: Unable to set third argument to kernel to generate bitstream!" << std::endl;
         return err;
     }
+    err = this->generate_bitstream.setArg<cl_uint>(4, (cl_uint)(this->GetNumberOfRNGs()));
+    if (err) {
+        std::cout << "ERROR: Unable to set fifth argument to kernel to generate bitstream!" << std::endl;
+        return err;
+    }
+    if (this->GetLocalStateSize() > 0) {
+        err = clSetKernelArg(this->generate_bitstream(), 8, this->GetLocalStateSize(), NULL);
+        if (err) {
+            std::cout << "ERROR: Unable to set ninth argument to kernel to generate bitstream!" << std::endl;
+            return err;
+        }
+    }
 
-    // Execute kernel to generate random bitstream
-    cl::Event event;
+    // In persistent mode, requests that would be split over several
+    // launches are served by one launch instead, which loads and stores
+    // the PRNG states only once
+    size_t granularity = this->GetFillGranularity();
+    if (this->persistent_kernel && (this->generate_persistent() != NULL) && (num > this->GetMaxLaunchCount()) && (num % granularity == 0)) {
+        return this->EnqueueGeneratePersistent(res, res_offset, num, num_wait_events, wait_list, event);
+    }
+
+    // Large requests are split into launches of at most max_launch_count
+    // entries. Each launch but the last is a whole multiple of the number
+    // of PRNGs, so the split does not change the stream. Launches run in
+    // order on the refill queue, so only the first one waits on wait_list.
+    size_t global_size = this->GetLaunchSize();
+    size_t local_size = (size_t)(this->wkgrp_size);
+    size_t launch_count = (this->GetMaxLaunchCount() / granularity) * granularity;
+    if (launch_count == 0) {
+        launch_count = granularity;
+    }
+    size_t done = 0;
+    do {
+        size_t chunk = (num - done < launch_count) ? (num - done) : launch_count;
+        bool first = (done == 0);
+        cl_kernel kernel = this->generate_bitstream();
+
+        // Fills of the temporary buffers have a fixed size, and may use the
+        // kernel specialized to that size
+        cl::Kernel* fixed = (this->specialized_kernels && (chunk == this->total_count)) ? this->GetFixedKernel(chunk) : NULL;
+        if (fixed != NULL) {
+            err = (*fixed).setArg<cl::Buffer>(0, this->stateBuffer);
+            if (err == 0) {
+                err = (*fixed).setArg<cl_mem>(1, res);
+            }
+            if (err == 0) {
+                err = (*fixed).setArg<cl_ulong>(2, (cl_ulong)(res_offset + done));
+            }
+            if (err == 0) {
+                err = this->SetSeedArgs(*fixed, 3);
+            }
+            if (err == 0) {
+                err = this->SetTransformArgs(*fixed, 6, this->generated_count);
+            }
+            if (err) {
+                std::cout << "ERROR: Unable to set arguments to specialized kernel to generate bitstream!" << std::endl;
+                return err;
+            }
+            kernel = (*fixed)();
+        } else {
+#ifdef DEBUG1
+            std::cout << "Setting total number of generators for kernel argument" << std::endl;
+#endif
+            err = this->generate_bitstream.setArg<uint>(0, (uint)(chunk));
+            if (err) {
+                std::cout << "ERROR: Unable to set first argument to kernel to generate bitstream!" << std::endl;
+                return err;
+            }
+            err = this->generate_bitstream.setArg<cl_ulong>(3, (cl_ulong)(res_offset + done));
+            if (err) {
+                std::cout << "ERROR: Unable to set fourth argument to kernel to generate bitstream!" << std::endl;
+                return err;
+            }
+            err = this->SetSeedArgs(this->generate_bitstream, 5);
+            if (err) {
+                return err;
+            }
+            err = this->SetTransformArgs(this->generate_bitstream, (this->GetLocalStateSize() > 0) ? 9 : 8, this->generated_count);
+            if (err) {
+                return err;
+            }
+        }
+
+        // Execute kernel to generate random bitstream
 #ifdef DEBUG1
-    std::cout << "Executing kernel" << std::endl;
+        std::cout << "Executing kernel" << std::endl;
 #endif
-    err = this->com_queue.enqueueNDRangeKernel(this->generate_bitstream, cl::NDRange(0), cl::NDRange((size_t)(this->wkgrp_count * this->wkgrp_size)), cl::NDRange((size_t)(this->wkgrp_size)), NULL, &event);
+        done += chunk;
+        err = clEnqueueNDRangeKernel(this->refill_queue_id, kernel, 1, NULL, &global_size, &local_size, first ? num_wait_events : 0, first ? wait_list : NULL, (done == num) ? event : NULL);
+        if (err) {
+            std::cout << "ERROR: Unable to enqueue kernel to generate bitstream!" << std::endl;
+            return err;
+        }
+        this->seed_pending = false;
+        this->host_state_stale = true;
+        this->fill_count++;
+        this->generated_count += chunk;
+    } while (done < num);
+    return err;
+}
+
+// Internal function that enqueues the persistent generate kernel, writing
+// all num random numbers to res in a single launch. num must be a multiple
+// of the fill granularity.
+cl_int clRAND::EnqueueGeneratePersistent(cl_mem res, size_t res_offset, size_t num, cl_uint num_wait_events, const cl_event* wait_list, cl_event* event) {
+    // Largest multiple of the fill granularity indexable with 32 bits
+    size_t granularity = this->GetFillGranularity();
+    size_t chunk = ((((size_t)(1) << 31)) / granularity) * granularity;
+    cl_int err = this->generate_persistent.setArg<cl_ulong>(0, (cl_ulong)(num));
     if (err) {
-        std::cout << "ERROR: Unable to enqueue kernel to generate bitstream!" << std::endl;
+        std::cout << "ERROR: Unable to set first argument to persistent kernel to generate bitstream!" << std::endl;
         return err;
     }
-    std::vector<cl::Event> eventList = { event };
-    err = cl::WaitForEvents(eventList);
+    err = this->generate_persistent.setArg<cl::Buffer>(1, this->stateBuffer);
     if (err) {
-        std::cout << "ERROR: unable to wait for copy state from host to device to finish!" << std::endl;
+        std::cout << "ERROR: Unable to set second argument to persistent kernel to generate bitstream!" << std::endl;
+        return err;
     }
-#ifdef DEBUG1
-    std::cout << "Buffer of stream object is filled" << std::endl;
-#endif
+    err = this->generate_persistent.setArg<cl_mem>(2, res);
+    if (err) {
+        std::cout << "ERROR: Unable to set third argument to persistent kernel to generate bitstream!" << std::endl;
+        return err;
+    }
+    err = this->generate_persistent.setArg<cl_ulong>(3, (cl_ulong)(res_offset));
+    if (err) {
+        std::cout << "ERROR: Unable to set fourth argument to persistent kernel to generate bitstream!" << std::endl;
+        return err;
+    }
+    err = this->generate_persistent.setArg<cl_uint>(4, (cl_uint)(chunk));
+    if (err) {
+        std::cout << "ERROR: Unable to set fifth argument to persistent kernel to generate bitstream!" << std::endl;
+        return err;
+    }
+    err = this->generate_persistent.setArg<cl_uint>(5, (cl_uint)(this->GetNumberOfRNGs()));
+    if (err) {
+        std::cout << "ERROR: Unable to set sixth argument to persistent kernel to generate bitstream!" << std::endl;
+        return err;
+    }
+    err = this->SetSeedArgs(this->generate_persistent, 6);
+    if (err) {
+        return err;
+    }
+    err = this->SetTransformArgs(this->generate_persistent, 9, this->generated_count);
+    if (err) {
+        return err;
+    }
+    size_t global_size = this->GetLaunchSize();
+    size_t local_size = (size_t)(this->wkgrp_size);
+    err = clEnqueueNDRangeKernel(this->refill_queue_id, this->generate_persistent(), 1, NULL, &global_size, &local_size, num_wait_events, wait_list, event);
+    if (err) {
+        std::cout << "ERROR: Unable to enqueue persistent kernel to generate bitstream!" << std::endl;
+        return err;
+    }
+    this->seed_pending = false;
+    this->host_state_stale = true;
+    this->fill_count++;
+    this->generated_count += num;
     return err;
 }
 
+// Number of bytes of local memory needed per workgroup by the kernels
+// of PRNGs that share their state within a workgroup
+size_t clRAND::GetLocalStateSize() {
+    if (this->rng_type == CLRAND_GENERATOR_XORSHIFT1024) {
+        // One word per workitem, plus padding of WORDSHIFT + 1 words
+        // around the words of every warp of 32 workitems
+        return sizeof(xorshift1024_state) * ((32 + 10 + 1) * (size_t)(this->wkgrp_size / 32) + 10 + 1);
+    }
+    return 0;
+}
+
 void clRAND::SetSeed(ulong seed) {
     this->seedVal = seed;
     this->seeded = false;
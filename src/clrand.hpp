@@ -1,6 +1,10 @@
+#include <atomic>
+#include <cstring>
 #include <iostream>
 #include <map>
+#include <mutex>
 #include <string>
+#include <vector>
 
 #define __CL_ENABLE_EXCEPTIONS
 #define CL_USE_DEPRECATED_OPENCL_1_2_APIS
@@ -27,6 +31,8 @@
 #include "../generator/ran2.hpp"
 #include "../generator/tinymt32.hpp"
 #include "../generator/tinymt64.hpp"
+#include "../generator/tinymt32_params.hpp"
+#include "../generator/tinymt64_params.hpp"
 #include "../generator/tyche.hpp"
 #include "../generator/tyche_i.hpp"
 #include "../generator/well512.hpp"
@@ -76,6 +82,82 @@ enum clrandRngType {
     CLRAND_GENERATOR_XORSHIFT6432STAR = 21
 };
 
+// Order in which the numbers of the work-items are laid out in the stream
+enum clrandLayout {
+    CLRAND_LAYOUT_AUTO                = 0, // Blocked on CPU devices, interleaved otherwise
+    CLRAND_LAYOUT_INTERLEAVED         = 1, // Consecutive numbers come from consecutive work-items
+    CLRAND_LAYOUT_BLOCKED             = 2  // Each work-item writes a cache line of consecutive numbers per round
+};
+
+// Derivation of the seeds of the PRNG instances from the seed value
+enum clrandSeedScheme {
+    CLRAND_SEED_LEGACY                = 0, // Seed of instance i is (i << 1) + seed value
+    CLRAND_SEED_SPLITMIX64            = 1  // SplitMix64 hash of the seed value, stream id and instance
+};
+
+// Statistics on the temporary buffers of a stream object
+typedef struct {
+    size_t tmp_buffer_entries;   // Number of entries new fills of a temporary buffer hold
+    size_t tmp_buffer_bytes;     // Device memory currently held by all temporary buffers
+    size_t resize_count;         // Number of times temporary buffers were reallocated
+    size_t fill_count;           // Number of generate kernels launched
+    size_t request_count;        // Number of requests served
+    size_t last_request_fills;   // Number of generate kernels launched for the last request
+} clrandStreamStats;
+
+// Statistics on the caches of compiled programs, shared by all stream objects
+typedef struct {
+    size_t memory_hits;          // Programs found already compiled in this process
+    size_t disk_hits;            // Programs loaded from binaries in the cache directory
+    size_t disk_misses;          // Programs not found (or not usable) in the cache directory
+    size_t source_builds;        // Programs built from source
+    double load_seconds;         // Time spent loading programs from binaries
+    double build_seconds;        // Time spent building programs from source
+    size_t il_loads;             // Programs created from the SPIR-V embedded in the library
+} clrandCacheStats;
+
+// Work configuration of the generate kernels of a stream
+typedef struct {
+    size_t wkgrp_size;           // Number of work-items per work-group
+    size_t wkgrp_count;          // Number of work-groups
+    size_t buf_mult;             // Smallest number of entries per work-item in each fill of a temporary buffer
+    double seconds;              // Time of the autotuner benchmark with this configuration
+} clrandWorkConfig;
+
+// Temporary buffer of a stream object in concurrent mode. The stream is cut
+// into windows of the size of a temporary buffer, and window w is generated
+// into temporary buffer w % num_tmp_buffers.
+struct clrandConcurrentSlot {
+    std::atomic<cl_ulong> window;          // Index plus one of the window held, or zero when not filled
+    std::atomic<size_t>   consumed;        // Number of entries of the window copied out so far
+    cl_event              fill_event;      // Generate kernel that filled the window
+};
+
+// Numbers of a temporary buffer not yet handed out when the PRNG states
+// were checkpointed
+struct clrandCheckpointSegment {
+    size_t                buffer;          // Temporary output buffer holding the numbers
+    size_t                offset;          // Entry of the first number in the temporary output buffer
+    size_t                count;           // Number of numbers not yet handed out
+    size_t                size;            // Number of entries the temporary output buffer was filled with
+};
+
+// Generate kernel specialized at build time for one fill size
+struct clrandFixedKernel {
+    cl::Kernel            kernel;          // Kernel, or NULL if the variant failed to build
+    std::string           program_key;     // Key of its program in the shared program cache
+    size_t                num;             // Number of entries per fill the kernel was built for, or zero
+    size_t                global_size;     // Number of work-items the kernel was built for
+    size_t                num_generators;  // Number of PRNG instances the kernel was built for
+};
+
+// Value of an extra kernel argument of the transform
+struct clrandTransformArg {
+    size_t                size;            // Size in bytes of the argument
+    std::vector<unsigned char> value;      // Value of the argument, empty for local memory
+    bool                  set;             // Flag for whether the argument has been set
+};
+
 // Prototype class
 CLRAND_DLL class clRAND {
     private:
@@ -88,26 +170,100 @@ CLRAND_DLL class clRAND {
         cl::CommandQueue  com_queue;           // OpenCL C++ API
         cl_command_queue  com_queue_id;        // OpenCL C API (to support buffer copy)
 
+        cl::CommandQueue  refill_queue;        // OpenCL C++ API
+        cl_command_queue  refill_queue_id;     // OpenCL C API (to refill temporary buffers in the background)
+        bool              share_queue;         // Flag for whether to use the queues shared by streams on the same device
+        bool              queue_shared;        // Flag for whether the queues were taken from the shared queue cache
+
         cl::Program       rng_program;         // OpenCL C++ API
+        std::string       program_key;         // Key of the program in the shared program cache
+        std::string       build_options;       // Extra options passed when building the programs
+        bool              specialized_kernels; // Flag for whether temporary buffer fills use kernels specialized to their size
+        size_t            unroll_factor;       // Number of store rounds unrolled in the specialized kernels
+        clrandFixedKernel fixed_kernel;        // Specialized kernel for the current fill size of the temporary buffers
+        bool              vector_stores;       // Flag for whether work-items write runs of numbers with vector stores
+        bool              instance_params;     // Flag for whether PRNGs with parameter sets use one set per instance
+        clrandLayout      layout;              // Requested layout of the numbers of the work-items in the stream
+        clrandSeedScheme  seed_scheme;         // Derivation of the seeds of the PRNG instances from the seed value
+        cl_ulong          stream_id;           // Stream id hashed into the seeds of the PRNG instances
+        bool              lazy_seeding;        // Flag for whether seeding is left to the first generate launch
+        bool              seed_pending;        // Flag for whether the next generate launch seeds the states
+        ulong             seeding_val;         // Seed value the states are (or are pending to be) seeded from
+        clrandSeedScheme  seeding_scheme;      // Seed scheme the states are (or are pending to be) seeded with
+        cl_ulong          seeding_stream_id;   // Stream id the states are (or are pending to be) seeded with
+        bool              persistent_kernel;   // Flag for whether large requests are served by a single kernel launch
+        std::string       transform_source;    // OpenCL C source defining clrand_transform, applied to numbers before they are stored
+        std::string       transform_params;    // Extra kernel parameters passed on to clrand_transform
+        std::vector<std::string> transform_arg_names;      // Names of the extra kernel parameters
+        std::vector<clrandTransformArg> transform_args;    // Values of the extra kernel arguments
+        cl_ulong          generated_count;     // Number of numbers generated since the PRNGs were seeded
+        cl_ulong          checkpoint_count;    // Number of numbers generated up to the last checkpoint of the states
+        std::vector<clrandCheckpointSegment> checkpoint_segments; // Numbers buffered but not handed out at the last checkpoint
+        cl::Buffer        checkpointBuffer;    // OpenCL C++ API (copy of the numbers of the checkpoint segments)
+        size_t            checkpoint_capacity; // Number of entries the checkpoint buffer can hold
+        size_t            checkpoint_tmp_buffer; // Temporary output buffer numbers were copied from at the last checkpoint
+        cl_ulong          checkpoint_position; // Concurrent mode: next position of the stream at the last checkpoint
+        cl_ulong          checkpoint_window;   // Concurrent mode: next window of the stream at the last checkpoint
+        std::string       device_source;       // Source of the device API of the PRNG, for user kernels
+        size_t            run_length;          // Number of consecutive numbers each work-item writes per round
+        size_t            vector_width;        // Number of numbers written by each store in the kernels
         cl::Kernel        seed_rng;            // OpenCL C++ API
+        cl::Kernel        seed_rng_array;      // Kernel seeding each PRNG from its own seed
         cl::Kernel        generate_bitstream;  // OpenCL C++ API
+        cl::Kernel        generate_persistent; // OpenCL C++ API (serves a whole request in one launch)
+        cl::Kernel        scatter_batch;       // Kernel scattering a batch to its destinations
 
         cl::Buffer        stateBuffer;         // OpenCL C++ API
         cl_mem            stateBuffer_id;      // OpenCL C API (to support buffer copy)
 
-        cl::Buffer        tmpOutputBuffer;     // OpenCL C++ API
-        cl_mem            tmpOutputBuffer_id;  // OpenCL C API (to support buffer copy)
+        std::vector<cl::Buffer> tmpOutputBuffers;  // Ring of temporary output buffers
+        std::vector<cl_event>   tmpFillEvents;     // Last refill of each temporary output buffer
+        std::vector<cl_event>   tmpDrainEvents;    // Last copy out of each temporary output buffer
+        std::vector<size_t>     tmpBufferCounts;   // Number of entries each temporary output buffer was last filled with
+        std::vector<size_t>     tmpBufferCapacity; // Number of entries each temporary output buffer can hold
+        size_t            num_tmp_buffers;     // Number of temporary output buffers in the ring
+        size_t            cur_tmp_buffer;      // Temporary output buffer numbers are copied from
+        size_t            filled_tmp_buffers;  // Number of temporary output buffers holding numbers, from cur_tmp_buffer on
 
         size_t            state_size;          // Information for PRNG state
         bool              loaded_state;        // Flag for whether PRNG states are loaded to device
         void *            local_state_mem;     // Host side storage of PRNG state
+        bool              host_state_stale;    // Flag for whether device side PRNG states advanced past the host copy
 
-        size_t            total_count;         // Information for temporary output buffer
-        size_t            valid_count;         // Information for temporary output buffer
+        size_t            total_count;         // Information for temporary output buffer (entries in each buffer)
+        size_t            valid_count;         // Information for temporary output buffer (entries left in current buffer)
         size_t            offset;              // Information for temporary output buffer
 
+        cl::Buffer        stagingBuffer;       // OpenCL C++ API (pinned host memory for host destinations)
+        size_t            staging_capacity;    // Number of entries the pinned staging buffer can hold
+        int               host_unified;        // Whether device shares memory with the host (-1 if not queried yet)
+
+        cl::Buffer        batchBuffer;         // OpenCL C++ API (contiguous range of a batch before it is scattered)
+        size_t            batch_capacity;      // Number of entries the batch buffer can hold
+
+        bool              concurrent;          // Flag for whether several host threads may generate from the stream
+        clrandConcurrentSlot* conc_slots;      // Temporary buffers in concurrent mode
+        std::atomic<cl_ulong> stream_position; // Concurrent mode: next position of the stream to be reserved
+        cl_ulong          next_fill_window;    // Concurrent mode: next window of the stream to be generated
+        std::mutex        refill_mutex;        // Concurrent mode: held by the thread refilling temporary buffers
+
+        bool              adaptive_tmp_size;   // Flag for whether temporary buffers are resized to observed request sizes
+        size_t            min_count;           // Smallest number of entries in a temporary buffer
+        size_t            tmp_budget;          // Upper limit in bytes of device memory used by all temporary buffers
+        size_t            request_histogram[64]; // Number of recent requests by power of two of their size
+        size_t            request_total;       // Number of recent requests in the histogram
+        size_t            resize_count;        // Statistics: number of times temporary buffers were reallocated
+        size_t            fill_count;          // Statistics: number of generate kernels launched
+        size_t            request_count;       // Statistics: number of requests served
+        size_t            last_request_fills;  // Statistics: number of generate kernels launched for the last request
+
         cl_uint           wkgrp_size;          // For kernel launch configuration
+        size_t            max_launch_count;    // Upper limit on the number of entries generated by one kernel launch
+        size_t            buf_mult;            // Smallest number of entries per work-item in each fill of a temporary buffer
+        clrandWorkConfig  work_config;         // Requested work configuration (zero fields for the profile or default)
+        std::string       work_config_report;  // How the work configuration was chosen
         cl_uint           wkgrp_count;         // For kernel launch configuration
+        size_t            num_generators;      // Number of PRNG instances, or zero for one per work-item
 
         clrandRngType     rng_type;            // Name of PRNG
         std::string       rng_name;            // Name of PRNG
@@ -126,7 +282,6 @@ CLRAND_DLL class clRAND {
         void LookupPRNG();
         void generateBufferKernel(std::string type);
         cl_int fillBuffer();
-        void SetStateSize();
         cl_int PrivateGenerateStream(); // To implement
 
     public:
@@ -137,24 +292,94 @@ CLRAND_DLL class clRAND {
         cl_device_id GetStreamDevice() { return device_id; }
         cl_context GetStreamContext() { return context_id; }
         cl_command_queue GetStreamQueue() { return com_queue_id; }
+        cl_command_queue GetRefillQueue() { return refill_queue_id; }
+        cl_kernel GetGenerateKernel() { return generate_bitstream(); }
 
         void BuildSource();
+        std::string GetPRNGSource();
+        const char* GetDeviceSource();
+        cl_int GetStateBuffer(cl_mem* state);
+        void UpdateRunLength();
+        std::string GetRunStoreSource(std::string type, std::string indent);
+        std::string GetTransformParams();
+        std::string GetTransformSource(std::string value, std::string index);
+        int SetTransform(const char* source, const char* params);
+        int SetTransformArg(size_t index, size_t size, const void* value);
+        cl_int SetTransformArgs(cl::Kernel& kernel, cl_uint first, cl_ulong position);
+        int SetVectorStores(bool enable);
+        int SetInstanceParams(bool enable);
+        bool HasInstanceParams();
+        std::string GetSeedSource(std::string seed);
+        int SetLayout(clrandLayout layout_);
+        clrandLayout GetLayout();
+        size_t GetRunLength() { return this->run_length; }
+        size_t GetFillGranularity() { return (this->GetNumberOfRNGs() * this->run_length); }
         std::string GetSource() { return this->rng_source; }
 
         cl_int BuildKernelProgram();
+        void ReleaseProgram();
+        std::string GetBuildArgs();
+        cl_int AcquireProgram(const std::string& build_args, cl::Program* program, std::string* key);
+        cl::Kernel* GetFixedKernel(size_t num);
+        void BuildFixedKernel(size_t num);
+        void ReleaseFixedKernel();
+        void SetBuildOptions(const char* options) { this->build_options = (options != NULL) ? std::string(options) : std::string(); }
+        void SetSpecializedKernels(bool enable) { this->specialized_kernels = enable; }
+        int SetUnrollFactor(size_t unroll);
+        std::string GetBinaryCacheKey(const std::string& build_args);
+        cl_int LoadProgramBinary(const std::string& path, const std::string& key, const std::string& build_args, cl::Program* program);
+        void StoreProgramBinary(const std::string& path, const std::string& key, const cl::Program& program);
+        cl_int LoadProgramIL(const std::string& build_args, cl::Program* program);
+        void ReleaseQueues();
+        void SetShareQueue(bool share) { this->share_queue = share; }
+        bool IsQueueShared() { return this->queue_shared; }
         cl_int ReadyGenerator();
         cl_int SetupWorkConfigurations();
-        cl_int SeedGenerator();
-        size_t GetNumberOfRNGs() { return (this->wkgrp_size * this->wkgrp_count); }
+        void SetWorkConfig(size_t wkgrp_size_, size_t wkgrp_count_, size_t buf_mult_);
+        const char* GetWorkConfig(clrandWorkConfig* config);
+        std::string GetWorkConfigKey();
+        cl_int SeedGenerator(cl_mem seeds = NULL);
+        cl_int LaunchSeedKernel(cl_mem seeds);
+        cl_int ResolvePendingSeed();
+        cl_int SetSeedArgs(cl::Kernel& kernel, cl_uint first);
+        int SetLazySeeding(bool enable);
+        size_t GetNumberOfRNGs() { return (this->num_generators > 0) ? this->num_generators : (size_t)(this->wkgrp_size * this->wkgrp_count); }
+        size_t GetLaunchSize();
+        int SetNumGenerators(size_t num);
 
         cl_int SetupStreamBuffers(size_t bufMult, size_t numPRNGs);
         cl_int FillBuffer();
+        cl_int EnqueueFillBuffer(cl_uint num_wait_events, const cl_event* wait_list, cl_event* event);
+        cl_int EnqueueGenerate(cl_mem res, size_t res_offset, size_t num, cl_uint num_wait_events, const cl_event* wait_list, cl_event* event);
+        cl_int EnqueueGeneratePersistent(cl_mem res, size_t res_offset, size_t num, cl_uint num_wait_events, const cl_event* wait_list, cl_event* event);
+        void SetPersistentKernel(bool enable) { this->persistent_kernel = enable; }
+        cl_int RefillTmpBuffers();
+        cl_int ResizeTmpBuffer(size_t idx);
+        void RecordRequestSize(size_t count);
+        size_t GetPrecisionSize();
+        void SetAdaptiveTmpSize(bool adaptive) { this->adaptive_tmp_size = adaptive; }
+        void SetTmpBufferBudget(size_t bytes) { this->tmp_budget = bytes; }
+        void GetStreamStats(clrandStreamStats* stats);
+        cl_int FinishRefills();
+        size_t GetNumTmpBuffers() { return this->num_tmp_buffers; }
+        int SetNumTmpBuffers(size_t num);
+        size_t GetLocalStateSize();
+        size_t GetMaxLaunchCount() { return this->max_launch_count; }
+        int SetMaxLaunchCount(size_t num);
 
         bool GetStateOfStateBuffer() { return this->loaded_state; }
         size_t GetStateStructSize() { return this->state_size; }
-        size_t GetStateBufferSize() { return (this->state_size * this->wkgrp_size * this->wkgrp_count); }
+        void SetStateSize();
+        size_t GetStateBufferSize() { return (this->state_size * this->GetNumberOfRNGs()); }
         cl_int CopyStateToDevice();
         cl_int CopyStateToHost(void* hostPtr);
+        cl_int SyncStateToHost();
+        cl_int CheckpointState(void* hostPtr);
+        cl_int RestoreState(const void* hostPtr);
+        void DropBufferedNumbers();
+        cl_int SaveBufferedNumbers();
+        cl_int LoadBufferedNumbers();
+        bool IsHostStateStale() { return this->host_state_stale; }
         void* GetHostStatePtr() { return this->local_state_mem; }
 
         size_t GetNumBufferEntries() { return this->total_count; }
@@ -175,6 +400,10 @@ CLRAND_DLL class clRAND {
 
         ulong GetSeed() { return this->seedVal; }
         void SetSeed(ulong seed);
+        cl_int SeedFromArray(const cl_ulong* seeds, size_t num);
+        int SetSeedScheme(clrandSeedScheme scheme);
+        void SetStreamId(cl_ulong id) { this->stream_id = id; }
+        cl_int SeedFromBuffer(cl_mem seeds, size_t num);
 
         bool IsInitialized() { return this->init_flag; }
         bool IsSourceReady() { return this->source_ready; }
@@ -183,6 +412,17 @@ CLRAND_DLL class clRAND {
         bool IsSeeded() { return this->seeded; }
 
 	cl_int CopyBufferEntries(cl_mem dst, size_t dst_offset, size_t count);
+        cl_int EnqueueCopyBufferEntries(cl_mem dst, size_t dst_offset, size_t count, cl_uint num_wait_events, const cl_event* wait_list, cl_event* event);
+        cl_int GenerateStream(size_t count, cl_mem dst, cl_uint num_wait_events, const cl_event* wait_list, cl_event* event);
+        cl_int GenerateHost(size_t count, void* dst);
+        cl_int GenerateBatch(size_t n, const cl_mem* dsts, const size_t* offsets, const size_t* counts);
+        bool IsHostUnified();
+        int SetConcurrent(bool enable);
+        bool IsConcurrent() { return this->concurrent; }
+        cl_int GenerateConcurrent(size_t count, cl_mem dst, cl_ulong* position);
+        cl_int RefillConcurrentSlots();
+        cl_int ReleaseConcurrentCopies(std::vector<cl_event>& events, std::vector<size_t>& slots, std::vector<size_t>& counts);
+        void ResetConcurrentSlots();
         bool SetReady() { this->generator_ready = true; }
 
 };
@@ -195,6 +435,26 @@ CLRAND_DLL clRAND* clrand_create_stream();
 
 CLRAND_DLL cl_int clrand_initialize_prng(clRAND* p, cl_device_id dev_id, cl_context ctx_id, clrandRngType rng_type_);
 
+CLRAND_DLL void clrand_set_shared_queue(clRAND* p, int enable) {
+    (*p).SetShareQueue(enable != 0);
+}
+
+CLRAND_DLL size_t clrand_get_num_cached_programs();
+
+CLRAND_DLL void clrand_set_cache_dir(const char* path);
+
+CLRAND_DLL void clrand_get_cache_stats(clrandCacheStats* stats);
+
+CLRAND_DLL cl_int clrand_autotune(cl_device_id dev_id, cl_context ctx_id, clrandRngType rng_type, const char* precision, clrandWorkConfig* best);
+
+CLRAND_DLL void clrand_set_work_config(clRAND* p, size_t wkgrp_size, size_t wkgrp_count, size_t buf_mult) {
+    (*p).SetWorkConfig(wkgrp_size, wkgrp_count, buf_mult);
+}
+
+CLRAND_DLL const char * clrand_get_work_config(clRAND* p, clrandWorkConfig* config) {
+    return (*p).GetWorkConfig(config);
+}
+
 CLRAND_DLL const char * clrand_get_prng_precision(clRAND* p) {
     return (*p).GetPrecision().c_str();
 }
@@ -218,11 +478,127 @@ CLRAND_DLL void clrand_set_prng_seed(clRAND* p, ulong seedNum) {
     (*p).SetSeed(seedNum);
 }
 
+CLRAND_DLL int clrand_set_seed_scheme(clRAND* p, clrandSeedScheme scheme) {
+    return (*p).SetSeedScheme(scheme);
+}
+
+CLRAND_DLL void clrand_set_stream_id(clRAND* p, cl_ulong id) {
+    (*p).SetStreamId(id);
+}
+
+CLRAND_DLL cl_int clrand_seed_from_array(clRAND* p, const cl_ulong* seeds, size_t num) {
+    return (*p).SeedFromArray(seeds, num);
+}
+
+CLRAND_DLL cl_int clrand_seed_from_buffer(clRAND* p, cl_mem seeds, size_t num) {
+    return (*p).SeedFromBuffer(seeds, num);
+}
+
+CLRAND_DLL int clrand_set_lazy_seeding(clRAND* p, int enable) {
+    return (*p).SetLazySeeding(enable != 0);
+}
+
 CLRAND_DLL cl_int clrand_ready_stream(clRAND* p) {
     return (*p).ReadyGenerator();
 }
 
-CLRAND_DLL cl_int clrand_generate_stream(clRAND* p, int count, cl_mem dst);
+CLRAND_DLL int clrand_set_num_tmp_buffers(clRAND* p, size_t num) {
+    return (*p).SetNumTmpBuffers(num);
+}
+
+CLRAND_DLL void clrand_set_adaptive_tmp_buffers(clRAND* p, int enable) {
+    (*p).SetAdaptiveTmpSize(enable != 0);
+}
+
+CLRAND_DLL int clrand_set_num_generators(clRAND* p, size_t num) {
+    return (*p).SetNumGenerators(num);
+}
+
+CLRAND_DLL int clrand_set_max_launch_count(clRAND* p, size_t num) {
+    return (*p).SetMaxLaunchCount(num);
+}
+
+CLRAND_DLL void clrand_set_build_options(clRAND* p, const char* options) {
+    (*p).SetBuildOptions(options);
+}
+
+CLRAND_DLL void clrand_set_specialized_kernels(clRAND* p, int enable) {
+    (*p).SetSpecializedKernels(enable != 0);
+}
+
+CLRAND_DLL int clrand_set_unroll_factor(clRAND* p, size_t unroll) {
+    return (*p).SetUnrollFactor(unroll);
+}
+
+CLRAND_DLL int clrand_set_vector_stores(clRAND* p, int enable) {
+    return (*p).SetVectorStores(enable != 0);
+}
+
+CLRAND_DLL int clrand_set_instance_params(clRAND* p, int enable) {
+    return (*p).SetInstanceParams(enable != 0);
+}
+
+CLRAND_DLL int clrand_set_layout(clRAND* p, clrandLayout layout) {
+    return (*p).SetLayout(layout);
+}
+
+CLRAND_DLL clrandLayout clrand_get_layout(clRAND* p) {
+    return (*p).GetLayout();
+}
+
+CLRAND_DLL void clrand_set_persistent_kernel(clRAND* p, int enable) {
+    (*p).SetPersistentKernel(enable != 0);
+}
+
+CLRAND_DLL int clrand_set_transform(clRAND* p, const char* source, const char* params) {
+    return (*p).SetTransform(source, params);
+}
+
+CLRAND_DLL int clrand_set_transform_arg(clRAND* p, size_t index, size_t size, const void* value) {
+    return (*p).SetTransformArg(index, size, value);
+}
+
+CLRAND_DLL void clrand_set_tmp_buffer_budget(clRAND* p, size_t bytes) {
+    (*p).SetTmpBufferBudget(bytes);
+}
+
+CLRAND_DLL void clrand_get_stream_stats(clRAND* p, clrandStreamStats* stats) {
+    (*p).GetStreamStats(stats);
+}
+
+CLRAND_DLL cl_int clrand_generate_stream(clRAND* p, size_t count, cl_mem dst);
+
+CLRAND_DLL cl_int clrand_generate_stream_async(clRAND* p, size_t count, cl_mem dst, cl_uint num_wait_events, const cl_event* wait_list, cl_event* out_event);
+
+CLRAND_DLL cl_int clrand_generate_host(clRAND* p, size_t count, void* dst);
+
+CLRAND_DLL int clrand_set_concurrent(clRAND* p, int enable) {
+    return (*p).SetConcurrent(enable != 0);
+}
+
+CLRAND_DLL cl_int clrand_generate_stream_concurrent(clRAND* p, size_t count, cl_mem dst, cl_ulong* position);
+
+CLRAND_DLL cl_int clrand_generate_batch(clRAND* p, size_t n, const cl_mem* dsts, const size_t* offsets, const size_t* counts);
+
+CLRAND_DLL const char * clrand_get_device_source(clRAND* p) {
+    return (*p).GetDeviceSource();
+}
+
+CLRAND_DLL cl_int clrand_get_state_buffer(clRAND* p, cl_mem* state) {
+    return (*p).GetStateBuffer(state);
+}
+
+CLRAND_DLL size_t clrand_get_num_prngs(clRAND* p) {
+    return (*p).GetNumberOfRNGs();
+}
+
+CLRAND_DLL size_t clrand_get_state_size(clRAND* p) {
+    return (*p).GetStateBufferSize();
+}
+
+CLRAND_DLL cl_int clrand_checkpoint_state(clRAND* p, void* hostPtr);
+
+CLRAND_DLL cl_int clrand_restore_state(clRAND* p, const void* hostPtr);
 
 #ifdef __cplusplus
 }
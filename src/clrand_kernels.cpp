@@ -0,0 +1,134 @@
+// Build-time tool for the SPIR-V kernels embedded in the library (make
+// SPIRV=1). It writes the kernel source of every generator, precision,
+// layout and store width, and then turns the SPIR-V compiled from those
+// sources into the table of clrand_spirv.inc. It also writes the device
+// API of each generator as a header for user kernels.
+//
+//   clrand_kernels sources <dir>   writes <dir>/<name>.cl for each source
+//   clrand_kernels embed <dir>     writes the table of <dir>/<name>.spv
+//   clrand_kernels device <dir>    writes <dir>/clrand_<rng>.cl for each generator
+//
+// The library is included as source for its kernel generator and hash, and
+// is built without the embedded table here.
+#include "clrand.cpp"
+
+#include <set>
+
+static const char* precisions[] = { "uint", "ulong", "float", "double" };
+
+struct clrandKernelSource {
+    std::string       name;                // File name of the source, without extension
+    std::string       source;              // Kernel source
+};
+
+// Kernel sources of every combination the library builds at runtime,
+// dropping combinations that give the same source
+static std::vector<clrandKernelSource> listKernelSources() {
+    std::vector<clrandKernelSource> list;
+    std::set<std::pair<cl_ulong, size_t> > seen;
+    for (int rng = CLRAND_GENERATOR_ISAAC; rng <= CLRAND_GENERATOR_XORSHIFT6432STAR; rng++) {
+        for (size_t prec = 0; prec < sizeof(precisions) / sizeof(precisions[0]); prec++) {
+            for (int layout = CLRAND_LAYOUT_INTERLEAVED; layout <= CLRAND_LAYOUT_BLOCKED; layout++) {
+                for (int vector = 0; vector < 2; vector++) {
+                    clRAND stream;
+                    stream.SetRNGType((clrandRngType)(rng));
+                    stream.SetPrecision(precisions[prec]);
+                    stream.SetLayout((clrandLayout)(layout));
+                    stream.SetVectorStores(vector != 0);
+                    stream.BuildSource();
+                    clrandKernelSource entry;
+                    entry.source = stream.GetSource();
+                    if (seen.insert(std::make_pair(clrandHash(entry.source), entry.source.length())).second == false) {
+                        continue;
+                    }
+                    entry.name = stream.GetRNGName() + "_" + precisions[prec]
+                               + ((layout == CLRAND_LAYOUT_BLOCKED) ? "_blocked" : "_interleaved")
+                               + ((vector != 0) ? "_vector" : "");
+                    list.push_back(entry);
+                }
+            }
+        }
+    }
+    return list;
+}
+
+static int writeSources(const std::string& dir) {
+    std::vector<clrandKernelSource> list = listKernelSources();
+    for (size_t i = 0; i < list.size(); i++) {
+        std::string path = dir + "/" + list[i].name + ".cl";
+        std::ofstream file(path.c_str(), std::ios::out | std::ios::binary);
+        file << list[i].source;
+        file.close();
+        if (!file) {
+            std::cout << "ERROR: unable to write " << path << "!" << std::endl;
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int writeTable(const std::string& dir) {
+    std::vector<clrandKernelSource> list = listKernelSources();
+    std::cout << "// Generated by clrand_kernels, do not edit" << std::endl;
+    for (size_t i = 0; i < list.size(); i++) {
+        std::string path = dir + "/" + list[i].name + ".spv";
+        std::ifstream file(path.c_str(), std::ios::in | std::ios::binary);
+        std::string module((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        if ((!file) || module.empty()) {
+            std::cerr << "ERROR: unable to read " << path << "!" << std::endl;
+            return -1;
+        }
+        std::cout << "static const unsigned char clrand_spirv_" << list[i].name << "[] = {";
+        for (size_t j = 0; j < module.size(); j++) {
+            std::cout << ((j % 16 == 0) ? "\n    " : " ") << (unsigned int)((unsigned char)(module[j])) << ",";
+        }
+        std::cout << "\n};" << std::endl;
+    }
+    std::cout << "static const clrandSpirvBlob clrand_spirv_blobs[] = {" << std::endl;
+    for (size_t i = 0; i < list.size(); i++) {
+        std::cout << "    { " << clrandHash(list[i].source) << "ULL, " << list[i].source.length() << ", "
+                  << "clrand_spirv_" << list[i].name << ", sizeof(clrand_spirv_" << list[i].name << ") }," << std::endl;
+    }
+    std::cout << "};" << std::endl;
+    return 0;
+}
+
+static int writeDeviceHeaders(const std::string& dir) {
+    for (int rng = CLRAND_GENERATOR_ISAAC; rng <= CLRAND_GENERATOR_XORSHIFT6432STAR; rng++) {
+        clRAND stream;
+        stream.SetRNGType((clrandRngType)(rng));
+        if (stream.GetLocalStateSize() > 0) {
+            continue;
+        }
+        const char* source = stream.GetDeviceSource();
+        if (source == NULL) {
+            return -1;
+        }
+        std::string path = dir + "/clrand_" + stream.GetRNGName() + ".cl";
+        std::ofstream file(path.c_str(), std::ios::out | std::ios::binary);
+        file << source;
+        file.close();
+        if (!file) {
+            std::cout << "ERROR: unable to write " << path << "!" << std::endl;
+            return -1;
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    if (argc == 3) {
+        std::string mode(argv[1]);
+        if (mode == "sources") {
+            return writeSources(std::string(argv[2]));
+        }
+        if (mode == "embed") {
+            return writeTable(std::string(argv[2]));
+        }
+        if (mode == "device") {
+            return writeDeviceHeaders(std::string(argv[2]));
+        }
+    }
+    std::cerr << "Usage: " << argv[0] << " sources|embed|device <dir>" << std::endl;
+    return -1;
+}
@@ -0,0 +1,182 @@
+// Build-time tool that searches the instance parameter sets of tinymt32 and
+// tinymt64 (see clrand_set_instance_params) in the manner of TinyMTDC, and
+// writes them as generator/tinymt32_params.hpp and
+// generator/tinymt64_params.hpp.
+//
+//   tinymt_dc 32 > ../generator/tinymt32_params.hpp
+//   tinymt_dc 64 > ../generator/tinymt64_params.hpp
+//
+// Candidates (mat1, mat2) are drawn from a fixed SplitMix64 stream, so the
+// tables are reproducible. A candidate is kept when the characteristic
+// polynomial of its recursion is irreducible of degree 127 and differs from
+// those of the sets kept before, and a tmat is found for it by hill climbing
+// from random starts that gives delta 0, i.e. equidistribution up to the
+// upper bound in every dimension (see tinymt_dc.hpp). Candidates for which
+// no such tmat is found are dropped.
+#include "tinymt_dc.hpp"
+
+#include <stdio.h>
+#include <set>
+
+#define TINYMT_DC_NUM_PARAMS 1024
+#define TINYMT_DC_RESTARTS   64
+#define TINYMT_DC_ROWS       256
+
+static uint64_t splitmix_state;
+
+static uint64_t splitmix64() {
+    uint64_t z = (splitmix_state += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+// Searches a tmat giving delta 0 for the outputs of a recursion, and
+// returns the lowest delta found
+static int searchTempering(const tinymtdcOutputs& outputs, uint64_t* tmat) {
+    int width = outputs.width;
+    uint64_t mask = (width == 64) ? ~(uint64_t)(0) : (((uint64_t)(1) << width) - 1);
+    int best = -1;
+    for (int r = 0; (r < TINYMT_DC_RESTARTS) && (best != 0); r++) {
+        uint64_t cur = splitmix64() & mask;
+        int delta = tinymtdcDelta(outputs, cur);
+        bool improved = true;
+        while (improved && (delta > 0)) {
+            improved = false;
+            for (int b = 0; (b < width) && (delta > 0); b++) {
+                uint64_t next = cur ^ ((uint64_t)(1) << b);
+                int d = tinymtdcDelta(outputs, next, delta);
+                if (d < delta) {
+                    cur = next;
+                    delta = d;
+                    improved = true;
+                }
+            }
+        }
+        if ((best < 0) || (delta < best)) {
+            best = delta;
+            *tmat = cur;
+        }
+    }
+    return best;
+}
+
+// Writes the start of a new literal every TINYMT_DC_ROWS rows, to stay
+// within the length limits of some compilers
+static void splitLiteral(int row) {
+    if ((row > 0) && (row % TINYMT_DC_ROWS == 0)) {
+        printf(")EOK\"\nR\"EOK(\n");
+    }
+}
+
+static void writeHeader(int width) {
+    printf("// Parameter sets of tinymt%d for one parameter set per PRNG instance (see\n"
+           "// clrand_set_instance_params), written by src/tinymt_dc. The characteristic\n"
+           "// polynomial of the recursion of each set (mat1, mat2) is irreducible of\n"
+           "// degree 127, so that every instance has the full period 2^127-1, and\n"
+           "// differs from those of the other sets, so that every instance runs its own\n"
+           "// recursion. tmat is tuned so that the outputs are equidistributed up to the\n"
+           "// upper bound in every dimension. The comment on each row gives the weight\n"
+           "// and delta of the set, as in the output of TinyMTDC.\n"
+           "// The table is split over several literals to stay within the length\n"
+           "// limits of some compilers.\n"
+           "const char * tinymt%d_params_kernel =\n"
+           "R\"EOK(\n"
+           "/**\n"
+           "Parameter sets of tinymt%d, one per PRNG instance. Streams with more\n"
+           "instances than sets are rejected when they are readied.\n"
+           "*/\n"
+           "#define TINYMT%d_NUM_PARAMS %d\n\n", width, width, width, width, TINYMT_DC_NUM_PARAMS);
+}
+
+int main(int argc, char** argv) {
+    int width = (argc > 1) ? atoi(argv[1]) : 0;
+    if ((width != 32) && (width != 64)) {
+        fprintf(stderr, "usage: %s 32|64\n", argv[0]);
+        return 1;
+    }
+    splitmix_state = (width == 32) ? 0x74696e796d743332ULL : 0x74696e796d743634ULL;
+
+    std::vector<tinymtdcParams> params;
+    std::vector<tinymtdcResult> results;
+    std::set<tinymtdcPoly> seen;
+    size_t candidates = 0;
+    while (params.size() < TINYMT_DC_NUM_PARAMS) {
+        uint64_t r = splitmix64();
+        tinymtdcParams p;
+        p.mat1 = (uint32_t)(r);
+        p.mat2 = (uint32_t)(r >> 32);
+        p.tmat = 0;
+        candidates++;
+        bool irreducible;
+        tinymtdcPoly f = tinymtdcCharacteristic(width, p, &irreducible);
+        if ((irreducible == false) || (seen.count(f) > 0)) {
+            continue;
+        }
+        tinymtdcOutputs outputs;
+        tinymtdcLinearOutputs(width, p, &outputs);
+        if (searchTempering(outputs, &p.tmat) != 0) {
+            continue;
+        }
+        seen.insert(f);
+        params.push_back(p);
+        results.push_back(tinymtdcAnalyze(width, p));
+    }
+    fprintf(stderr, "%zu sets from %zu candidates\n", params.size(), candidates);
+
+    writeHeader(width);
+    if (width == 32) {
+        printf("__constant uint tinymt32_params[TINYMT32_NUM_PARAMS * 3] = {\n"
+               "// mat1, mat2, tmat, // weight delta\n");
+        for (size_t i = 0; i < params.size(); i++) {
+            splitLiteral((int)(i));
+            printf("0x%08xU,0x%08xU,0x%08xU, // %d %d\n", params[i].mat1, params[i].mat2, (uint32_t)(params[i].tmat), results[i].weight, results[i].delta);
+        }
+        printf("};\n\n"
+               "/**\n"
+               "Seeds tinymt32 RNG with the parameter set of instance id.\n\n"
+               "@param state Variable, that holds state of the generator to be seeded.\n"
+               "@param seed Value used for seeding.\n"
+               "@param id Index of the instance of the generator.\n"
+               "*/\n"
+               "void tinymt32_seed_instance(tinymt32_state* state, ulong seed, uint id){\n"
+               "\tuint p = (id %% TINYMT32_NUM_PARAMS) * 3;\n"
+               "\tstate->mat1=tinymt32_params[p];\n"
+               "\tstate->mat2=tinymt32_params[p + 1];\n"
+               "\tstate->tmat=tinymt32_params[p + 2];\n"
+               "\ttinymt32_init(state, seed);\n"
+               "}\n"
+               ")EOK\";\n");
+    } else {
+        printf("__constant uint tinymt64_mats[TINYMT64_NUM_PARAMS * 2] = {\n"
+               "// mat1, mat2, // weight delta\n");
+        for (size_t i = 0; i < params.size(); i++) {
+            splitLiteral((int)(i));
+            printf("0x%08xU,0x%08xU, // %d %d\n", params[i].mat1, params[i].mat2, results[i].weight, results[i].delta);
+        }
+        printf("};\n"
+               ")EOK\"\n"
+               "R\"EOK(\n"
+               "__constant ulong tinymt64_tmats[TINYMT64_NUM_PARAMS] = {\n");
+        for (size_t i = 0; i < params.size(); i++) {
+            splitLiteral((int)(i));
+            printf("0x%016llxUL,\n", (unsigned long long)(params[i].tmat));
+        }
+        printf("};\n\n"
+               "/**\n"
+               "Seeds tinymt64 RNG with the parameter set of instance id.\n\n"
+               "@param state Variable, that holds state of the generator to be seeded.\n"
+               "@param seed Value used for seeding.\n"
+               "@param id Index of the instance of the generator.\n"
+               "*/\n"
+               "void tinymt64_seed_instance(tinymt64_state* state, ulong seed, uint id){\n"
+               "\tuint p = id %% TINYMT64_NUM_PARAMS;\n"
+               "\tstate->mat1=tinymt64_mats[2 * p];\n"
+               "\tstate->mat2=tinymt64_mats[2 * p + 1];\n"
+               "\tstate->tmat=tinymt64_tmats[p];\n"
+               "\ttinymt64_init(state, seed);\n"
+               "}\n"
+               ")EOK\";\n");
+    }
+    return 0;
+}
@@ -0,0 +1,324 @@
+// Host-side analysis of TinyMT parameter sets, in the manner of TinyMTDC
+// (http://www.math.sci.hiroshima-u.ac.jp/~m-mat/MT/TINYMT/). It is used by
+// the tinymt_dc tool, which searches the tables of instance parameter sets
+// in generator/tinymt32_params.hpp and generator/tinymt64_params.hpp, and
+// by the tests checking every set of those tables.
+//
+// A set (mat1, mat2) is kept when the characteristic polynomial of the
+// recursion is irreducible of degree 127, which gives the full period
+// 2^127-1 as 127 is a Mersenne exponent. tmat is then tuned so that the
+// tempered outputs are equidistributed in as many dimensions as possible:
+// k(v) is the largest k such that the top v bits of k consecutive outputs
+// take every value equally often over the period, bounded by 127 / v, and
+// delta is the sum over v of the dimensions missing from that bound. As in
+// TinyMTDC, the tempering is taken with XOR in place of its addition, and
+// weight is the number of terms of the characteristic polynomial.
+#ifndef CLRAND_TINYMT_DC_HPP
+#define CLRAND_TINYMT_DC_HPP
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#define TINYMT_DC_DEGREE 127
+
+typedef unsigned __int128 tinymtdcPoly;    // Polynomial over GF(2) (bit i is the term x^i), or vector of 128 bits
+
+// Parameter set of tinymt32 or tinymt64
+struct tinymtdcParams {
+    uint32_t              mat1;            // Parameter of the recursion
+    uint32_t              mat2;            // Parameter of the recursion
+    uint64_t              tmat;            // Parameter of the tempering (32 bits for tinymt32)
+};
+
+// Properties of a parameter set
+struct tinymtdcResult {
+    bool                  irreducible;     // Whether the characteristic polynomial is irreducible of degree 127
+    tinymtdcPoly          characteristic;  // Characteristic polynomial of the recursion
+    int                   weight;          // Number of terms of the characteristic polynomial
+    int                   delta;           // Dimensions of equidistribution missing from their upper bounds
+};
+
+// Linear state of tinymt32 (s0 to s3) or tinymt64 (s0 and s1)
+struct tinymtdcState {
+    uint64_t              s[4];
+};
+
+// One step of the recursion followed by the tempering without tmat. out is
+// set to the tempered output before tmat, and sel to the bit that selects
+// whether tmat is added to it.
+static inline void tinymtdcNext(int width, tinymtdcState* t, const tinymtdcParams& p, uint64_t* out, int* sel) {
+    if (width == 32) {
+        uint32_t s0 = (uint32_t)(t->s[0]), s1 = (uint32_t)(t->s[1]), s2 = (uint32_t)(t->s[2]), s3 = (uint32_t)(t->s[3]);
+        uint32_t x = (s0 & 0x7fffffffU) ^ s1 ^ s2;
+        uint32_t y = s3;
+        x ^= x << 1;
+        y ^= (y >> 1) ^ x;
+        s0 = s1;
+        s1 = s2;
+        s2 = x ^ (y << 10);
+        s3 = y;
+        if (y & 1) {
+            s1 ^= p.mat1;
+            s2 ^= p.mat2;
+        }
+        t->s[0] = s0; t->s[1] = s1; t->s[2] = s2; t->s[3] = s3;
+        uint32_t t1 = s0 ^ (s2 >> 8);
+        *out = s3 ^ t1;
+        *sel = (int)(t1 & 1);
+    } else {
+        uint64_t s0 = t->s[0] & 0x7fffffffffffffffULL, s1 = t->s[1];
+        uint64_t x = s0 ^ s1;
+        x ^= x << 12;
+        x ^= x >> 32;
+        x ^= x << 32;
+        x ^= x << 11;
+        s0 = s1;
+        s1 = x;
+        if (x & 1) {
+            s0 ^= p.mat1;
+            s1 ^= (uint64_t)(p.mat2) << 32;
+        }
+        t->s[0] = s0; t->s[1] = s1;
+        uint64_t t1 = (s0 ^ s1) ^ (s0 >> 8);
+        *out = t1;
+        *sel = (int)(t1 & 1);
+    }
+}
+
+// State with only bit i of the 128 bits of the state set
+static inline tinymtdcState tinymtdcUnitState(int width, int i) {
+    tinymtdcState t;
+    memset(&t, 0, sizeof(t));
+    t.s[i / width] = (uint64_t)(1) << (i % width);
+    return t;
+}
+
+// Connection polynomial of the shortest linear recurrence of a sequence of
+// bits (Berlekamp-Massey), returned as its reciprocal, the characteristic
+// polynomial of the recurrence. len is set to its degree.
+static inline tinymtdcPoly tinymtdcMinimalPolynomial(const std::vector<int>& s, int* len) {
+    int n = (int)(s.size());
+    std::vector<int> c(n + 1, 0), b(n + 1, 0), t;
+    c[0] = b[0] = 1;
+    int l = 0, m = -1;
+    for (int i = 0; i < n; i++) {
+        int d = s[i];
+        for (int j = 1; j <= l; j++) {
+            d ^= c[j] & s[i - j];
+        }
+        if (d) {
+            t = c;
+            for (int j = 0; j + i - m <= n; j++) {
+                c[j + i - m] ^= b[j];
+            }
+            if (2 * l <= i) {
+                l = i + 1 - l;
+                m = i;
+                b = t;
+            }
+        }
+    }
+    *len = l;
+    tinymtdcPoly f = 0;
+    for (int j = 0; (j <= l) && (l <= TINYMT_DC_DEGREE); j++) {
+        if (c[j]) {
+            f |= (tinymtdcPoly)(1) << (l - j);
+        }
+    }
+    return f;
+}
+
+// Whether f, of degree 127, is irreducible. As 127 is prime, f is
+// irreducible when x^(2^127) = x mod f and f has no root in GF(2).
+static inline bool tinymtdcIrreducible(tinymtdcPoly f) {
+    tinymtdcPoly top = (tinymtdcPoly)(1) << TINYMT_DC_DEGREE;
+    if (((f & top) == 0) || ((f & 1) == 0)) {
+        return false;
+    }
+    int terms = 0;
+    for (tinymtdcPoly g = f; g != 0; g >>= 1) {
+        terms += (int)(g & 1);
+    }
+    if ((terms & 1) == 0) {
+        return false;
+    }
+    tinymtdcPoly x = 2, r = x;
+    for (int i = 0; i < TINYMT_DC_DEGREE; i++) {
+        // r = r * r mod f
+        tinymtdcPoly a = r, sq = 0;
+        for (int j = TINYMT_DC_DEGREE - 1; j >= 0; j--) {
+            bool high = ((sq >> (TINYMT_DC_DEGREE - 1)) & 1) != 0;
+            sq <<= 1;
+            if (high) {
+                sq ^= f ^ top;
+            }
+            if ((a >> j) & 1) {
+                sq ^= a;
+            }
+        }
+        r = sq & (top - 1);
+    }
+    return r == x;
+}
+
+// Characteristic polynomial of the recursion of (mat1, mat2), from the
+// sequence of one bit of the state. irreducible is set when it is
+// irreducible of degree 127, the only case in which it is returned.
+static inline tinymtdcPoly tinymtdcCharacteristic(int width, const tinymtdcParams& p, bool* irreducible) {
+    tinymtdcState t;
+    t.s[0] = 0x0123456789abcdefULL;
+    t.s[1] = 0xfedcba9876543210ULL;
+    t.s[2] = 0x0f1e2d3c4b5a6978ULL;
+    t.s[3] = 0x8796a5b4c3d2e1f0ULL;
+    if (width == 32) {
+        for (int i = 0; i < 4; i++) {
+            t.s[i] &= 0xffffffffULL;
+        }
+    }
+    std::vector<int> bits;
+    for (int i = 0; i < 3 * TINYMT_DC_DEGREE; i++) {
+        uint64_t out;
+        int sel;
+        tinymtdcNext(width, &t, p, &out, &sel);
+        bits.push_back((int)(t.s[1] & 1));
+    }
+    int len;
+    tinymtdcPoly f = tinymtdcMinimalPolynomial(bits, &len);
+    *irreducible = (len == TINYMT_DC_DEGREE) && tinymtdcIrreducible(f);
+    return *irreducible ? f : 0;
+}
+
+// Outputs of the recursion of (mat1, mat2) as linear maps of the state.
+// rows[j * width + b] has bit i set when bit b of output j, before tmat,
+// depends on bit i of the state, and sels[j] is the same for the bit
+// selecting tmat.
+struct tinymtdcOutputs {
+    int                   width;           // Number of bits of the outputs
+    std::vector<tinymtdcPoly> rows;        // Output bits as linear maps of the state
+    std::vector<tinymtdcPoly> sels;        // Bits selecting tmat as linear maps of the state
+};
+
+static inline void tinymtdcLinearOutputs(int width, const tinymtdcParams& p, tinymtdcOutputs* outputs) {
+    int count = TINYMT_DC_DEGREE + 1;
+    outputs->width = width;
+    outputs->rows.assign((size_t)(count * width), 0);
+    outputs->sels.assign((size_t)(count), 0);
+    for (int i = 0; i < 128; i++) {
+        tinymtdcState t = tinymtdcUnitState(width, i);
+        tinymtdcPoly bit = (tinymtdcPoly)(1) << i;
+        for (int j = 0; j < count; j++) {
+            uint64_t out;
+            int sel;
+            tinymtdcNext(width, &t, p, &out, &sel);
+            for (int b = 0; b < width; b++) {
+                if ((out >> b) & 1) {
+                    outputs->rows[j * width + b] |= bit;
+                }
+            }
+            if (sel) {
+                outputs->sels[j] |= bit;
+            }
+        }
+    }
+}
+
+// Adds row to the rows in echelon form in pivots, and returns false if it
+// is a combination of them
+static inline bool tinymtdcAddRow(tinymtdcPoly* pivots, tinymtdcPoly row) {
+    while (row != 0) {
+        uint64_t high = (uint64_t)(row >> 64);
+        int b = (high != 0) ? (127 - __builtin_clzll(high)) : (63 - __builtin_clzll((uint64_t)(row)));
+        if (pivots[b] == 0) {
+            pivots[b] = row;
+            return true;
+        }
+        row ^= pivots[b];
+    }
+    return false;
+}
+
+// Sum over v of the dimensions of equidistribution to v bits missing from
+// their upper bound 127 / v, of the outputs tempered with tmat. The sum
+// stops once it reaches limit, if limit is positive.
+static inline int tinymtdcDelta(const tinymtdcOutputs& outputs, uint64_t tmat, int limit = 0) {
+    int width = outputs.width;
+    int delta = 0;
+    for (int v = 1; (v <= width) && ((limit <= 0) || (delta < limit)); v++) {
+        tinymtdcPoly pivots[128];
+        memset(pivots, 0, sizeof(pivots));
+        int k = 0;
+        bool independent = true;
+        while (independent && (k <= TINYMT_DC_DEGREE / v)) {
+            for (int b = width - 1; (b >= width - v) && independent; b--) {
+                tinymtdcPoly row = outputs.rows[k * width + b];
+                if ((tmat >> b) & 1) {
+                    row ^= outputs.sels[k];
+                }
+                independent = tinymtdcAddRow(pivots, row);
+            }
+            if (independent) {
+                k++;
+            }
+        }
+        delta += TINYMT_DC_DEGREE / v - k;
+    }
+    return delta;
+}
+
+// Checks the parameter set p of tinymt32 (width 32) or tinymt64 (width 64)
+static inline tinymtdcResult tinymtdcAnalyze(int width, const tinymtdcParams& p) {
+    tinymtdcResult result;
+    result.characteristic = tinymtdcCharacteristic(width, p, &result.irreducible);
+    result.weight = 0;
+    for (tinymtdcPoly f = result.characteristic; f != 0; f >>= 1) {
+        result.weight += (int)(f & 1);
+    }
+    result.delta = -1;
+    if (result.irreducible) {
+        tinymtdcOutputs outputs;
+        tinymtdcLinearOutputs(width, p, &outputs);
+        result.delta = tinymtdcDelta(outputs, p.tmat);
+    }
+    return result;
+}
+
+// Reads the hexadecimal values of the __constant array name in the kernel
+// source, and the numbers following each row in a comment (the weight and
+// delta columns of the tables) into columns, if not NULL
+static inline bool tinymtdcReadTable(const char* source, const char* name, std::vector<uint64_t>* values, std::vector<int>* columns) {
+    const char* pos = strstr(source, name);
+    if (pos != NULL) {
+        pos = strchr(pos, '{');
+    }
+    if (pos == NULL) {
+        return false;
+    }
+    pos++;
+    while ((*pos != '\0') && (*pos != '}')) {
+        if ((pos[0] == '0') && ((pos[1] == 'x') || (pos[1] == 'X'))) {
+            char* end;
+            values->push_back((uint64_t)(strtoull(pos, &end, 16)));
+            pos = end;
+        } else if ((pos[0] == '/') && (pos[1] == '/')) {
+            const char* eol = strchr(pos, '\n');
+            pos += 2;
+            while ((columns != NULL) && (eol != NULL) && (pos < eol)) {
+                char* end;
+                long value = strtol(pos, &end, 10);
+                if (end == pos) {
+                    break;
+                }
+                columns->push_back((int)(value));
+                pos = end;
+            }
+            pos = (eol != NULL) ? eol : pos + strlen(pos);
+        } else {
+            pos++;
+        }
+    }
+    return *pos == '}';
+}
+
+#endif
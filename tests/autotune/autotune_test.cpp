@@ -0,0 +1,159 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <getopt.h>
+#include "../../src/clrand.hpp"
+#include "utils.h"
+
+#define __CL_ENABLE_EXCEPTIONS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+
+#if defined(__APPLE__) || defined(__MACOSX)
+    #include <OpenCL/cl.h>
+#else
+    #include <CL/cl.h>
+#endif
+
+#define NUM_GENERATORS 4096
+
+// Builds a philox2x32_10 stream, with the given work configuration (zero
+// for the tuned profile) and number of generators (zero for one per
+// work-item), and generates count numbers into host memory
+static clRAND* generateNumbers(oclStruct* tmpStructPtr, clrandWorkConfig* config, size_t num_generators, size_t count, float* numbers) {
+    clRAND* test = clrand_create_stream();
+    if (config != NULL) {
+        clrand_set_work_config(test, config->wkgrp_size, config->wkgrp_count, config->buf_mult);
+    }
+    if ((num_generators > 0) && clrand_set_num_generators(test, num_generators)) {
+        std::cout << "ERROR: unable to set number of generators!" << std::endl;
+        delete test;
+        return NULL;
+    }
+    (*test).Init((*tmpStructPtr).target_device, (*tmpStructPtr).ctx, CLRAND_GENERATOR_PHILOX2X32_10);
+    clrand_set_prng_precision(test, "float");
+    (*test).BuildSource();
+    cl_int err = (*test).BuildKernelProgram();
+    if (err == 0) {
+        err = clrand_ready_stream(test);
+    }
+    if (err) {
+        std::cout << "ERROR: unable to set up stream!" << std::endl;
+        delete test;
+        return NULL;
+    }
+    clrand_set_prng_seed(test, 1234);
+    err = clrand_generate_host(test, count, numbers);
+    if (err) {
+        std::cout << "ERROR: unable to generate random float!" << std::endl;
+        delete test;
+        return NULL;
+    }
+    return test;
+}
+
+int main(int argc, char **argv) {
+    cl_int            err = -1;
+
+    oclStruct* tmpStructPtr = (oclStruct*) malloc(sizeof(oclStruct));
+    int res = makeOclStruct(argc, argv, tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to create oclStruct!\n");
+        return res;
+    }
+    res = printOclStructInfo(tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to print information about oclStruct!\n");
+        return res;
+    }
+
+    cl_device_id tmpDev = (*tmpStructPtr).target_device;
+    (*tmpStructPtr).ctx = clCreateContext(NULL, 1, &tmpDev, NULL, NULL, &err);
+    if (err) {
+        std::cout << "ERROR: unable to create context to extract random float!" << std::endl;
+        return -1;
+    }
+
+    // Default configuration, sized from the resources of the generate kernel
+    size_t count = 1000000;
+    float* initialNumbers = new float[count];
+    float* tunedNumbers = new float[count];
+    float* explicitNumbers = new float[count];
+    clRAND* initial = generateNumbers(tmpStructPtr, NULL, 0, count, initialNumbers);
+    if (initial == NULL) {
+        return -1;
+    }
+    clrandWorkConfig initialConfig;
+    std::cout << "Default work configuration: " << clrand_get_work_config(initial, &initialConfig) << std::endl;
+    if (initial->GetNumberOfRNGs() != initialConfig.wkgrp_size * initialConfig.wkgrp_count) {
+        std::cout << "ERROR: reported work configuration does not match the stream!" << std::endl;
+        return -2;
+    }
+    delete initial;
+
+    // The profile is also kept in CLRAND_CACHE_DIR, when it is set
+    std::cout << "Tuning work configuration of philox2x32_10 (float)..." << std::endl;
+    clrandWorkConfig best;
+    err = clrand_autotune((*tmpStructPtr).target_device, (*tmpStructPtr).ctx, CLRAND_GENERATOR_PHILOX2X32_10, "float", &best);
+    if (err) {
+        std::cout << "ERROR: unable to tune work configuration!" << std::endl;
+        return err;
+    }
+    std::cout << "Work-group size: " << best.wkgrp_size << std::endl;
+    std::cout << "Work-group count: " << best.wkgrp_count << std::endl;
+    std::cout << "Entries per work-item: " << best.buf_mult << std::endl;
+    std::cout << "Benchmark time: " << best.seconds << " s" << std::endl;
+
+    // Streams with one PRNG per work-item keep their launch shape, and so
+    // their numbers, after tuning
+    uint err_counts = 0;
+    clRAND* untouched = generateNumbers(tmpStructPtr, NULL, 0, count, tunedNumbers);
+    if (untouched == NULL) {
+        return -1;
+    }
+    std::cout << "Work configuration after tuning: " << clrand_get_work_config(untouched, NULL) << std::endl;
+    if (untouched->GetNumberOfRNGs() != initialConfig.wkgrp_size * initialConfig.wkgrp_count) {
+        std::cout << "ERROR: tuned profile changed the number of PRNGs of the stream!" << std::endl;
+        err_counts++;
+    }
+    for (size_t idx = 0; idx < count; idx++) {
+        if (tunedNumbers[idx] != initialNumbers[idx]) {
+            err_counts++;
+        }
+    }
+    delete untouched;
+
+    // Streams with a set number of generators use the tuned launch shape,
+    // and generate the same numbers as under the default configuration
+    clRAND* reference = generateNumbers(tmpStructPtr, &initialConfig, NUM_GENERATORS, count, explicitNumbers);
+    clRAND* tuned = generateNumbers(tmpStructPtr, NULL, NUM_GENERATORS, count, tunedNumbers);
+    if ((tuned == NULL) || (reference == NULL)) {
+        return -1;
+    }
+    clrandWorkConfig tunedConfig;
+    std::cout << "Tuned work configuration: " << clrand_get_work_config(tuned, &tunedConfig) << std::endl;
+    if ((tunedConfig.wkgrp_size != best.wkgrp_size) || (tunedConfig.wkgrp_count != best.wkgrp_count) || (tunedConfig.buf_mult != best.buf_mult)) {
+        std::cout << "ERROR: stream does not use the tuned work configuration!" << std::endl;
+        err_counts++;
+    }
+    for (size_t idx = 0; idx < count; idx++) {
+        if (tunedNumbers[idx] != explicitNumbers[idx]) {
+            err_counts++;
+        }
+    }
+    delete tuned;
+    delete reference;
+    delete [] initialNumbers;
+    delete [] tunedNumbers;
+    delete [] explicitNumbers;
+    if (err_counts == 0) {
+        std::cout << "No errors detected with the tuned work configuration!" << std::endl;
+    } else {
+        std::cout << err_counts << " errors detected with the tuned work configuration!" << std::endl;
+        return -2;
+    }
+
+    // Completed checks...
+    std::cout << "Checks completed!..." << std::endl;
+    free(tmpStructPtr);
+    return res;
+}
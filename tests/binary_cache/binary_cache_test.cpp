@@ -0,0 +1,112 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <getopt.h>
+#include "../../src/clrand.hpp"
+#include "utils.h"
+
+#define __CL_ENABLE_EXCEPTIONS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+
+#if defined(__APPLE__) || defined(__MACOSX)
+    #include <OpenCL/cl.h>
+#else
+    #include <CL/cl.h>
+#endif
+
+// Builds a stream, generates count numbers into host memory and deletes it
+static cl_int generateNumbers(oclStruct* tmpStructPtr, size_t count, uint* numbers) {
+    clRAND* test = clrand_create_stream();
+    cl_int err = clrand_initialize_prng(test, (*tmpStructPtr).target_device, (*tmpStructPtr).ctx, CLRAND_GENERATOR_TINYMT32);
+    if (err) {
+        std::cout << "ERROR: unable to initialize stream!" << std::endl;
+        return err;
+    }
+    err = clrand_ready_stream(test);
+    if (err) {
+        std::cout << "ERROR: unable to ready stream!" << std::endl;
+        return err;
+    }
+    clrand_set_prng_seed(test, 1234);
+    err = clrand_generate_host(test, count, numbers);
+    if (err) {
+        std::cout << "ERROR: unable to generate random uint!" << std::endl;
+    }
+    delete test;
+    return err;
+}
+
+int main(int argc, char **argv) {
+    cl_int            err = -1;
+
+    oclStruct* tmpStructPtr = (oclStruct*) malloc(sizeof(oclStruct));
+    int res = makeOclStruct(argc, argv, tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to create oclStruct!\n");
+        return res;
+    }
+    res = printOclStructInfo(tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to print information about oclStruct!\n");
+        return res;
+    }
+
+    cl_device_id tmpDev = (*tmpStructPtr).target_device;
+    (*tmpStructPtr).ctx = clCreateContext(NULL, 1, &tmpDev, NULL, NULL, &err);
+    if (err) {
+        std::cout << "ERROR: unable to create context to extract random uint!" << std::endl;
+        return -1;
+    }
+
+    // Start from an empty cache directory
+    char cacheDir[] = "/tmp/clrand_cache_XXXXXX";
+    if (mkdtemp(cacheDir) == NULL) {
+        std::cout << "ERROR: unable to create cache directory!" << std::endl;
+        return -1;
+    }
+    clrand_set_cache_dir(cacheDir);
+
+    // The first stream builds from source and stores the binary. The
+    // program leaves the in-process cache once the stream is deleted, so
+    // the second stream loads the binary from the cache directory.
+    size_t count = 1000;
+    uint* sourceNumbers = new uint[count];
+    uint* binaryNumbers = new uint[count];
+    err = generateNumbers(tmpStructPtr, count, sourceNumbers);
+    if (err) {
+        return err;
+    }
+    err = generateNumbers(tmpStructPtr, count, binaryNumbers);
+    if (err) {
+        return err;
+    }
+
+    clrandCacheStats stats;
+    clrand_get_cache_stats(&stats);
+    std::cout << "Programs built from source: " << stats.source_builds << " in " << stats.build_seconds << " s" << std::endl;
+    std::cout << "Programs loaded from binaries: " << stats.disk_hits << " in " << stats.load_seconds << " s" << std::endl;
+    if ((stats.source_builds != 1) || (stats.disk_hits != 1) || (stats.disk_misses != 1)) {
+        std::cout << "ERROR: expected one build from source and one binary load!" << std::endl;
+        return -2;
+    }
+
+    uint err_counts = 0;
+    for (size_t idx = 0; idx < count; idx++) {
+        if (sourceNumbers[idx] != binaryNumbers[idx]) {
+            err_counts++;
+        }
+    }
+    delete [] sourceNumbers;
+    delete [] binaryNumbers;
+    if (err_counts == 0) {
+        std::cout << "No errors detected between programs built from source and binary!" << std::endl;
+    } else {
+        std::cout << err_counts << " errors detected between programs built from source and binary!" << std::endl;
+        return -2;
+    }
+
+    // Completed checks...
+    std::cout << "Checks completed!..." << std::endl;
+    free(tmpStructPtr);
+    return res;
+}
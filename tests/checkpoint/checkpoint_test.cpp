@@ -0,0 +1,209 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <getopt.h>
+#include "../../src/clrand.hpp"
+#include "utils.h"
+
+#define __CL_ENABLE_EXCEPTIONS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+
+#if defined(__APPLE__) || defined(__MACOSX)
+    #include <OpenCL/cl.h>
+#else
+    #include <CL/cl.h>
+#endif
+
+// Generates count numbers into host memory, through a device buffer for
+// streams in concurrent mode
+static cl_int generateRequest(oclStruct* tmpStructPtr, clRAND* test, size_t count, uint* numbers) {
+    if (test->IsConcurrent() == false) {
+        return clrand_generate_host(test, count, numbers);
+    }
+    cl_int err;
+    cl_mem dst = clCreateBuffer((*tmpStructPtr).ctx, CL_MEM_READ_WRITE, count * sizeof(uint), NULL, &err);
+    if (err) {
+        return err;
+    }
+    err = clrand_generate_stream(test, count, dst);
+    if (err == 0) {
+        err = clEnqueueReadBuffer(test->GetStreamQueue(), dst, true, 0, count * sizeof(uint), numbers, 0, NULL, NULL);
+    }
+    clReleaseMemObject(dst);
+    return err;
+}
+
+// Generates count numbers into host memory in two requests, so numbers
+// are left buffered in between
+static cl_int generateNumbers(oclStruct* tmpStructPtr, clRAND* test, size_t count, uint* numbers) {
+    cl_int err = generateRequest(tmpStructPtr, test, count / 3, numbers);
+    if (err == 0) {
+        err = generateRequest(tmpStructPtr, test, count - count / 3, numbers + count / 3);
+    }
+    if (err) {
+        std::cout << "ERROR: unable to generate random uint!" << std::endl;
+    }
+    return err;
+}
+
+// Builds a stream seeded with 1234
+static clRAND* createStream(oclStruct* tmpStructPtr, clrandRngType rng_type, int lazy, int concurrent) {
+    clRAND* test = clrand_create_stream();
+    clrand_set_lazy_seeding(test, lazy);
+    clrand_set_concurrent(test, concurrent);
+    clrand_initialize_prng(test, (*tmpStructPtr).target_device, (*tmpStructPtr).ctx, rng_type);
+    cl_int err = clrand_ready_stream(test);
+    if (err) {
+        std::cout << "ERROR: unable to ready stream!" << std::endl;
+        delete test;
+        return NULL;
+    }
+    clrand_set_prng_seed(test, 1234);
+    return test;
+}
+
+// Counts the entries that differ between two sets of numbers
+static uint countErrors(const uint* a, const uint* b, size_t count) {
+    uint err_counts = 0;
+    for (size_t idx = 0; idx < count; idx++) {
+        if (a[idx] != b[idx]) {
+            err_counts++;
+        }
+    }
+    return err_counts;
+}
+
+int main(int argc, char **argv) {
+    cl_int            err = -1;
+
+    oclStruct* tmpStructPtr = (oclStruct*) malloc(sizeof(oclStruct));
+    int res = makeOclStruct(argc, argv, tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to create oclStruct!\n");
+        return res;
+    }
+    res = printOclStructInfo(tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to print information about oclStruct!\n");
+        return res;
+    }
+
+    cl_device_id tmpDev = (*tmpStructPtr).target_device;
+    (*tmpStructPtr).ctx = clCreateContext(NULL, 1, &tmpDev, NULL, NULL, &err);
+    if (err) {
+        std::cout << "ERROR: unable to create context to extract random uint!" << std::endl;
+        return -1;
+    }
+
+    // Numbers generated after a checkpoint are generated again after each
+    // restore of it, with numbers buffered at the checkpoint and in
+    // between, for lazily and eagerly seeded streams
+    clrandRngType rng_types[3] = { CLRAND_GENERATOR_LCG6432, CLRAND_GENERATOR_MT19937, CLRAND_GENERATOR_PHILOX2X32_10 };
+    size_t count = 1000000;
+    uint* checkpointNumbers = new uint[count];
+    uint* restoreNumbers = new uint[count];
+    for (int r = 0; r < 3; r++) {
+        for (int lazy = 0; lazy < 2; lazy++) {
+            clRAND* test = createStream(tmpStructPtr, rng_types[r], lazy, 0);
+            if (test == NULL) {
+                return -1;
+            }
+            char* state_mem = new char[clrand_get_state_size(test)];
+
+            std::cout << "Attempting to checkpoint and restore random uint..." << std::endl;
+            err = clrand_generate_host(test, 1000, restoreNumbers);
+            if (err == 0) {
+                err = clrand_checkpoint_state(test, state_mem);
+            }
+            if (err == 0) {
+                err = generateNumbers(tmpStructPtr, test, count, checkpointNumbers);
+            }
+            uint err_counts = 0;
+            for (int restore = 0; (restore < 2) && (err == 0); restore++) {
+                err = clrand_restore_state(test, state_mem);
+                if (err == 0) {
+                    err = generateNumbers(tmpStructPtr, test, count, restoreNumbers);
+                }
+                if (err == 0) {
+                    err_counts += countErrors(checkpointNumbers, restoreNumbers, count);
+                }
+            }
+            if (err) {
+                std::cout << "ERROR: unable to checkpoint and restore stream!" << std::endl;
+                return err;
+            }
+            delete [] state_mem;
+            delete test;
+            if (err_counts == 0) {
+                std::cout << "No errors detected between checkpoint and restores!" << std::endl;
+            } else {
+                std::cout << err_counts << " errors detected between checkpoint and restores!" << std::endl;
+                return -2;
+            }
+        }
+    }
+
+    // A checkpoint that is never restored leaves the numbers generated
+    // after it as they would have been without it, and in concurrent mode
+    // the stream also replays from the checkpoint after a restore
+    uint* plainNumbers = new uint[count];
+    for (int r = 0; r < 3; r++) {
+        for (int concurrent = 0; concurrent < 2; concurrent++) {
+            clRAND* plain = createStream(tmpStructPtr, rng_types[r], 0, concurrent);
+            clRAND* test = createStream(tmpStructPtr, rng_types[r], 0, concurrent);
+            if ((plain == NULL) || (test == NULL)) {
+                return -1;
+            }
+            char* state_mem = new char[clrand_get_state_size(test)];
+
+            std::cout << "Attempting to checkpoint random uint without restoring" << (concurrent ? " in concurrent mode" : "") << "..." << std::endl;
+            err = generateRequest(tmpStructPtr, plain, 1000, plainNumbers);
+            if (err == 0) {
+                err = generateRequest(tmpStructPtr, test, 1000, checkpointNumbers);
+            }
+            if (err == 0) {
+                err = clrand_checkpoint_state(test, state_mem);
+            }
+            if (err == 0) {
+                err = generateNumbers(tmpStructPtr, plain, count, plainNumbers);
+            }
+            if (err == 0) {
+                err = generateNumbers(tmpStructPtr, test, count, checkpointNumbers);
+            }
+            uint err_counts = 0;
+            if (err == 0) {
+                err_counts += countErrors(plainNumbers, checkpointNumbers, count);
+            }
+            if ((err == 0) && concurrent) {
+                err = clrand_restore_state(test, state_mem);
+                if (err == 0) {
+                    err = generateNumbers(tmpStructPtr, test, count, restoreNumbers);
+                }
+                if (err == 0) {
+                    err_counts += countErrors(plainNumbers, restoreNumbers, count);
+                }
+            }
+            if (err) {
+                std::cout << "ERROR: unable to checkpoint stream!" << std::endl;
+                return err;
+            }
+            delete [] state_mem;
+            delete plain;
+            delete test;
+            if (err_counts == 0) {
+                std::cout << "No errors detected between streams with and without checkpoint!" << std::endl;
+            } else {
+                std::cout << err_counts << " errors detected between streams with and without checkpoint!" << std::endl;
+                return -2;
+            }
+        }
+    }
+    delete [] plainNumbers;
+    delete [] checkpointNumbers;
+    delete [] restoreNumbers;
+
+    // Completed checks...
+    std::cout << "Checks completed!..." << std::endl;
+    free(tmpStructPtr);
+    return res;
+}
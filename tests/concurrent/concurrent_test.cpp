@@ -0,0 +1,161 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <getopt.h>
+#include <thread>
+#include "../../src/clrand.hpp"
+#include "utils.h"
+
+#define __CL_ENABLE_EXCEPTIONS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+
+#if defined(__APPLE__) || defined(__MACOSX)
+    #include <OpenCL/cl.h>
+#else
+    #include <CL/cl.h>
+#endif
+
+#define NUM_THREADS  4
+#define NUM_REQUESTS 50
+
+// Size of request i of thread t
+static int requestSize(int t, int i) {
+    return 1 + (t * 37 + i * 101) % 3000;
+}
+
+// Each thread generates its requests from the shared stream, and stores
+// the numbers at the stream position reported for each request
+static void worker(clRAND* stream, cl_context ctx, cl_command_queue queue, int t, uint* numbers, cl_int* status) {
+    cl_int err;
+    *status = 0;
+    for (int i = 0; i < NUM_REQUESTS; i++) {
+        int count = requestSize(t, i);
+        cl_mem dst = clCreateBuffer(ctx, CL_MEM_READ_WRITE, count * sizeof(uint), NULL, &err);
+        if (err) {
+            *status = err;
+            return;
+        }
+        cl_ulong position;
+        err = clrand_generate_stream_concurrent(stream, count, dst, &position);
+        if (err == 0) {
+            err = clEnqueueReadBuffer(queue, dst, true, 0, count * sizeof(uint), numbers + position, 0, NULL, NULL);
+        }
+        clReleaseMemObject(dst);
+        if (err) {
+            *status = err;
+            return;
+        }
+    }
+}
+
+int main(int argc, char **argv) {
+    cl_int            err = -1;
+
+    oclStruct* tmpStructPtr = (oclStruct*) malloc(sizeof(oclStruct));
+    int res = makeOclStruct(argc, argv, tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to create oclStruct!\n");
+        return res;
+    }
+    res = printOclStructInfo(tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to print information about oclStruct!\n");
+        return res;
+    }
+
+    cl_device_id tmpDev = (*tmpStructPtr).target_device;
+    (*tmpStructPtr).ctx = clCreateContext(NULL, 1, &tmpDev, NULL, NULL, &err);
+    if (err) {
+        std::cout << "ERROR: unable to create context to extract random uint!" << std::endl;
+        return -1;
+    }
+
+    // One stream shared by all threads, and one stream with the same seed
+    // generating the whole range from a single thread
+    clRAND* shared = clrand_create_stream();
+    clRAND* single = clrand_create_stream();
+    clrand_initialize_prng(shared, (*tmpStructPtr).target_device, (*tmpStructPtr).ctx, CLRAND_GENERATOR_LCG6432);
+    clrand_initialize_prng(single, (*tmpStructPtr).target_device, (*tmpStructPtr).ctx, CLRAND_GENERATOR_LCG6432);
+    err = clrand_set_concurrent(shared, 1);
+    if (err) {
+        std::cout << "ERROR: unable to set stream to concurrent mode!" << std::endl;
+        return err;
+    }
+    err = clrand_ready_stream(shared);
+    if (err) {
+        std::cout << "ERROR: unable to ready shared stream!" << std::endl;
+        return err;
+    }
+    err = clrand_ready_stream(single);
+    if (err) {
+        std::cout << "ERROR: unable to ready single stream!" << std::endl;
+        return err;
+    }
+    clrand_set_prng_seed(shared, 1234);
+    clrand_set_prng_seed(single, 1234);
+    (*tmpStructPtr).queue = single->GetStreamQueue();
+
+    size_t total = 0;
+    for (int t = 0; t < NUM_THREADS; t++) {
+        for (int i = 0; i < NUM_REQUESTS; i++) {
+            total += requestSize(t, i);
+        }
+    }
+    uint* sharedNumbers = new uint[total];
+    uint* singleNumbers = new uint[total];
+
+    std::cout << "Attempting to generate random uint from " << NUM_THREADS << " threads..." << std::endl;
+    std::thread threads[NUM_THREADS];
+    cl_int status[NUM_THREADS];
+    for (int t = 0; t < NUM_THREADS; t++) {
+        threads[t] = std::thread(worker, shared, (*tmpStructPtr).ctx, (*tmpStructPtr).queue, t, sharedNumbers, &status[t]);
+    }
+    for (int t = 0; t < NUM_THREADS; t++) {
+        threads[t].join();
+        if (status[t]) {
+            std::cout << "ERROR: thread " << t << " failed to generate random uint!" << std::endl;
+            return status[t];
+        }
+    }
+
+    std::cout << "Attempting to generate random uint from a single thread..." << std::endl;
+    cl_mem dst = clCreateBuffer((*tmpStructPtr).ctx, CL_MEM_READ_WRITE, total * sizeof(uint), NULL, &err);
+    if (err) {
+        std::cout << "ERROR: unable to create buffer for random numbers!" << std::endl;
+        return err;
+    }
+    err = clrand_generate_stream(single, total, dst);
+    if (err) {
+        std::cout << "ERROR: unable to generate random uint!" << std::endl;
+        return err;
+    }
+    err = clEnqueueReadBuffer((*tmpStructPtr).queue, dst, true, 0, total * sizeof(uint), singleNumbers, 0, NULL, NULL);
+    if (err) {
+        std::cout << "ERROR: unable to read random uint!" << std::endl;
+        return err;
+    }
+
+    // The reserved ranges cover the stream without gaps or overlaps
+    uint err_counts = 0;
+    for (size_t idx = 0; idx < total; idx++) {
+        if (sharedNumbers[idx] != singleNumbers[idx]) {
+            err_counts++;
+        }
+    }
+    delete [] sharedNumbers;
+    delete [] singleNumbers;
+    clReleaseMemObject(dst);
+    if (err_counts == 0) {
+        std::cout << "No errors detected between concurrent and single thread streams!" << std::endl;
+    } else {
+        std::cout << err_counts << " errors detected between concurrent and single thread streams!" << std::endl;
+        return -2;
+    }
+
+    // Completed checks...
+    std::cout << "Checks completed!..." << std::endl;
+    delete shared;
+    delete single;
+    free(tmpStructPtr);
+    return res;
+}
@@ -0,0 +1,176 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <getopt.h>
+#include <string>
+#include "../../src/clrand.hpp"
+#include "utils.h"
+
+#define __CL_ENABLE_EXCEPTIONS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+
+#if defined(__APPLE__) || defined(__MACOSX)
+    #include <OpenCL/cl.h>
+#else
+    #include <CL/cl.h>
+#endif
+
+// User kernel drawing numbers inline from the PRNG states, in the order of
+// the interleaved layout of the stream
+static const char* userKernel =
+    "kernel void draw(global clrand_state* stateBuf, global uint* res, uint rounds){\n"
+    "    uint gid=get_global_id(0);\n"
+    "    uint gsize=get_global_size(0);\n"
+    "    clrand_state state = clrand_load_state(stateBuf, gid);\n"
+    "    for(uint r=0;r<rounds;r++){\n"
+    "        res[r*gsize+gid]=clrand_next_uint(state);\n"
+    "    }\n"
+    "    clrand_store_state(stateBuf, gid, state);\n"
+    "}\n";
+
+// Creates an interleaved mt19937 stream seeded with 1234
+static clRAND* createStream(oclStruct* tmpStructPtr) {
+    clRAND* stream = clrand_create_stream();
+    clrand_set_layout(stream, CLRAND_LAYOUT_INTERLEAVED);
+    cl_int err = clrand_initialize_prng(stream, (*tmpStructPtr).target_device, (*tmpStructPtr).ctx, CLRAND_GENERATOR_MT19937);
+    if (err == 0) {
+        err = clrand_ready_stream(stream);
+    }
+    if (err) {
+        std::cout << "ERROR: unable to set up stream!" << std::endl;
+        delete stream;
+        return NULL;
+    }
+    clrand_set_prng_seed(stream, 1234);
+    return stream;
+}
+
+int main(int argc, char **argv) {
+    cl_int            err = -1;
+
+    oclStruct* tmpStructPtr = (oclStruct*) malloc(sizeof(oclStruct));
+    int res = makeOclStruct(argc, argv, tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to create oclStruct!\n");
+        return res;
+    }
+    res = printOclStructInfo(tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to print information about oclStruct!\n");
+        return res;
+    }
+
+    cl_device_id tmpDev = (*tmpStructPtr).target_device;
+    (*tmpStructPtr).ctx = clCreateContext(NULL, 1, &tmpDev, NULL, NULL, &err);
+    if (err) {
+        std::cout << "ERROR: unable to create context to extract random uint!" << std::endl;
+        return -1;
+    }
+    (*tmpStructPtr).queue = clCreateCommandQueue((*tmpStructPtr).ctx, tmpDev, 0, &err);
+    if (err) {
+        std::cout << "ERROR: unable to create command queue!" << std::endl;
+        return -1;
+    }
+
+    clRAND* device = createStream(tmpStructPtr);
+    clRAND* reference = createStream(tmpStructPtr);
+    if ((device == NULL) || (reference == NULL)) {
+        return -1;
+    }
+    size_t num_prngs = clrand_get_num_prngs(device);
+    cl_uint rounds = 64;
+    size_t count = num_prngs * rounds;
+
+    // Build the user kernel on top of the device API of the stream
+    std::string source = std::string(clrand_get_device_source(device)) + userKernel;
+    const char* source_ptr = source.c_str();
+    size_t source_len = source.length();
+    cl_program program = clCreateProgramWithSource((*tmpStructPtr).ctx, 1, &source_ptr, &source_len, &err);
+    if (err == 0) {
+        err = clBuildProgram(program, 1, &tmpDev, "-cl-std=CL1.2", NULL, NULL);
+    }
+    if (err) {
+        std::cout << "ERROR: unable to build user kernel!" << std::endl;
+        return err;
+    }
+    cl_kernel kernel = clCreateKernel(program, "draw", &err);
+    if (err) {
+        std::cout << "ERROR: unable to create user kernel!" << std::endl;
+        return err;
+    }
+
+    cl_mem userBuffer = clCreateBuffer((*tmpStructPtr).ctx, CL_MEM_READ_WRITE, count * sizeof(uint), NULL, &err);
+    cl_mem refBuffer = clCreateBuffer((*tmpStructPtr).ctx, CL_MEM_READ_WRITE, count * sizeof(uint), NULL, &err);
+    cl_mem states;
+    err = clrand_get_state_buffer(device, &states);
+    if (err) {
+        std::cout << "ERROR: unable to get state buffer!" << std::endl;
+        return err;
+    }
+    clSetKernelArg(kernel, 0, sizeof(cl_mem), &states);
+    clSetKernelArg(kernel, 1, sizeof(cl_mem), &userBuffer);
+    clSetKernelArg(kernel, 2, sizeof(cl_uint), &rounds);
+    err = clEnqueueNDRangeKernel((*tmpStructPtr).queue, kernel, 1, NULL, &num_prngs, NULL, 0, NULL, NULL);
+    if (err == 0) {
+        err = clFinish((*tmpStructPtr).queue);
+    }
+    if (err) {
+        std::cout << "ERROR: unable to run user kernel!" << std::endl;
+        return err;
+    }
+    err = clrand_generate_stream(reference, count, refBuffer);
+    if (err) {
+        std::cout << "ERROR: unable to generate random uint!" << std::endl;
+        return err;
+    }
+
+    uint* userNumbers = new uint[count];
+    uint* refNumbers = new uint[count];
+    clEnqueueReadBuffer((*tmpStructPtr).queue, userBuffer, true, 0, count * sizeof(uint), userNumbers, 0, NULL, NULL);
+    clEnqueueReadBuffer((*tmpStructPtr).queue, refBuffer, true, 0, count * sizeof(uint), refNumbers, 0, NULL, NULL);
+
+    // The stream continues from the states advanced by the user kernel
+    err = clrand_generate_stream(device, count, userBuffer);
+    if (err == 0) {
+        err = clrand_generate_stream(reference, count, refBuffer);
+    }
+    if (err) {
+        std::cout << "ERROR: unable to generate random uint!" << std::endl;
+        return err;
+    }
+    uint* userNext = new uint[count];
+    uint* refNext = new uint[count];
+    clEnqueueReadBuffer((*tmpStructPtr).queue, userBuffer, true, 0, count * sizeof(uint), userNext, 0, NULL, NULL);
+    clEnqueueReadBuffer((*tmpStructPtr).queue, refBuffer, true, 0, count * sizeof(uint), refNext, 0, NULL, NULL);
+
+    uint err_counts = 0;
+    for (size_t idx = 0; idx < count; idx++) {
+        if (userNumbers[idx] != refNumbers[idx]) {
+            err_counts++;
+        }
+        if (userNext[idx] != refNext[idx]) {
+            err_counts++;
+        }
+    }
+    delete [] userNumbers;
+    delete [] refNumbers;
+    delete [] userNext;
+    delete [] refNext;
+    clReleaseMemObject(userBuffer);
+    clReleaseMemObject(refBuffer);
+    clReleaseKernel(kernel);
+    clReleaseProgram(program);
+    delete device;
+    delete reference;
+    if (err_counts == 0) {
+        std::cout << "No errors detected between user kernel and stream!" << std::endl;
+    } else {
+        std::cout << err_counts << " errors detected between user kernel and stream!" << std::endl;
+        return -2;
+    }
+
+    // Completed checks...
+    std::cout << "Checks completed!..." << std::endl;
+    free(tmpStructPtr);
+    return res;
+}
@@ -0,0 +1,130 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <getopt.h>
+#include "../../src/clrand.hpp"
+#include "utils.h"
+
+#define __CL_ENABLE_EXCEPTIONS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+
+#if defined(__APPLE__) || defined(__MACOSX)
+    #include <OpenCL/cl.h>
+#else
+    #include <CL/cl.h>
+#endif
+
+#define NUM_REQUESTS 7
+#define SMALL_REQUEST 100
+
+// Builds a stream seeded with 1234
+static clRAND* createStream(oclStruct* tmpStructPtr, clrandRngType rng_type) {
+    clRAND* test = clrand_create_stream();
+    clrand_initialize_prng(test, (*tmpStructPtr).target_device, (*tmpStructPtr).ctx, rng_type);
+    cl_int err = clrand_ready_stream(test);
+    if (err) {
+        std::cout << "ERROR: unable to ready stream!" << std::endl;
+        delete test;
+        return NULL;
+    }
+    clrand_set_prng_seed(test, 1234);
+    return test;
+}
+
+int main(int argc, char **argv) {
+    cl_int            err = -1;
+
+    oclStruct* tmpStructPtr = (oclStruct*) malloc(sizeof(oclStruct));
+    int res = makeOclStruct(argc, argv, tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to create oclStruct!\n");
+        return res;
+    }
+    res = printOclStructInfo(tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to print information about oclStruct!\n");
+        return res;
+    }
+
+    cl_device_id tmpDev = (*tmpStructPtr).target_device;
+    (*tmpStructPtr).ctx = clCreateContext(NULL, 1, &tmpDev, NULL, NULL, &err);
+    if (err) {
+        std::cout << "ERROR: unable to create context to extract random uint!" << std::endl;
+        return -1;
+    }
+
+    // Requests spanning whole temporary buffers are generated straight into
+    // their destination, and the stream is the same as when every number
+    // goes through the temporary buffers in small requests
+    clrandRngType rng_types[2] = { CLRAND_GENERATOR_LCG6432, CLRAND_GENERATOR_MT19937 };
+    for (int r = 0; r < 2; r++) {
+        clRAND* mixed = createStream(tmpStructPtr, rng_types[r]);
+        clRAND* small = createStream(tmpStructPtr, rng_types[r]);
+        if ((mixed == NULL) || (small == NULL)) {
+            return -1;
+        }
+        (*tmpStructPtr).queue = mixed->GetStreamQueue();
+        clrandStreamStats stats;
+        clrand_get_stream_stats(mixed, &stats);
+        size_t entries = stats.tmp_buffer_entries;
+        size_t counts[NUM_REQUESTS] = { SMALL_REQUEST, 3 * entries, 33, entries, 5 * entries + 7, 1, 2 * entries - 1 };
+        size_t total = 0;
+        for (int idx = 0; idx < NUM_REQUESTS; idx++) {
+            total += counts[idx];
+        }
+        uint* mixedNumbers = new uint[total];
+        uint* smallNumbers = new uint[total];
+
+        std::cout << "Attempting to generate mixed requests of random uint on device..." << std::endl;
+        size_t done = 0;
+        for (int idx = 0; idx < NUM_REQUESTS; idx++) {
+            cl_mem dst = clCreateBuffer((*tmpStructPtr).ctx, CL_MEM_READ_WRITE, counts[idx] * sizeof(uint), NULL, &err);
+            if (err) {
+                std::cout << "ERROR: unable to create buffer for request!" << std::endl;
+                return err;
+            }
+            err = clrand_generate_stream(mixed, counts[idx], dst);
+            if (err == 0) {
+                err = clEnqueueReadBuffer((*tmpStructPtr).queue, dst, true, 0, counts[idx] * sizeof(uint), mixedNumbers + done, 0, NULL, NULL);
+            }
+            clReleaseMemObject(dst);
+            if (err) {
+                std::cout << "ERROR: unable to generate request of random uint!" << std::endl;
+                return err;
+            }
+            done += counts[idx];
+        }
+
+        std::cout << "Attempting to generate small requests of random uint..." << std::endl;
+        for (done = 0; done < total; done += SMALL_REQUEST) {
+            size_t count = (total - done < SMALL_REQUEST) ? (total - done) : SMALL_REQUEST;
+            err = clrand_generate_host(small, count, smallNumbers + done);
+            if (err) {
+                std::cout << "ERROR: unable to generate small request of random uint!" << std::endl;
+                return err;
+            }
+        }
+
+        uint err_counts = 0;
+        for (size_t idx = 0; idx < total; idx++) {
+            if (mixedNumbers[idx] != smallNumbers[idx]) {
+                err_counts++;
+            }
+        }
+        delete [] mixedNumbers;
+        delete [] smallNumbers;
+        delete mixed;
+        delete small;
+        if (err_counts == 0) {
+            std::cout << "No errors detected between mixed and small requests!" << std::endl;
+        } else {
+            std::cout << err_counts << " errors detected between mixed and small requests!" << std::endl;
+            return -2;
+        }
+    }
+
+    // Completed checks...
+    std::cout << "Checks completed!..." << std::endl;
+    free(tmpStructPtr);
+    return res;
+}
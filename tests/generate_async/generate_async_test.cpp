@@ -0,0 +1,168 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <getopt.h>
+#include "../../src/clrand.hpp"
+#include "utils.h"
+
+#define __CL_ENABLE_EXCEPTIONS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+
+#if defined(__APPLE__) || defined(__MACOSX)
+    #include <OpenCL/cl.h>
+#else
+    #include <CL/cl.h>
+#endif
+
+#define NUM_REQUESTS 4
+
+int main(int argc, char **argv) {
+    cl_int            err = -1;
+
+    oclStruct* tmpStructPtr = (oclStruct*) malloc(sizeof(oclStruct));
+    int res = makeOclStruct(argc, argv, tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to create oclStruct!\n");
+        return res;
+    }
+    res = printOclStructInfo(tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to print information about oclStruct!\n");
+        return res;
+    }
+
+    cl_device_id tmpDev = (*tmpStructPtr).target_device;
+    (*tmpStructPtr).ctx = clCreateContext(NULL, 1, &tmpDev, NULL, NULL, &err);
+    if (err) {
+        std::cout << "ERROR: unable to create context to extract random uint!" << std::endl;
+        return -1;
+    }
+
+    // Two streams with the same seed: one serves the requests
+    // asynchronously, the other serves them one blocking call at a time
+    clRAND* async = clrand_create_stream();
+    clRAND* sync = clrand_create_stream();
+    clrand_initialize_prng(async, (*tmpStructPtr).target_device, (*tmpStructPtr).ctx, CLRAND_GENERATOR_LCG6432);
+    clrand_initialize_prng(sync, (*tmpStructPtr).target_device, (*tmpStructPtr).ctx, CLRAND_GENERATOR_LCG6432);
+    err = clrand_ready_stream(async);
+    if (err) {
+        std::cout << "ERROR: unable to ready stream for asynchronous requests!" << std::endl;
+        return err;
+    }
+    err = clrand_ready_stream(sync);
+    if (err) {
+        std::cout << "ERROR: unable to ready stream for blocking requests!" << std::endl;
+        return err;
+    }
+    clrand_set_prng_seed(async, 1234);
+    clrand_set_prng_seed(sync, 1234);
+    (*tmpStructPtr).queue = async->GetStreamQueue();
+
+    // Mix of requests smaller and larger than the temporary buffers
+    size_t numPRNGs = async->GetNumberOfRNGs();
+    size_t counts[NUM_REQUESTS] = { 100, 5 * numPRNGs + 7, 33, 3 * numPRNGs };
+    cl_mem asyncDsts[NUM_REQUESTS];
+    cl_mem syncDsts[NUM_REQUESTS];
+    for (int idx = 0; idx < NUM_REQUESTS; idx++) {
+        asyncDsts[idx] = clCreateBuffer((*tmpStructPtr).ctx, CL_MEM_READ_WRITE, counts[idx] * sizeof(uint), NULL, &err);
+        if (err == 0) {
+            syncDsts[idx] = clCreateBuffer((*tmpStructPtr).ctx, CL_MEM_READ_WRITE, counts[idx] * sizeof(uint), NULL, &err);
+        }
+        if (err) {
+            std::cout << "ERROR: unable to create buffer for requests!" << std::endl;
+            return err;
+        }
+    }
+
+    // The first request waits on a user event, and each later one on the
+    // request before it, so none may complete before the user event does
+    std::cout << "Attempting to generate asynchronous requests of random uint on device..." << std::endl;
+    cl_event gate = clCreateUserEvent((*tmpStructPtr).ctx, &err);
+    if (err) {
+        std::cout << "ERROR: unable to create user event!" << std::endl;
+        return err;
+    }
+    cl_event events[NUM_REQUESTS];
+    for (int idx = 0; idx < NUM_REQUESTS; idx++) {
+        cl_event* wait_event = (idx == 0) ? &gate : &events[idx - 1];
+        err = clrand_generate_stream_async(async, counts[idx], asyncDsts[idx], 1, wait_event, &events[idx]);
+        if (err) {
+            std::cout << "ERROR: unable to enqueue asynchronous request of random uint!" << std::endl;
+            return err;
+        }
+    }
+    uint err_counts = 0;
+    for (int idx = 0; idx < NUM_REQUESTS; idx++) {
+        cl_int status = CL_COMPLETE;
+        err = clGetEventInfo(events[idx], CL_EVENT_COMMAND_EXECUTION_STATUS, sizeof(status), &status, NULL);
+        if (err) {
+            std::cout << "ERROR: unable to get status of asynchronous request!" << std::endl;
+            return err;
+        }
+        if (status == CL_COMPLETE) {
+            std::cout << "ERROR: request " << idx << " completed before the events it waits on!" << std::endl;
+            err_counts++;
+        }
+    }
+    clSetUserEventStatus(gate, CL_COMPLETE);
+    err = clWaitForEvents(1, &events[NUM_REQUESTS - 1]);
+    if (err) {
+        std::cout << "ERROR: unable to wait for asynchronous requests!" << std::endl;
+        return err;
+    }
+    for (int idx = 0; idx < NUM_REQUESTS; idx++) {
+        cl_int status = -1;
+        clGetEventInfo(events[idx], CL_EVENT_COMMAND_EXECUTION_STATUS, sizeof(status), &status, NULL);
+        if (status != CL_COMPLETE) {
+            std::cout << "ERROR: request " << idx << " did not complete before the request after it!" << std::endl;
+            err_counts++;
+        }
+        clReleaseEvent(events[idx]);
+    }
+    clReleaseEvent(gate);
+
+    std::cout << "Attempting to generate blocking requests of random uint on device..." << std::endl;
+    for (int idx = 0; idx < NUM_REQUESTS; idx++) {
+        err = clrand_generate_stream(sync, counts[idx], syncDsts[idx]);
+        if (err) {
+            std::cout << "ERROR: unable to generate blocking request of random uint!" << std::endl;
+            return err;
+        }
+    }
+
+    for (int idx = 0; idx < NUM_REQUESTS; idx++) {
+        uint* asyncNumbers = new uint[counts[idx]];
+        uint* syncNumbers = new uint[counts[idx]];
+        err = clEnqueueReadBuffer((*tmpStructPtr).queue, asyncDsts[idx], true, 0, counts[idx] * sizeof(uint), asyncNumbers, 0, NULL, NULL);
+        if (err == 0) {
+            err = clEnqueueReadBuffer((*tmpStructPtr).queue, syncDsts[idx], true, 0, counts[idx] * sizeof(uint), syncNumbers, 0, NULL, NULL);
+        }
+        if (err) {
+            std::cout << "ERROR: unable to read requests of random uint!" << std::endl;
+            return err;
+        }
+        for (size_t jdx = 0; jdx < counts[idx]; jdx++) {
+            if (asyncNumbers[jdx] != syncNumbers[jdx]) {
+                std::cout << "ERROR: numbers do not match at request = " << idx << ", idx = " << jdx << std::endl;
+                err_counts++;
+            }
+        }
+        delete [] asyncNumbers;
+        delete [] syncNumbers;
+        clReleaseMemObject(asyncDsts[idx]);
+        clReleaseMemObject(syncDsts[idx]);
+    }
+    if (err_counts == 0) {
+        std::cout << "No errors detected between asynchronous and blocking requests!" << std::endl;
+    } else {
+        std::cout << err_counts << " errors detected between asynchronous and blocking requests!" << std::endl;
+        return -2;
+    }
+
+    // Completed checks...
+    std::cout << "Checks completed!..." << std::endl;
+    delete async;
+    delete sync;
+    free(tmpStructPtr);
+    return res;
+}
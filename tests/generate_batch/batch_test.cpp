@@ -0,0 +1,134 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <getopt.h>
+#include "../../src/clrand.hpp"
+#include "utils.h"
+
+#define __CL_ENABLE_EXCEPTIONS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+
+#if defined(__APPLE__) || defined(__MACOSX)
+    #include <OpenCL/cl.h>
+#else
+    #include <CL/cl.h>
+#endif
+
+#define NUM_DSTS 11
+
+int main(int argc, char **argv) {
+    cl_int            err = -1;
+
+    oclStruct* tmpStructPtr = (oclStruct*) malloc(sizeof(oclStruct));
+    int res = makeOclStruct(argc, argv, tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to create oclStruct!\n");
+        return res;
+    }
+    res = printOclStructInfo(tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to print information about oclStruct!\n");
+        return res;
+    }
+
+    cl_device_id tmpDev = (*tmpStructPtr).target_device;
+    (*tmpStructPtr).ctx = clCreateContext(NULL, 1, &tmpDev, NULL, NULL, &err);
+    if (err) {
+        std::cout << "ERROR: unable to create context to extract random uint!" << std::endl;
+        return -1;
+    }
+
+    // Two streams with the same seed: one serves a batch, the other
+    // serves the same requests one at a time
+    clRAND* batch = clrand_create_stream();
+    clRAND* single = clrand_create_stream();
+    clrand_initialize_prng(batch, (*tmpStructPtr).target_device, (*tmpStructPtr).ctx, CLRAND_GENERATOR_LCG6432);
+    clrand_initialize_prng(single, (*tmpStructPtr).target_device, (*tmpStructPtr).ctx, CLRAND_GENERATOR_LCG6432);
+    err = clrand_ready_stream(batch);
+    if (err) {
+        std::cout << "ERROR: unable to ready stream for batch!" << std::endl;
+        return err;
+    }
+    err = clrand_ready_stream(single);
+    if (err) {
+        std::cout << "ERROR: unable to ready stream for single requests!" << std::endl;
+        return err;
+    }
+    clrand_set_prng_seed(batch, 1234);
+    clrand_set_prng_seed(single, 1234);
+    (*tmpStructPtr).queue = batch->GetStreamQueue();
+
+    // Mix of requests smaller and larger than the temporary buffers, over
+    // more destinations than one scatter launch serves
+    size_t numPRNGs = batch->GetNumberOfRNGs();
+    size_t counts[NUM_DSTS] = { 100, 5 * numPRNGs + 7, 33, 1, 2 * numPRNGs, 64, 3, 1000, numPRNGs + 1, 17, 250 };
+    size_t offsets[NUM_DSTS] = { 0, 10, 5, 0, 3, 0, 1, 100, 0, 7, 2 };
+    cl_mem batchDsts[NUM_DSTS];
+    cl_mem singleDsts[NUM_DSTS];
+    for (int idx = 0; idx < NUM_DSTS; idx++) {
+        batchDsts[idx] = clCreateBuffer((*tmpStructPtr).ctx, CL_MEM_READ_WRITE, (offsets[idx] + counts[idx]) * sizeof(uint), NULL, &err);
+        if (err) {
+            std::cout << "ERROR: unable to create buffer for batch!" << std::endl;
+            return err;
+        }
+        singleDsts[idx] = clCreateBuffer((*tmpStructPtr).ctx, CL_MEM_READ_WRITE, counts[idx] * sizeof(uint), NULL, &err);
+        if (err) {
+            std::cout << "ERROR: unable to create buffer for single requests!" << std::endl;
+            return err;
+        }
+    }
+
+    std::cout << "Attempting to generate batch of random uint on device..." << std::endl;
+    err = clrand_generate_batch(batch, NUM_DSTS, batchDsts, offsets, counts);
+    if (err) {
+        std::cout << "ERROR: unable to generate batch of random uint!" << std::endl;
+        return err;
+    }
+    std::cout << "Attempting to generate single requests of random uint on device..." << std::endl;
+    for (int idx = 0; idx < NUM_DSTS; idx++) {
+        err = clrand_generate_stream(single, counts[idx], singleDsts[idx]);
+        if (err) {
+            std::cout << "ERROR: unable to generate single request of random uint!" << std::endl;
+            return err;
+        }
+    }
+
+    uint err_counts = 0;
+    for (int idx = 0; idx < NUM_DSTS; idx++) {
+        uint* batchNumbers = new uint[counts[idx]];
+        uint* singleNumbers = new uint[counts[idx]];
+        err = clEnqueueReadBuffer((*tmpStructPtr).queue, batchDsts[idx], true, offsets[idx] * sizeof(uint), counts[idx] * sizeof(uint), batchNumbers, 0, NULL, NULL);
+        if (err) {
+            std::cout << "ERROR: unable to read batch of random uint!" << std::endl;
+            return err;
+        }
+        err = clEnqueueReadBuffer((*tmpStructPtr).queue, singleDsts[idx], true, 0, counts[idx] * sizeof(uint), singleNumbers, 0, NULL, NULL);
+        if (err) {
+            std::cout << "ERROR: unable to read single request of random uint!" << std::endl;
+            return err;
+        }
+        for (size_t jdx = 0; jdx < counts[idx]; jdx++) {
+            if (batchNumbers[jdx] != singleNumbers[jdx]) {
+                std::cout << "ERROR: numbers do not match at dst = " << idx << ", idx = " << jdx << std::endl;
+                err_counts++;
+            }
+        }
+        delete [] batchNumbers;
+        delete [] singleNumbers;
+        clReleaseMemObject(batchDsts[idx]);
+        clReleaseMemObject(singleDsts[idx]);
+    }
+    if (err_counts == 0) {
+        std::cout << "No errors detected between batch and single requests!" << std::endl;
+    } else {
+        std::cout << err_counts << " errors detected between batch and single requests!" << std::endl;
+        return -2;
+    }
+
+    // Completed checks...
+    std::cout << "Checks completed!..." << std::endl;
+    delete batch;
+    delete single;
+    free(tmpStructPtr);
+    return res;
+}
@@ -0,0 +1,122 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <getopt.h>
+#include "../../src/clrand.hpp"
+#include "utils.h"
+
+#define __CL_ENABLE_EXCEPTIONS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+
+#if defined(__APPLE__) || defined(__MACOSX)
+    #include <OpenCL/cl.h>
+#else
+    #include <CL/cl.h>
+#endif
+
+#define NUM_REQUESTS 3
+
+// Builds a stream seeded with 1234, with the given limit on the device
+// memory of its temporary and staging buffers (zero for the default)
+static clRAND* createStream(oclStruct* tmpStructPtr, clrandRngType rng_type, size_t budget) {
+    clRAND* test = clrand_create_stream();
+    if (budget > 0) {
+        clrand_set_tmp_buffer_budget(test, budget);
+    }
+    clrand_initialize_prng(test, (*tmpStructPtr).target_device, (*tmpStructPtr).ctx, rng_type);
+    cl_int err = clrand_ready_stream(test);
+    if (err) {
+        std::cout << "ERROR: unable to ready stream!" << std::endl;
+        delete test;
+        return NULL;
+    }
+    clrand_set_prng_seed(test, 1234);
+    return test;
+}
+
+int main(int argc, char **argv) {
+    cl_int            err = -1;
+
+    oclStruct* tmpStructPtr = (oclStruct*) malloc(sizeof(oclStruct));
+    int res = makeOclStruct(argc, argv, tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to create oclStruct!\n");
+        return res;
+    }
+    res = printOclStructInfo(tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to print information about oclStruct!\n");
+        return res;
+    }
+
+    cl_device_id tmpDev = (*tmpStructPtr).target_device;
+    (*tmpStructPtr).ctx = clCreateContext(NULL, 1, &tmpDev, NULL, NULL, &err);
+    if (err) {
+        std::cout << "ERROR: unable to create context to extract random uint!" << std::endl;
+        return -1;
+    }
+
+    // Numbers generated into host memory match numbers generated on the
+    // device and read back, for counts that are not a multiple of the fill
+    // size, and with a staging buffer smaller than the requests
+    clrandRngType rng_types[2] = { CLRAND_GENERATOR_LCG6432, CLRAND_GENERATOR_MT19937 };
+    size_t budgets[2] = { 0, 1 << 20 };
+    for (int r = 0; r < 2; r++) {
+        for (int b = 0; b < 2; b++) {
+            clRAND* host = createStream(tmpStructPtr, rng_types[r], budgets[b]);
+            clRAND* device = createStream(tmpStructPtr, rng_types[r], 0);
+            if ((host == NULL) || (device == NULL)) {
+                return -1;
+            }
+            (*tmpStructPtr).queue = device->GetStreamQueue();
+            clrandStreamStats stats;
+            clrand_get_stream_stats(device, &stats);
+            size_t entries = stats.tmp_buffer_entries;
+            size_t counts[NUM_REQUESTS] = { 12345, 3 * entries + 777, 1000001 };
+
+            std::cout << "Attempting to generate random uint into host and device memory..." << std::endl;
+            uint err_counts = 0;
+            for (int idx = 0; idx < NUM_REQUESTS; idx++) {
+                uint* hostNumbers = new uint[counts[idx]];
+                uint* deviceNumbers = new uint[counts[idx]];
+                cl_mem dst = clCreateBuffer((*tmpStructPtr).ctx, CL_MEM_READ_WRITE, counts[idx] * sizeof(uint), NULL, &err);
+                if (err) {
+                    std::cout << "ERROR: unable to create buffer for request!" << std::endl;
+                    return err;
+                }
+                err = clrand_generate_host(host, counts[idx], hostNumbers);
+                if (err == 0) {
+                    err = clrand_generate_stream(device, counts[idx], dst);
+                }
+                if (err == 0) {
+                    err = clEnqueueReadBuffer((*tmpStructPtr).queue, dst, true, 0, counts[idx] * sizeof(uint), deviceNumbers, 0, NULL, NULL);
+                }
+                clReleaseMemObject(dst);
+                if (err) {
+                    std::cout << "ERROR: unable to generate random uint!" << std::endl;
+                    return err;
+                }
+                for (size_t jdx = 0; jdx < counts[idx]; jdx++) {
+                    if (hostNumbers[jdx] != deviceNumbers[jdx]) {
+                        err_counts++;
+                    }
+                }
+                delete [] hostNumbers;
+                delete [] deviceNumbers;
+            }
+            delete host;
+            delete device;
+            if (err_counts == 0) {
+                std::cout << "No errors detected between host and device memory!" << std::endl;
+            } else {
+                std::cout << err_counts << " errors detected between host and device memory!" << std::endl;
+                return -2;
+            }
+        }
+    }
+
+    // Completed checks...
+    std::cout << "Checks completed!..." << std::endl;
+    free(tmpStructPtr);
+    return res;
+}
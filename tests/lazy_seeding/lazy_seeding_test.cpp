@@ -0,0 +1,120 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <getopt.h>
+#include "../../src/clrand.hpp"
+#include "utils.h"
+
+#define __CL_ENABLE_EXCEPTIONS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+
+#if defined(__APPLE__) || defined(__MACOSX)
+    #include <OpenCL/cl.h>
+#else
+    #include <CL/cl.h>
+#endif
+
+// Builds a stream seeded eagerly or lazily with the given scheme, and
+// generates count numbers into host memory in two requests, reseeding in
+// between when reseed is set. The scheme and stream id are changed after
+// each seeding, which must only affect the next seeding
+static cl_int generateNumbers(oclStruct* tmpStructPtr, clrandRngType rng_type, bool lazy, clrandSeedScheme scheme, bool reseed, size_t count, uint* numbers) {
+    clRAND* test = clrand_create_stream();
+    cl_int err = clrand_set_lazy_seeding(test, lazy ? 1 : 0);
+    if (err == 0) {
+        err = clrand_set_seed_scheme(test, scheme);
+    }
+    if (err) {
+        std::cout << "ERROR: unable to set seeding of stream!" << std::endl;
+        delete test;
+        return err;
+    }
+    clrand_initialize_prng(test, (*tmpStructPtr).target_device, (*tmpStructPtr).ctx, rng_type);
+    err = clrand_ready_stream(test);
+    if (err) {
+        std::cout << "ERROR: unable to ready stream!" << std::endl;
+        delete test;
+        return err;
+    }
+    clrandSeedScheme other = (scheme == CLRAND_SEED_LEGACY) ? CLRAND_SEED_SPLITMIX64 : CLRAND_SEED_LEGACY;
+    clrand_set_prng_seed(test, 1234);
+    clrand_set_seed_scheme(test, other);
+    clrand_set_stream_id(test, 7);
+    err = clrand_generate_host(test, count / 2, numbers);
+    if ((err == 0) && reseed) {
+        clrand_set_prng_seed(test, 5678);
+        clrand_set_seed_scheme(test, scheme);
+        clrand_set_stream_id(test, 0);
+    }
+    if (err == 0) {
+        err = clrand_generate_host(test, count - count / 2, numbers + count / 2);
+    }
+    if (err) {
+        std::cout << "ERROR: unable to generate random uint!" << std::endl;
+    }
+    delete test;
+    return err;
+}
+
+int main(int argc, char **argv) {
+    cl_int            err = -1;
+
+    oclStruct* tmpStructPtr = (oclStruct*) malloc(sizeof(oclStruct));
+    int res = makeOclStruct(argc, argv, tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to create oclStruct!\n");
+        return res;
+    }
+    res = printOclStructInfo(tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to print information about oclStruct!\n");
+        return res;
+    }
+
+    cl_device_id tmpDev = (*tmpStructPtr).target_device;
+    (*tmpStructPtr).ctx = clCreateContext(NULL, 1, &tmpDev, NULL, NULL, &err);
+    if (err) {
+        std::cout << "ERROR: unable to create context to extract random uint!" << std::endl;
+        return -1;
+    }
+
+    // Lazily seeded streams give the same numbers as eagerly seeded ones,
+    // with either seed scheme and after reseeding
+    clrandRngType rng_types[2] = { CLRAND_GENERATOR_LCG6432, CLRAND_GENERATOR_MT19937 };
+    clrandSeedScheme schemes[2] = { CLRAND_SEED_LEGACY, CLRAND_SEED_SPLITMIX64 };
+    size_t count = 1000000;
+    uint* eagerNumbers = new uint[count];
+    uint* lazyNumbers = new uint[count];
+    for (int r = 0; r < 2; r++) {
+        for (int c = 0; c < 4; c++) {
+            bool reseed = (c >= 2);
+            std::cout << "Attempting to generate random uint..." << std::endl;
+            err = generateNumbers(tmpStructPtr, rng_types[r], false, schemes[c % 2], reseed, count, eagerNumbers);
+            if (err == 0) {
+                err = generateNumbers(tmpStructPtr, rng_types[r], true, schemes[c % 2], reseed, count, lazyNumbers);
+            }
+            if (err) {
+                return err;
+            }
+            uint err_counts = 0;
+            for (size_t idx = 0; idx < count; idx++) {
+                if (eagerNumbers[idx] != lazyNumbers[idx]) {
+                    err_counts++;
+                }
+            }
+            if (err_counts == 0) {
+                std::cout << "No errors detected between eager and lazy seeding!" << std::endl;
+            } else {
+                std::cout << err_counts << " errors detected between eager and lazy seeding!" << std::endl;
+                return -2;
+            }
+        }
+    }
+    delete [] eagerNumbers;
+    delete [] lazyNumbers;
+
+    // Completed checks...
+    std::cout << "Checks completed!..." << std::endl;
+    free(tmpStructPtr);
+    return res;
+}
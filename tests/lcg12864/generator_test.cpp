@@ -95,6 +95,7 @@ int main(int argc, char **argv) {
     }
 
     clRAND* test = clrand_create_stream();
+    clrand_set_layout(test, CLRAND_LAYOUT_INTERLEAVED);
     clrand_initialize_prng(test, (*tmpStructPtr).target_device, (*tmpStructPtr).ctx, CLRAND_GENERATOR_LCG12864);
     (*tmpStructPtr).queue = test->GetStreamQueue();
 
@@ -48,6 +48,7 @@ int main(int argc, char **argv) {
     }
 
     clRAND* test = clrand_create_stream();
+    clrand_set_layout(test, CLRAND_LAYOUT_INTERLEAVED);
     clrand_initialize_prng(test, (*tmpStructPtr).target_device, (*tmpStructPtr).ctx, CLRAND_GENERATOR_LCG6432);
     (*tmpStructPtr).queue = test->GetStreamQueue();
 
@@ -0,0 +1,125 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <getopt.h>
+#include "../../src/clrand.hpp"
+#include "utils.h"
+
+#define __CL_ENABLE_EXCEPTIONS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+
+#if defined(__APPLE__) || defined(__MACOSX)
+    #include <OpenCL/cl.h>
+#else
+    #include <CL/cl.h>
+#endif
+
+#define NUM_GENERATORS 1000
+#define NUM_CONFIGS    3
+
+// Work configurations with fewer work-items than generators, more
+// work-items than generators, and the default of the device
+static const size_t configs[NUM_CONFIGS][3] = {
+    { 64, 4, 2 },
+    { 32, 64, 3 },
+    { 0, 0, 0 }
+};
+
+// Builds a stream of NUM_GENERATORS generators with the given work
+// configuration, and generates count numbers into host memory
+static cl_int generateNumbers(oclStruct* tmpStructPtr, clrandRngType rng_type, const size_t* config, size_t count, uint* numbers) {
+    clRAND* test = clrand_create_stream();
+    clrand_set_work_config(test, config[0], config[1], config[2]);
+    cl_int err = clrand_set_num_generators(test, NUM_GENERATORS);
+    if (err) {
+        std::cout << "ERROR: unable to set number of generators!" << std::endl;
+        delete test;
+        return err;
+    }
+    clrand_initialize_prng(test, (*tmpStructPtr).target_device, (*tmpStructPtr).ctx, rng_type);
+    err = clrand_ready_stream(test);
+    if (err) {
+        std::cout << "ERROR: unable to ready stream!" << std::endl;
+        delete test;
+        return err;
+    }
+    std::cout << "Work configuration: " << clrand_get_work_config(test, NULL) << std::endl;
+    if (clrand_get_num_prngs(test) != NUM_GENERATORS) {
+        std::cout << "ERROR: stream does not have " << NUM_GENERATORS << " generators!" << std::endl;
+        delete test;
+        return -2;
+    }
+    clrand_set_prng_seed(test, 1234);
+
+    // Two requests, so the states carried between launches are checked too
+    err = clrand_generate_host(test, count / 2, numbers);
+    if (err == 0) {
+        err = clrand_generate_host(test, count - count / 2, numbers + count / 2);
+    }
+    if (err) {
+        std::cout << "ERROR: unable to generate random uint!" << std::endl;
+    }
+    delete test;
+    return err;
+}
+
+int main(int argc, char **argv) {
+    cl_int            err = -1;
+
+    oclStruct* tmpStructPtr = (oclStruct*) malloc(sizeof(oclStruct));
+    int res = makeOclStruct(argc, argv, tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to create oclStruct!\n");
+        return res;
+    }
+    res = printOclStructInfo(tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to print information about oclStruct!\n");
+        return res;
+    }
+
+    cl_device_id tmpDev = (*tmpStructPtr).target_device;
+    (*tmpStructPtr).ctx = clCreateContext(NULL, 1, &tmpDev, NULL, NULL, &err);
+    if (err) {
+        std::cout << "ERROR: unable to create context to extract random uint!" << std::endl;
+        return -1;
+    }
+
+    // The same seed and number of generators give the same stream under
+    // every work configuration
+    clrandRngType rng_types[2] = { CLRAND_GENERATOR_LCG6432, CLRAND_GENERATOR_MT19937 };
+    size_t count = 1234567;
+    uint* reference = new uint[count];
+    uint* numbers = new uint[count];
+    for (int r = 0; r < 2; r++) {
+        for (int c = 0; c < NUM_CONFIGS; c++) {
+            std::cout << "Attempting to generate random uint..." << std::endl;
+            err = generateNumbers(tmpStructPtr, rng_types[r], configs[c], count, (c == 0) ? reference : numbers);
+            if (err) {
+                return err;
+            }
+            if (c == 0) {
+                continue;
+            }
+            uint err_counts = 0;
+            for (size_t idx = 0; idx < count; idx++) {
+                if (numbers[idx] != reference[idx]) {
+                    err_counts++;
+                }
+            }
+            if (err_counts == 0) {
+                std::cout << "No errors detected between work configurations!" << std::endl;
+            } else {
+                std::cout << err_counts << " errors detected between work configurations!" << std::endl;
+                return -2;
+            }
+        }
+    }
+    delete [] reference;
+    delete [] numbers;
+
+    // Completed checks...
+    std::cout << "Checks completed!..." << std::endl;
+    free(tmpStructPtr);
+    return res;
+}
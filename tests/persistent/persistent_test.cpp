@@ -0,0 +1,118 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <getopt.h>
+#include "../../src/clrand.hpp"
+#include "utils.h"
+
+#define __CL_ENABLE_EXCEPTIONS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+
+#if defined(__APPLE__) || defined(__MACOSX)
+    #include <OpenCL/cl.h>
+#else
+    #include <CL/cl.h>
+#endif
+
+#define NUM_REQUESTS 3
+
+// Builds an mt19937 stream with or without the persistent kernel and a
+// launch limit of one fill, then generates requests spanning many fills
+// into a device buffer and reads them back
+static cl_int generateNumbers(oclStruct* tmpStructPtr, bool persistent, size_t count, uint* numbers) {
+    clRAND* test = clrand_create_stream();
+    clrand_set_persistent_kernel(test, persistent ? 1 : 0);
+    cl_int err = clrand_initialize_prng(test, (*tmpStructPtr).target_device, (*tmpStructPtr).ctx, CLRAND_GENERATOR_MT19937);
+    if (err) {
+        std::cout << "ERROR: unable to initialize stream!" << std::endl;
+        return err;
+    }
+    clrand_set_max_launch_count(test, 1);
+    err = clrand_ready_stream(test);
+    if (err) {
+        std::cout << "ERROR: unable to ready stream!" << std::endl;
+        return err;
+    }
+    clrand_set_prng_seed(test, 1234);
+    cl_mem dst = clCreateBuffer((*tmpStructPtr).ctx, CL_MEM_READ_WRITE, count * sizeof(uint), NULL, &err);
+    if (err) {
+        std::cout << "ERROR: unable to create buffer for random numbers!" << std::endl;
+        return err;
+    }
+    size_t done = 0;
+    for (int idx = 0; idx < NUM_REQUESTS; idx++) {
+        size_t num = (idx == NUM_REQUESTS - 1) ? (count - done) : (count / NUM_REQUESTS + 12345 * idx);
+        err = clrand_generate_stream(test, num, dst);
+        if (err) {
+            std::cout << "ERROR: unable to generate random uint!" << std::endl;
+            break;
+        }
+        err = clEnqueueReadBuffer(test->GetStreamQueue(), dst, true, 0, num * sizeof(uint), numbers + done, 0, NULL, NULL);
+        if (err) {
+            std::cout << "ERROR: unable to read random uint!" << std::endl;
+            break;
+        }
+        done += num;
+    }
+    clrandStreamStats stats;
+    clrand_get_stream_stats(test, &stats);
+    std::cout << (persistent ? "Persistent" : "Split") << " kernels launched: " << stats.fill_count << std::endl;
+    clReleaseMemObject(dst);
+    delete test;
+    return err;
+}
+
+int main(int argc, char **argv) {
+    cl_int            err = -1;
+
+    oclStruct* tmpStructPtr = (oclStruct*) malloc(sizeof(oclStruct));
+    int res = makeOclStruct(argc, argv, tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to create oclStruct!\n");
+        return res;
+    }
+    res = printOclStructInfo(tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to print information about oclStruct!\n");
+        return res;
+    }
+
+    cl_device_id tmpDev = (*tmpStructPtr).target_device;
+    (*tmpStructPtr).ctx = clCreateContext(NULL, 1, &tmpDev, NULL, NULL, &err);
+    if (err) {
+        std::cout << "ERROR: unable to create context to extract random uint!" << std::endl;
+        return -1;
+    }
+
+    size_t count = 10000000;
+    uint* splitNumbers = new uint[count];
+    uint* persistentNumbers = new uint[count];
+    err = generateNumbers(tmpStructPtr, false, count, splitNumbers);
+    if (err) {
+        return err;
+    }
+    err = generateNumbers(tmpStructPtr, true, count, persistentNumbers);
+    if (err) {
+        return err;
+    }
+
+    uint err_counts = 0;
+    for (size_t idx = 0; idx < count; idx++) {
+        if (splitNumbers[idx] != persistentNumbers[idx]) {
+            err_counts++;
+        }
+    }
+    delete [] splitNumbers;
+    delete [] persistentNumbers;
+    if (err_counts == 0) {
+        std::cout << "No errors detected between split and persistent launches!" << std::endl;
+    } else {
+        std::cout << err_counts << " errors detected between split and persistent launches!" << std::endl;
+        return -2;
+    }
+
+    // Completed checks...
+    std::cout << "Checks completed!..." << std::endl;
+    free(tmpStructPtr);
+    return res;
+}
@@ -0,0 +1,112 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <getopt.h>
+#include "../../src/clrand.hpp"
+#include "utils.h"
+
+#define __CL_ENABLE_EXCEPTIONS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+
+#if defined(__APPLE__) || defined(__MACOSX)
+    #include <OpenCL/cl.h>
+#else
+    #include <CL/cl.h>
+#endif
+
+// Builds a stream with the given number of temporary buffers, and
+// generates count numbers into host memory after seeding it with 1234. When
+// reseed is set, the stream is first seeded with 5678 and numbers are left
+// buffered from that seed.
+static cl_int generateNumbers(oclStruct* tmpStructPtr, clrandRngType rng_type, size_t num_tmp_buffers, bool reseed, size_t count, uint* numbers) {
+    clRAND* test = clrand_create_stream();
+    cl_int err = clrand_set_num_tmp_buffers(test, num_tmp_buffers);
+    if (err) {
+        std::cout << "ERROR: unable to set number of temporary buffers!" << std::endl;
+        delete test;
+        return err;
+    }
+    clrand_initialize_prng(test, (*tmpStructPtr).target_device, (*tmpStructPtr).ctx, rng_type);
+    err = clrand_ready_stream(test);
+    if (err) {
+        std::cout << "ERROR: unable to ready stream!" << std::endl;
+        delete test;
+        return err;
+    }
+    if (reseed) {
+        clrand_set_prng_seed(test, 5678);
+        err = clrand_generate_host(test, 1000, numbers);
+    }
+    if (err == 0) {
+        clrand_set_prng_seed(test, 1234);
+        err = clrand_generate_host(test, count, numbers);
+    }
+    if (err) {
+        std::cout << "ERROR: unable to generate random uint!" << std::endl;
+    }
+    delete test;
+    return err;
+}
+
+int main(int argc, char **argv) {
+    cl_int            err = -1;
+
+    oclStruct* tmpStructPtr = (oclStruct*) malloc(sizeof(oclStruct));
+    int res = makeOclStruct(argc, argv, tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to create oclStruct!\n");
+        return res;
+    }
+    res = printOclStructInfo(tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to print information about oclStruct!\n");
+        return res;
+    }
+
+    cl_device_id tmpDev = (*tmpStructPtr).target_device;
+    (*tmpStructPtr).ctx = clCreateContext(NULL, 1, &tmpDev, NULL, NULL, &err);
+    if (err) {
+        std::cout << "ERROR: unable to create context to extract random uint!" << std::endl;
+        return -1;
+    }
+
+    // A reseeded stream drops the numbers buffered from its previous seed,
+    // and gives the same numbers as a stream seeded once, with one
+    // temporary buffer or a ring of them
+    clrandRngType rng_types[2] = { CLRAND_GENERATOR_LCG6432, CLRAND_GENERATOR_MT19937 };
+    size_t num_tmp_buffers[2] = { 1, 3 };
+    size_t count = 1000000;
+    uint* onceNumbers = new uint[count];
+    uint* reseedNumbers = new uint[count];
+    for (int r = 0; r < 2; r++) {
+        for (int b = 0; b < 2; b++) {
+            std::cout << "Attempting to generate random uint..." << std::endl;
+            err = generateNumbers(tmpStructPtr, rng_types[r], num_tmp_buffers[b], false, count, onceNumbers);
+            if (err == 0) {
+                err = generateNumbers(tmpStructPtr, rng_types[r], num_tmp_buffers[b], true, count, reseedNumbers);
+            }
+            if (err) {
+                return err;
+            }
+            uint err_counts = 0;
+            for (size_t idx = 0; idx < count; idx++) {
+                if (onceNumbers[idx] != reseedNumbers[idx]) {
+                    err_counts++;
+                }
+            }
+            if (err_counts == 0) {
+                std::cout << "No errors detected between reseeded and fresh streams!" << std::endl;
+            } else {
+                std::cout << err_counts << " errors detected between reseeded and fresh streams!" << std::endl;
+                return -2;
+            }
+        }
+    }
+    delete [] onceNumbers;
+    delete [] reseedNumbers;
+
+    // Completed checks...
+    std::cout << "Checks completed!..." << std::endl;
+    free(tmpStructPtr);
+    return res;
+}
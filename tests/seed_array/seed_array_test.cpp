@@ -0,0 +1,130 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <getopt.h>
+#include "../../src/clrand.hpp"
+#include "utils.h"
+
+#define __CL_ENABLE_EXCEPTIONS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+
+#if defined(__APPLE__) || defined(__MACOSX)
+    #include <OpenCL/cl.h>
+#else
+    #include <CL/cl.h>
+#endif
+
+// Counts the entries that differ between two sets of numbers
+static uint countErrors(const uint* a, const uint* b, size_t count) {
+    uint err_counts = 0;
+    for (size_t idx = 0; idx < count; idx++) {
+        if (a[idx] != b[idx]) {
+            err_counts++;
+        }
+    }
+    return err_counts;
+}
+
+int main(int argc, char **argv) {
+    cl_int            err = -1;
+
+    oclStruct* tmpStructPtr = (oclStruct*) malloc(sizeof(oclStruct));
+    int res = makeOclStruct(argc, argv, tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to create oclStruct!\n");
+        return res;
+    }
+    res = printOclStructInfo(tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to print information about oclStruct!\n");
+        return res;
+    }
+
+    cl_device_id tmpDev = (*tmpStructPtr).target_device;
+    (*tmpStructPtr).ctx = clCreateContext(NULL, 1, &tmpDev, NULL, NULL, &err);
+    if (err) {
+        std::cout << "ERROR: unable to create context to extract random uint!" << std::endl;
+        return -1;
+    }
+
+    clRAND* test = clrand_create_stream();
+    clrand_initialize_prng(test, (*tmpStructPtr).target_device, (*tmpStructPtr).ctx, CLRAND_GENERATOR_LCG6432);
+    err = clrand_ready_stream(test);
+    if (err) {
+        std::cout << "ERROR: unable to ready stream!" << std::endl;
+        return err;
+    }
+
+    // Seeds matching the ones derived from a seed value of 1234
+    size_t num = clrand_get_num_prngs(test);
+    cl_ulong* seeds = new cl_ulong[num];
+    for (size_t i = 0; i < num; i++) {
+        seeds[i] = (((cl_ulong)(i)) << 1) + 1234;
+    }
+    size_t count = 1000000;
+    uint* valueNumbers = new uint[count];
+    uint* arrayNumbers = new uint[count];
+    uint* bufferNumbers = new uint[count];
+
+    std::cout << "Attempting to generate random uint from a seed value..." << std::endl;
+    clrand_set_prng_seed(test, 1234);
+    err = clrand_generate_host(test, count, valueNumbers);
+    if (err) {
+        std::cout << "ERROR: unable to generate random uint!" << std::endl;
+        return err;
+    }
+
+    std::cout << "Attempting to generate random uint from an array of seeds..." << std::endl;
+    err = clrand_seed_from_array(test, seeds, num);
+    if (err) {
+        std::cout << "ERROR: unable to seed from array!" << std::endl;
+        return err;
+    }
+    err = clrand_generate_host(test, count, arrayNumbers);
+    if (err) {
+        std::cout << "ERROR: unable to generate random uint!" << std::endl;
+        return err;
+    }
+
+    std::cout << "Attempting to generate random uint from a buffer of seeds..." << std::endl;
+    cl_mem seedBuffer = clCreateBuffer((*tmpStructPtr).ctx, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, num * sizeof(cl_ulong), seeds, &err);
+    if (err) {
+        std::cout << "ERROR: unable to create buffer for seeds!" << std::endl;
+        return err;
+    }
+    err = clrand_seed_from_buffer(test, seedBuffer, num);
+    if (err) {
+        std::cout << "ERROR: unable to seed from buffer!" << std::endl;
+        return err;
+    }
+    err = clrand_generate_host(test, count, bufferNumbers);
+    if (err) {
+        std::cout << "ERROR: unable to generate random uint!" << std::endl;
+        return err;
+    }
+
+    // A wrong number of seeds is rejected
+    if (clrand_seed_from_array(test, seeds, num - 1) == 0) {
+        std::cout << "ERROR: seeding from too few seeds did not fail!" << std::endl;
+        return -2;
+    }
+
+    uint err_counts = countErrors(valueNumbers, arrayNumbers, count) + countErrors(valueNumbers, bufferNumbers, count);
+    clReleaseMemObject(seedBuffer);
+    delete [] seeds;
+    delete [] valueNumbers;
+    delete [] arrayNumbers;
+    delete [] bufferNumbers;
+    if (err_counts == 0) {
+        std::cout << "No errors detected between seed value, array and buffer!" << std::endl;
+    } else {
+        std::cout << err_counts << " errors detected between seed value, array and buffer!" << std::endl;
+        return -2;
+    }
+
+    // Completed checks...
+    std::cout << "Checks completed!..." << std::endl;
+    delete test;
+    free(tmpStructPtr);
+    return res;
+}
@@ -0,0 +1,119 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <getopt.h>
+#include "../../src/clrand.hpp"
+#include "utils.h"
+
+#define __CL_ENABLE_EXCEPTIONS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+
+#if defined(__APPLE__) || defined(__MACOSX)
+    #include <OpenCL/cl.h>
+#else
+    #include <CL/cl.h>
+#endif
+
+// Seeds the stream with the given scheme and stream id, and generates
+// count numbers into host memory
+static cl_int generateNumbers(clRAND* test, clrandSeedScheme scheme, cl_ulong id, size_t count, uint* numbers) {
+    cl_int err = clrand_set_seed_scheme(test, scheme);
+    if (err) {
+        std::cout << "ERROR: unable to set seed scheme!" << std::endl;
+        return err;
+    }
+    clrand_set_stream_id(test, id);
+    clrand_set_prng_seed(test, 1234);
+    err = clrand_generate_host(test, count, numbers);
+    if (err) {
+        std::cout << "ERROR: unable to generate random uint!" << std::endl;
+    }
+    return err;
+}
+
+// Counts the entries that are equal between two sets of numbers
+static size_t countEqual(const uint* a, const uint* b, size_t count) {
+    size_t equal = 0;
+    for (size_t idx = 0; idx < count; idx++) {
+        if (a[idx] == b[idx]) {
+            equal++;
+        }
+    }
+    return equal;
+}
+
+int main(int argc, char **argv) {
+    cl_int            err = -1;
+
+    oclStruct* tmpStructPtr = (oclStruct*) malloc(sizeof(oclStruct));
+    int res = makeOclStruct(argc, argv, tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to create oclStruct!\n");
+        return res;
+    }
+    res = printOclStructInfo(tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to print information about oclStruct!\n");
+        return res;
+    }
+
+    cl_device_id tmpDev = (*tmpStructPtr).target_device;
+    (*tmpStructPtr).ctx = clCreateContext(NULL, 1, &tmpDev, NULL, NULL, &err);
+    if (err) {
+        std::cout << "ERROR: unable to create context to extract random uint!" << std::endl;
+        return -1;
+    }
+
+    clRAND* test = clrand_create_stream();
+    clrand_initialize_prng(test, (*tmpStructPtr).target_device, (*tmpStructPtr).ctx, CLRAND_GENERATOR_LCG6432);
+    err = clrand_ready_stream(test);
+    if (err) {
+        std::cout << "ERROR: unable to ready stream!" << std::endl;
+        return err;
+    }
+
+    size_t count = 1000000;
+    uint* legacyNumbers = new uint[count];
+    uint* hashNumbers = new uint[count];
+    uint* repeatNumbers = new uint[count];
+    uint* streamNumbers = new uint[count];
+    std::cout << "Attempting to generate random uint with each seed scheme..." << std::endl;
+    err = generateNumbers(test, CLRAND_SEED_LEGACY, 0, count, legacyNumbers);
+    if (err == 0) {
+        err = generateNumbers(test, CLRAND_SEED_SPLITMIX64, 0, count, hashNumbers);
+    }
+    if (err == 0) {
+        err = generateNumbers(test, CLRAND_SEED_SPLITMIX64, 0, count, repeatNumbers);
+    }
+    if (err == 0) {
+        err = generateNumbers(test, CLRAND_SEED_SPLITMIX64, 1, count, streamNumbers);
+    }
+    if (err) {
+        return err;
+    }
+
+    // The hashed seeds are reproducible, and differ from the legacy seeds
+    // and between stream ids
+    if (countEqual(hashNumbers, repeatNumbers, count) != count) {
+        std::cout << "ERROR: hashed seeds are not reproducible!" << std::endl;
+        return -2;
+    }
+    size_t legacyEqual = countEqual(hashNumbers, legacyNumbers, count);
+    size_t streamEqual = countEqual(hashNumbers, streamNumbers, count);
+    if ((legacyEqual > count / 1000) || (streamEqual > count / 1000)) {
+        std::cout << "ERROR: " << legacyEqual << " and " << streamEqual << " numbers equal between schemes and streams!" << std::endl;
+        return -2;
+    }
+    std::cout << "No errors detected between seed schemes and stream ids!" << std::endl;
+
+    delete [] legacyNumbers;
+    delete [] hashNumbers;
+    delete [] repeatNumbers;
+    delete [] streamNumbers;
+
+    // Completed checks...
+    std::cout << "Checks completed!..." << std::endl;
+    delete test;
+    free(tmpStructPtr);
+    return res;
+}
@@ -0,0 +1,128 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <getopt.h>
+#include "../../src/clrand.hpp"
+#include "utils.h"
+
+#define __CL_ENABLE_EXCEPTIONS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+
+#if defined(__APPLE__) || defined(__MACOSX)
+    #include <OpenCL/cl.h>
+#else
+    #include <CL/cl.h>
+#endif
+
+#define NUM_STREAMS 4
+
+int main(int argc, char **argv) {
+    cl_int            err = -1;
+
+    oclStruct* tmpStructPtr = (oclStruct*) malloc(sizeof(oclStruct));
+    int res = makeOclStruct(argc, argv, tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to create oclStruct!\n");
+        return res;
+    }
+    res = printOclStructInfo(tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to print information about oclStruct!\n");
+        return res;
+    }
+
+    cl_device_id tmpDev = (*tmpStructPtr).target_device;
+    (*tmpStructPtr).ctx = clCreateContext(NULL, 1, &tmpDev, NULL, NULL, &err);
+    if (err) {
+        std::cout << "ERROR: unable to create context to extract random uint!" << std::endl;
+        return -1;
+    }
+
+    // Streams of the same generator share one program and one queue
+    clRAND* streams[NUM_STREAMS];
+    for (int idx = 0; idx < NUM_STREAMS; idx++) {
+        streams[idx] = clrand_create_stream();
+        clrand_set_shared_queue(streams[idx], 1);
+        err = clrand_initialize_prng(streams[idx], (*tmpStructPtr).target_device, (*tmpStructPtr).ctx, CLRAND_GENERATOR_LCG6432);
+        if (err) {
+            std::cout << "ERROR: unable to initialize stream!" << std::endl;
+            return err;
+        }
+        err = clrand_ready_stream(streams[idx]);
+        if (err) {
+            std::cout << "ERROR: unable to ready stream!" << std::endl;
+            return err;
+        }
+        clrand_set_prng_seed(streams[idx], 1234);
+    }
+    size_t num_programs = clrand_get_num_cached_programs();
+    if (num_programs != 1) {
+        std::cout << "ERROR: expected 1 cached program, found " << num_programs << "!" << std::endl;
+        return -2;
+    }
+    if (streams[0]->GetStreamQueue() != streams[NUM_STREAMS - 1]->GetStreamQueue()) {
+        std::cout << "ERROR: streams do not share their queue!" << std::endl;
+        return -2;
+    }
+    (*tmpStructPtr).queue = streams[0]->GetStreamQueue();
+
+    // Streams with the same seed give the same numbers even when their
+    // work is interleaved on the shared queue
+    int count = 1000;
+    cl_mem dsts[NUM_STREAMS];
+    for (int idx = 0; idx < NUM_STREAMS; idx++) {
+        dsts[idx] = clCreateBuffer((*tmpStructPtr).ctx, CL_MEM_READ_WRITE, count * sizeof(uint), NULL, &err);
+        if (err) {
+            std::cout << "ERROR: unable to create buffer for random numbers!" << std::endl;
+            return err;
+        }
+        err = clrand_generate_stream(streams[idx], count, dsts[idx]);
+        if (err) {
+            std::cout << "ERROR: unable to generate random uint!" << std::endl;
+            return err;
+        }
+    }
+
+    uint err_counts = 0;
+    uint* refNumbers = new uint[count];
+    uint* outNumbers = new uint[count];
+    err = clEnqueueReadBuffer((*tmpStructPtr).queue, dsts[0], true, 0, count * sizeof(uint), refNumbers, 0, NULL, NULL);
+    if (err) {
+        std::cout << "ERROR: unable to read random uint!" << std::endl;
+        return err;
+    }
+    for (int idx = 1; idx < NUM_STREAMS; idx++) {
+        err = clEnqueueReadBuffer((*tmpStructPtr).queue, dsts[idx], true, 0, count * sizeof(uint), outNumbers, 0, NULL, NULL);
+        if (err) {
+            std::cout << "ERROR: unable to read random uint!" << std::endl;
+            return err;
+        }
+        for (int jdx = 0; jdx < count; jdx++) {
+            if (outNumbers[jdx] != refNumbers[jdx]) {
+                err_counts++;
+            }
+        }
+    }
+    delete [] refNumbers;
+    delete [] outNumbers;
+    for (int idx = 0; idx < NUM_STREAMS; idx++) {
+        clReleaseMemObject(dsts[idx]);
+        delete streams[idx];
+    }
+    if (err_counts == 0) {
+        std::cout << "No errors detected between streams sharing a program!" << std::endl;
+    } else {
+        std::cout << err_counts << " errors detected between streams sharing a program!" << std::endl;
+        return -2;
+    }
+    num_programs = clrand_get_num_cached_programs();
+    if (num_programs != 0) {
+        std::cout << "ERROR: program cache not emptied after streams were deleted!" << std::endl;
+        return -2;
+    }
+
+    // Completed checks...
+    std::cout << "Checks completed!..." << std::endl;
+    free(tmpStructPtr);
+    return res;
+}
@@ -0,0 +1,103 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <getopt.h>
+#include "../../src/clrand.hpp"
+#include "utils.h"
+
+#define __CL_ENABLE_EXCEPTIONS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+
+#if defined(__APPLE__) || defined(__MACOSX)
+    #include <OpenCL/cl.h>
+#else
+    #include <CL/cl.h>
+#endif
+
+// Builds a stream with or without specialized kernels and generates
+// count numbers into host memory, in requests smaller than a fill
+static cl_int generateNumbers(oclStruct* tmpStructPtr, bool specialized, size_t count, uint* numbers) {
+    clRAND* test = clrand_create_stream();
+    clrand_set_specialized_kernels(test, specialized ? 1 : 0);
+    clrand_set_unroll_factor(test, 8);
+    cl_int err = clrand_initialize_prng(test, (*tmpStructPtr).target_device, (*tmpStructPtr).ctx, CLRAND_GENERATOR_MRG31K3P);
+    if (err) {
+        std::cout << "ERROR: unable to initialize stream!" << std::endl;
+        return err;
+    }
+    clrand_set_adaptive_tmp_buffers(test, 0);
+    err = clrand_ready_stream(test);
+    if (err) {
+        std::cout << "ERROR: unable to ready stream!" << std::endl;
+        return err;
+    }
+    clrand_set_prng_seed(test, 1234);
+    for (size_t done = 0; done < count; done += 1000) {
+        size_t num = (count - done < 1000) ? (count - done) : 1000;
+        err = clrand_generate_host(test, num, numbers + done);
+        if (err) {
+            std::cout << "ERROR: unable to generate random uint!" << std::endl;
+            break;
+        }
+    }
+    clrandStreamStats stats;
+    clrand_get_stream_stats(test, &stats);
+    std::cout << (specialized ? "Specialized" : "Generic") << " kernels launched: " << stats.fill_count << std::endl;
+    delete test;
+    return err;
+}
+
+int main(int argc, char **argv) {
+    cl_int            err = -1;
+
+    oclStruct* tmpStructPtr = (oclStruct*) malloc(sizeof(oclStruct));
+    int res = makeOclStruct(argc, argv, tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to create oclStruct!\n");
+        return res;
+    }
+    res = printOclStructInfo(tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to print information about oclStruct!\n");
+        return res;
+    }
+
+    cl_device_id tmpDev = (*tmpStructPtr).target_device;
+    (*tmpStructPtr).ctx = clCreateContext(NULL, 1, &tmpDev, NULL, NULL, &err);
+    if (err) {
+        std::cout << "ERROR: unable to create context to extract random uint!" << std::endl;
+        return -1;
+    }
+
+    size_t count = 100000;
+    uint* genericNumbers = new uint[count];
+    uint* specializedNumbers = new uint[count];
+    err = generateNumbers(tmpStructPtr, false, count, genericNumbers);
+    if (err) {
+        return err;
+    }
+    err = generateNumbers(tmpStructPtr, true, count, specializedNumbers);
+    if (err) {
+        return err;
+    }
+
+    uint err_counts = 0;
+    for (size_t idx = 0; idx < count; idx++) {
+        if (genericNumbers[idx] != specializedNumbers[idx]) {
+            err_counts++;
+        }
+    }
+    delete [] genericNumbers;
+    delete [] specializedNumbers;
+    if (err_counts == 0) {
+        std::cout << "No errors detected between generic and specialized kernels!" << std::endl;
+    } else {
+        std::cout << err_counts << " errors detected between generic and specialized kernels!" << std::endl;
+        return -2;
+    }
+
+    // Completed checks...
+    std::cout << "Checks completed!..." << std::endl;
+    free(tmpStructPtr);
+    return res;
+}
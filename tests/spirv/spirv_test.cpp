@@ -0,0 +1,118 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <getopt.h>
+#include "../../src/clrand.hpp"
+#include "utils.h"
+
+#define __CL_ENABLE_EXCEPTIONS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+
+#if defined(__APPLE__) || defined(__MACOSX)
+    #include <OpenCL/cl.h>
+#else
+    #include <CL/cl.h>
+#endif
+
+// Builds a stream seeded with 1234, and generates count numbers into host
+// memory. Streams with a macro in their build options are never created
+// from the embedded SPIR-V, so they are built from source.
+static cl_int generateNumbers(oclStruct* tmpStructPtr, clrandRngType rng_type, const char* precision, bool source, size_t count, void* numbers) {
+    clRAND* test = clrand_create_stream();
+    if (source) {
+        clrand_set_build_options(test, "-DCLRAND_SOURCE_BUILD");
+    }
+    (*test).Init((*tmpStructPtr).target_device, (*tmpStructPtr).ctx, rng_type);
+    cl_int err = clrand_set_prng_precision(test, precision);
+    if (err == 0) {
+        (*test).BuildSource();
+        err = (*test).BuildKernelProgram();
+    }
+    if (err == 0) {
+        err = clrand_ready_stream(test);
+    }
+    if (err) {
+        std::cout << "ERROR: unable to ready stream!" << std::endl;
+        delete test;
+        return err;
+    }
+    clrand_set_prng_seed(test, 1234);
+    err = clrand_generate_host(test, count, numbers);
+    if (err) {
+        std::cout << "ERROR: unable to generate random " << precision << "!" << std::endl;
+    }
+    delete test;
+    return err;
+}
+
+int main(int argc, char **argv) {
+    cl_int            err = -1;
+
+    oclStruct* tmpStructPtr = (oclStruct*) malloc(sizeof(oclStruct));
+    int res = makeOclStruct(argc, argv, tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to create oclStruct!\n");
+        return res;
+    }
+    res = printOclStructInfo(tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to print information about oclStruct!\n");
+        return res;
+    }
+
+    cl_device_id tmpDev = (*tmpStructPtr).target_device;
+    (*tmpStructPtr).ctx = clCreateContext(NULL, 1, &tmpDev, NULL, NULL, &err);
+    if (err) {
+        std::cout << "ERROR: unable to create context to extract random uint!" << std::endl;
+        return -1;
+    }
+
+    // No binaries from earlier runs, so programs come from the embedded
+    // SPIR-V or from source
+    clrand_set_cache_dir("");
+
+    // Streams created from the embedded SPIR-V give the same numbers as
+    // streams built from source
+    clrandRngType rng_types[2] = { CLRAND_GENERATOR_LCG6432, CLRAND_GENERATOR_PHILOX2X32_10 };
+    const char* precisions[2] = { "uint", "float" };
+    size_t count = 1000000;
+    uint* embeddedNumbers = new uint[count];
+    uint* sourceNumbers = new uint[count];
+    for (int r = 0; r < 2; r++) {
+        clrandCacheStats before;
+        clrandCacheStats after;
+        std::cout << "Attempting to generate random " << precisions[r] << " from embedded SPIR-V..." << std::endl;
+        clrand_get_cache_stats(&before);
+        err = generateNumbers(tmpStructPtr, rng_types[r], precisions[r], false, count, embeddedNumbers);
+        clrand_get_cache_stats(&after);
+        if (err == 0) {
+            err = generateNumbers(tmpStructPtr, rng_types[r], precisions[r], true, count, sourceNumbers);
+        }
+        if (err) {
+            return err;
+        }
+        if (after.il_loads == before.il_loads) {
+            std::cout << "Embedded SPIR-V not used (library built without SPIRV=1, or device without SPIR-V support)" << std::endl;
+        }
+        // Both precisions are 32 bits wide, so the numbers compare bit for bit
+        uint err_counts = 0;
+        for (size_t idx = 0; idx < count; idx++) {
+            if (embeddedNumbers[idx] != sourceNumbers[idx]) {
+                err_counts++;
+            }
+        }
+        if (err_counts == 0) {
+            std::cout << "No errors detected between embedded SPIR-V and source!" << std::endl;
+        } else {
+            std::cout << err_counts << " errors detected between embedded SPIR-V and source!" << std::endl;
+            return -2;
+        }
+    }
+    delete [] embeddedNumbers;
+    delete [] sourceNumbers;
+
+    // Completed checks...
+    std::cout << "Checks completed!..." << std::endl;
+    free(tmpStructPtr);
+    return res;
+}
@@ -0,0 +1,157 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <getopt.h>
+#include "../../src/clrand.hpp"
+#include "utils.h"
+
+#define __CL_ENABLE_EXCEPTIONS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+
+#if defined(__APPLE__) || defined(__MACOSX)
+    #include <OpenCL/cl.h>
+#else
+    #include <CL/cl.h>
+#endif
+
+#define LARGE_REQUESTS 40
+#define SMALL_REQUESTS 2000
+#define SMALL_REQUEST  10
+
+// Builds a stream seeded with 1234, with or without temporary buffers
+// sized from the requests
+static clRAND* createStream(oclStruct* tmpStructPtr, bool adaptive) {
+    clRAND* test = clrand_create_stream();
+    clrand_set_adaptive_tmp_buffers(test, adaptive ? 1 : 0);
+    clrand_initialize_prng(test, (*tmpStructPtr).target_device, (*tmpStructPtr).ctx, CLRAND_GENERATOR_LCG6432);
+    cl_int err = clrand_ready_stream(test);
+    if (err) {
+        std::cout << "ERROR: unable to ready stream!" << std::endl;
+        delete test;
+        return NULL;
+    }
+    clrand_set_prng_seed(test, 1234);
+    return test;
+}
+
+// Serves num requests of count numbers from both streams, and counts the
+// numbers that differ between them
+static cl_int generateNumbers(clRAND* adaptive, clRAND* fixed, size_t num, size_t count, uint* err_counts) {
+    uint* adaptiveNumbers = new uint[count];
+    uint* fixedNumbers = new uint[count];
+    cl_int err = 0;
+    for (size_t r = 0; (r < num) && (err == 0); r++) {
+        err = clrand_generate_host(adaptive, count, adaptiveNumbers);
+        if (err == 0) {
+            err = clrand_generate_host(fixed, count, fixedNumbers);
+        }
+        for (size_t idx = 0; (err == 0) && (idx < count); idx++) {
+            if (adaptiveNumbers[idx] != fixedNumbers[idx]) {
+                (*err_counts)++;
+            }
+        }
+    }
+    if (err) {
+        std::cout << "ERROR: unable to generate random uint!" << std::endl;
+    }
+    delete [] adaptiveNumbers;
+    delete [] fixedNumbers;
+    return err;
+}
+
+int main(int argc, char **argv) {
+    cl_int            err = -1;
+
+    oclStruct* tmpStructPtr = (oclStruct*) malloc(sizeof(oclStruct));
+    int res = makeOclStruct(argc, argv, tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to create oclStruct!\n");
+        return res;
+    }
+    res = printOclStructInfo(tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to print information about oclStruct!\n");
+        return res;
+    }
+
+    cl_device_id tmpDev = (*tmpStructPtr).target_device;
+    (*tmpStructPtr).ctx = clCreateContext(NULL, 1, &tmpDev, NULL, NULL, &err);
+    if (err) {
+        std::cout << "ERROR: unable to create context to extract random uint!" << std::endl;
+        return -1;
+    }
+
+    clRAND* adaptive = createStream(tmpStructPtr, true);
+    clRAND* fixed = createStream(tmpStructPtr, false);
+    if ((adaptive == NULL) || (fixed == NULL)) {
+        return -1;
+    }
+    clrandStreamStats stats;
+    clrand_get_stream_stats(adaptive, &stats);
+    size_t initial = stats.tmp_buffer_entries;
+    uint err_counts = 0;
+
+    // Requests larger than the temporary buffers grow them to hold one
+    // request, between the request size and twice of it (rounded up to
+    // whole fills)
+    std::cout << "Attempting to generate large requests of random uint..." << std::endl;
+    size_t large = 4 * initial + 5;
+    err = generateNumbers(adaptive, fixed, LARGE_REQUESTS, large, &err_counts);
+    if (err) {
+        return err;
+    }
+    clrand_get_stream_stats(adaptive, &stats);
+    std::cout << "Temporary buffer entries: " << stats.tmp_buffer_entries << ", resizes: " << stats.resize_count << std::endl;
+    if ((stats.tmp_buffer_entries < large) || (stats.tmp_buffer_entries > 2 * large + initial)) {
+        std::cout << "ERROR: temporary buffers were not sized from the requests!" << std::endl;
+        err_counts++;
+    }
+    if ((stats.resize_count == 0) || (stats.tmp_buffer_bytes < stats.tmp_buffer_entries * sizeof(uint))) {
+        std::cout << "ERROR: temporary buffers were not reallocated!" << std::endl;
+        err_counts++;
+    }
+    if (stats.request_count != LARGE_REQUESTS) {
+        std::cout << "ERROR: " << stats.request_count << " requests counted instead of " << LARGE_REQUESTS << "!" << std::endl;
+        err_counts++;
+    }
+
+    // Once small requests make up the recent history, the buffers shrink
+    // back to their initial size
+    std::cout << "Attempting to generate small requests of random uint..." << std::endl;
+    err = generateNumbers(adaptive, fixed, SMALL_REQUESTS, SMALL_REQUEST, &err_counts);
+    if (err) {
+        return err;
+    }
+    clrand_get_stream_stats(adaptive, &stats);
+    std::cout << "Temporary buffer entries: " << stats.tmp_buffer_entries << ", resizes: " << stats.resize_count << std::endl;
+    if (stats.tmp_buffer_entries != initial) {
+        std::cout << "ERROR: temporary buffers did not shrink back to " << initial << " entries!" << std::endl;
+        err_counts++;
+    }
+    if (stats.request_count != LARGE_REQUESTS + SMALL_REQUESTS) {
+        std::cout << "ERROR: " << stats.request_count << " requests counted instead of " << LARGE_REQUESTS + SMALL_REQUESTS << "!" << std::endl;
+        err_counts++;
+    }
+
+    // Buffers of a fixed size are never reallocated
+    clrand_get_stream_stats(fixed, &stats);
+    if ((stats.tmp_buffer_entries != initial) || (stats.resize_count != 0)) {
+        std::cout << "ERROR: fixed temporary buffers were resized!" << std::endl;
+        err_counts++;
+    }
+    delete adaptive;
+    delete fixed;
+
+    // The numbers do not depend on the sizes of the temporary buffers
+    if (err_counts == 0) {
+        std::cout << "No errors detected between adaptive and fixed temporary buffers!" << std::endl;
+    } else {
+        std::cout << err_counts << " errors detected between adaptive and fixed temporary buffers!" << std::endl;
+        return -2;
+    }
+
+    // Completed checks...
+    std::cout << "Checks completed!..." << std::endl;
+    free(tmpStructPtr);
+    return res;
+}
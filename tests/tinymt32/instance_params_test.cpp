@@ -0,0 +1,228 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <getopt.h>
+#include <set>
+#include "../../src/clrand.hpp"
+#include "utils.h"
+
+#define __CL_ENABLE_EXCEPTIONS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+
+#if defined(__APPLE__) || defined(__MACOSX)
+    #include <OpenCL/cl.h>
+#else
+    #include <CL/cl.h>
+#endif
+
+#define TINYMT32_SHIFT0 1
+#define TINYMT32_SHIFT1 10
+#define TINYMT32_SHIFT8 8
+#define TINYMT32_MIN_LOOP 8
+#define TINYMT32_PRE_LOOP 8
+const uint tinymt32_mask = 0x7fffffff;
+
+inline static void
+tinymt32_next_state(tinymt32wp_t * tiny)
+{
+    uint x = (tiny->s0 & tinymt32_mask) ^ tiny->s1 ^ tiny->s2;
+    uint y = tiny->s3;
+    uint t0, t1;
+    x ^= x << TINYMT32_SHIFT0;
+    y ^= (y >> TINYMT32_SHIFT0) ^ x;
+    tiny->s0 = tiny->s1;
+    tiny->s1 = tiny->s2;
+    tiny->s2 = x ^ (y << TINYMT32_SHIFT1);
+    tiny->s3 = y;
+    if (y & 1) {
+	tiny->s1 ^= tiny->mat1;
+	tiny->s2 ^= tiny->mat2;
+    }
+}
+
+inline static uint
+tinymt32_temper(tinymt32wp_t * tiny)
+{
+    uint t0, t1;
+    t0 = tiny->s3;
+    t1 = tiny->s0 + (tiny->s2 >> TINYMT32_SHIFT8);
+    t0 ^= t1;
+    if (t1 & 1) {
+	t0 ^= tiny->tmat;
+    }
+    return t0;
+}
+
+inline static uint
+tinymt32_uint32(tinymt32wp_t * tiny)
+{
+    tinymt32_next_state(tiny);
+    return tinymt32_temper(tiny);
+}
+
+inline static void
+tinymt32_period_certification(tinymt32wp_t * tiny)
+{
+    if ((tiny->s0 & tinymt32_mask) == 0 &&
+        tiny->s1 == 0 &&
+        tiny->s2 == 0 &&
+        tiny->s3 == 0) {
+        tiny->s0 = 'T';
+        tiny->s1 = 'I';
+        tiny->s2 = 'N';
+        tiny->s3 = 'Y';
+    }
+}
+
+inline static void
+tinymt32_init(tinymt32wp_t * tiny, uint seed)
+{
+    uint status[4];
+    status[0] = seed;
+    status[1] = tiny->mat1;
+    status[2] = tiny->mat2;
+    status[3] = tiny->tmat;
+    for (int i = 1; i < TINYMT32_MIN_LOOP; i++) {
+        status[i & 3] ^= i + 1812433253U
+            * (status[(i - 1) & 3]
+               ^ (status[(i - 1) & 3] >> 30));
+    }
+    tiny->s0 = status[0];
+    tiny->s1 = status[1];
+    tiny->s2 = status[2];
+    tiny->s3 = status[3];
+    tinymt32_period_certification(tiny);
+    for (int i = 0; i < TINYMT32_PRE_LOOP; i++) {
+        tinymt32_uint32(tiny);
+    }
+}
+
+#define tinymt32_uint(state) tinymt32_uint32(&state)
+
+#define NUM_PARAMS 1024
+
+int main(int argc, char **argv) {
+    cl_int            err = -1;
+
+    oclStruct* tmpStructPtr = (oclStruct*) malloc(sizeof(oclStruct));
+    int res = makeOclStruct(argc, argv, tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to create oclStruct!\n");
+        return res;
+    }
+    res = printOclStructInfo(tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to print information about oclStruct!\n");
+        return res;
+    }
+
+    cl_device_id tmpDev = (*tmpStructPtr).target_device;
+    (*tmpStructPtr).ctx = clCreateContext(NULL, 1, &tmpDev, NULL, NULL, &err);
+    if (err) {
+        std::cout << "ERROR: unable to create context to extract random uint!" << std::endl;
+        return -1;
+    }
+
+    // A stream with more instances than parameter sets is rejected
+    std::cout << "Attempting to ready stream with more instances than parameter sets..." << std::endl;
+    clRAND* test = clrand_create_stream();
+    clrand_set_num_generators(test, NUM_PARAMS + 1);
+    clrand_set_instance_params(test, 1);
+    clrand_initialize_prng(test, (*tmpStructPtr).target_device, (*tmpStructPtr).ctx, CLRAND_GENERATOR_TINYMT32);
+    err = clrand_ready_stream(test);
+    delete test;
+    if (err == 0) {
+        std::cout << "ERROR: stream with more instances than parameter sets was readied!" << std::endl;
+        return -2;
+    }
+
+    // One instance per parameter set of the table
+    test = clrand_create_stream();
+    clrand_set_layout(test, CLRAND_LAYOUT_INTERLEAVED);
+    clrand_set_num_generators(test, NUM_PARAMS);
+    err = clrand_set_instance_params(test, 1);
+    if (err) {
+        std::cout << "ERROR: unable to set instance parameter sets!" << std::endl;
+        return err;
+    }
+    clrand_initialize_prng(test, (*tmpStructPtr).target_device, (*tmpStructPtr).ctx, CLRAND_GENERATOR_TINYMT32);
+    err = clrand_ready_stream(test);
+    if (err) {
+        std::cout << "ERROR: unable to ready stream!" << std::endl;
+        return err;
+    }
+    clrand_set_prng_seed(test, 1234);
+
+    size_t numPRNGs = clrand_get_num_prngs(test);
+    tinymt32_state* state_mem = new tinymt32_state[numPRNGs];
+    err = clrand_checkpoint_state(test, state_mem);
+    if (err) {
+        std::cout << "ERROR: unable to copy state buffer to host!" << std::endl;
+        return err;
+    }
+
+    // Each instance has its own parameter set
+    uint err_counts = 0;
+    std::set<std::pair<uint, uint> > mats;
+    for (size_t idx = 0; idx < numPRNGs; idx++) {
+        if (mats.insert(std::make_pair(state_mem[idx].mat1, state_mem[idx].mat2)).second == false) {
+            std::cout << "Repeated parameter set at idx = " << idx << std::endl;
+            err_counts++;
+        }
+    }
+
+    // The states are seeded as on the host with the parameter sets
+    tinymt32_state* golden_states = new tinymt32_state[numPRNGs];
+    for (size_t idx = 0; idx < numPRNGs; idx++) {
+        ulong newSeed = (ulong)(idx);
+        newSeed <<= 1;
+        newSeed += 1234;
+        golden_states[idx].mat1 = state_mem[idx].mat1;
+        golden_states[idx].mat2 = state_mem[idx].mat2;
+        golden_states[idx].tmat = state_mem[idx].tmat;
+        tinymt32_init(&golden_states[idx], newSeed);
+        if ((golden_states[idx].s0 != state_mem[idx].s0) ||
+            (golden_states[idx].s1 != state_mem[idx].s1) ||
+            (golden_states[idx].s2 != state_mem[idx].s2) ||
+            (golden_states[idx].s3 != state_mem[idx].s3)) {
+            std::cout << "Mismatch in state at idx = " << idx << std::endl;
+            err_counts++;
+        }
+    }
+    if (err_counts == 0) {
+        std::cout << "No errors detected after seeding!" << std::endl;
+    } else {
+        std::cout << err_counts << " errors detected after seeding!" << std::endl;
+        return -2;
+    }
+
+    std::cout << "Attempting to generate random uint on device..." << std::endl;
+    uint* deviceRandomNumbers = new uint[numPRNGs];
+    err = clrand_generate_host(test, numPRNGs, deviceRandomNumbers);
+    if (err) {
+        std::cout << "ERROR: unable to generate random uint!" << std::endl;
+        return err;
+    }
+    std::cout << "Attempting to generate random uint on host..." << std::endl;
+    for (size_t idx = 0; idx < numPRNGs; idx++) {
+        if (tinymt32_uint(golden_states[idx]) != deviceRandomNumbers[idx]) {
+            std::cout << "ERROR: numbers do not match at idx = " << idx << std::endl;
+            err_counts++;
+        }
+    }
+    if (err_counts == 0) {
+        std::cout << "No errors detected after random number generation!" << std::endl;
+    } else {
+        std::cout << err_counts << " errors detected after random number generation!" << std::endl;
+        return -2;
+    }
+
+    // Completed checks...
+    std::cout << "Checks completed!..." << std::endl;
+    delete [] state_mem;
+    delete [] golden_states;
+    delete [] deviceRandomNumbers;
+    delete test;
+    free(tmpStructPtr);
+    return res;
+}
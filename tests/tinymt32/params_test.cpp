@@ -0,0 +1,78 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <iostream>
+#include <set>
+#include "../../src/tinymt_dc.hpp"
+#include "../../generator/tinymt32_params.hpp"
+
+#define NUM_PARAMS 1024
+
+// Parameters of tinymt32 from the TinyMT distribution, with the
+// characteristic polynomial, weight and delta given for them by TinyMTDC
+#define TINYMT32J_MAT1 0x8f7011eeU
+#define TINYMT32J_MAT2 0xfc78ff1fU
+#define TINYMT32J_TMAT 0x3793fdffU
+#define TINYMT32J_CHARACTERISTIC_HI 0xd8524022ed8dff4aULL
+#define TINYMT32J_CHARACTERISTIC_LO 0x8dcc50c798faba43ULL
+#define TINYMT32J_WEIGHT 63
+#define TINYMT32J_DELTA 0
+
+int main(int argc, char **argv) {
+    // The analysis gives the published results for the parameters of
+    // the TinyMT distribution
+    std::cout << "Attempting to check analysis of tinymt32 parameters..." << std::endl;
+    tinymtdcParams stock = { TINYMT32J_MAT1, TINYMT32J_MAT2, TINYMT32J_TMAT };
+    tinymtdcResult result = tinymtdcAnalyze(32, stock);
+    tinymtdcPoly characteristic = ((tinymtdcPoly)(TINYMT32J_CHARACTERISTIC_HI) << 64) | TINYMT32J_CHARACTERISTIC_LO;
+    if ((result.irreducible == false) || (result.characteristic != characteristic) ||
+        (result.weight != TINYMT32J_WEIGHT) || (result.delta != TINYMT32J_DELTA)) {
+        std::cout << "ERROR: analysis does not match TinyMTDC for the stock parameters!" << std::endl;
+        return -2;
+    }
+
+    std::vector<uint64_t> values;
+    std::vector<int> columns;
+    if ((tinymtdcReadTable(tinymt32_params_kernel, "tinymt32_params[", &values, &columns) == false) ||
+        (values.size() != 3 * NUM_PARAMS) || (columns.size() != 2 * NUM_PARAMS)) {
+        std::cout << "ERROR: unable to read table of tinymt32 parameter sets!" << std::endl;
+        return -1;
+    }
+
+    // Every set of the table has a recursion of full period of its own, and
+    // is equidistributed up to the upper bound in every dimension, with the
+    // weight and delta given in the table
+    std::cout << "Attempting to check parameter sets of tinymt32..." << std::endl;
+    uint err_counts = 0;
+    std::set<tinymtdcPoly> characteristics;
+    for (size_t idx = 0; idx < NUM_PARAMS; idx++) {
+        tinymtdcParams params = { (uint32_t)(values[3 * idx]), (uint32_t)(values[3 * idx + 1]), values[3 * idx + 2] };
+        result = tinymtdcAnalyze(32, params);
+        if (result.irreducible == false) {
+            std::cout << "Parameter set without full period at idx = " << idx << std::endl;
+            err_counts++;
+            continue;
+        }
+        if (characteristics.insert(result.characteristic).second == false) {
+            std::cout << "Repeated recursion at idx = " << idx << std::endl;
+            err_counts++;
+        }
+        if (result.delta != 0) {
+            std::cout << "Parameter set with delta = " << result.delta << " at idx = " << idx << std::endl;
+            err_counts++;
+        }
+        if ((result.weight != columns[2 * idx]) || (result.delta != columns[2 * idx + 1])) {
+            std::cout << "Mismatch in weight or delta at idx = " << idx << std::endl;
+            err_counts++;
+        }
+    }
+    if (err_counts == 0) {
+        std::cout << "No errors detected in parameter sets!" << std::endl;
+    } else {
+        std::cout << err_counts << " errors detected in parameter sets!" << std::endl;
+        return -2;
+    }
+
+    // Completed checks...
+    std::cout << "Checks completed!..." << std::endl;
+    return 0;
+}
@@ -0,0 +1,76 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <iostream>
+#include <set>
+#include "../../src/tinymt_dc.hpp"
+#include "../../generator/tinymt64_params.hpp"
+
+#define NUM_PARAMS 1024
+
+// Parameters of tinymt64 from the TinyMT distribution, with the weight and
+// delta given for them by TinyMTDC
+#define TINYMT64J_MAT1 0xfa051f40U
+#define TINYMT64J_MAT2 0xffd0fff4U
+#define TINYMT64J_TMAT 0x58d02ffeffbfffbcULL
+#define TINYMT64J_WEIGHT 65
+#define TINYMT64J_DELTA 0
+
+int main(int argc, char **argv) {
+    // The analysis gives the published results for the parameters of
+    // the TinyMT distribution
+    std::cout << "Attempting to check analysis of tinymt64 parameters..." << std::endl;
+    tinymtdcParams stock = { TINYMT64J_MAT1, TINYMT64J_MAT2, TINYMT64J_TMAT };
+    tinymtdcResult result = tinymtdcAnalyze(64, stock);
+    if ((result.irreducible == false) || (result.weight != TINYMT64J_WEIGHT) || (result.delta != TINYMT64J_DELTA)) {
+        std::cout << "ERROR: analysis does not match TinyMTDC for the stock parameters!" << std::endl;
+        return -2;
+    }
+
+    std::vector<uint64_t> mats;
+    std::vector<uint64_t> tmats;
+    std::vector<int> columns;
+    if ((tinymtdcReadTable(tinymt64_params_kernel, "tinymt64_mats[", &mats, &columns) == false) ||
+        (tinymtdcReadTable(tinymt64_params_kernel, "tinymt64_tmats[", &tmats, NULL) == false) ||
+        (mats.size() != 2 * NUM_PARAMS) || (tmats.size() != NUM_PARAMS) || (columns.size() != 2 * NUM_PARAMS)) {
+        std::cout << "ERROR: unable to read table of tinymt64 parameter sets!" << std::endl;
+        return -1;
+    }
+
+    // Every set of the table has a recursion of full period of its own, and
+    // is equidistributed up to the upper bound in every dimension, with the
+    // weight and delta given in the table
+    std::cout << "Attempting to check parameter sets of tinymt64..." << std::endl;
+    uint err_counts = 0;
+    std::set<tinymtdcPoly> characteristics;
+    for (size_t idx = 0; idx < NUM_PARAMS; idx++) {
+        tinymtdcParams params = { (uint32_t)(mats[2 * idx]), (uint32_t)(mats[2 * idx + 1]), tmats[idx] };
+        result = tinymtdcAnalyze(64, params);
+        if (result.irreducible == false) {
+            std::cout << "Parameter set without full period at idx = " << idx << std::endl;
+            err_counts++;
+            continue;
+        }
+        if (characteristics.insert(result.characteristic).second == false) {
+            std::cout << "Repeated recursion at idx = " << idx << std::endl;
+            err_counts++;
+        }
+        if (result.delta != 0) {
+            std::cout << "Parameter set with delta = " << result.delta << " at idx = " << idx << std::endl;
+            err_counts++;
+        }
+        if ((result.weight != columns[2 * idx]) || (result.delta != columns[2 * idx + 1])) {
+            std::cout << "Mismatch in weight or delta at idx = " << idx << std::endl;
+            err_counts++;
+        }
+    }
+    if (err_counts == 0) {
+        std::cout << "No errors detected in parameter sets!" << std::endl;
+    } else {
+        std::cout << err_counts << " errors detected in parameter sets!" << std::endl;
+        return -2;
+    }
+
+    // Completed checks...
+    std::cout << "Checks completed!..." << std::endl;
+    return 0;
+}
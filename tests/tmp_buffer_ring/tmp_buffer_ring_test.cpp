@@ -0,0 +1,135 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <getopt.h>
+#include "../../src/clrand.hpp"
+#include "utils.h"
+
+#define __CL_ENABLE_EXCEPTIONS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+
+#if defined(__APPLE__) || defined(__MACOSX)
+    #include <OpenCL/cl.h>
+#else
+    #include <CL/cl.h>
+#endif
+
+#define NUM_CONFIGS  4
+#define NUM_REQUESTS 40
+
+// Number of temporary buffers, and whether the command queues are shared
+static const size_t configs[NUM_CONFIGS][2] = {
+    { 1, 0 },
+    { 3, 0 },
+    { 1, 1 },
+    { 3, 1 }
+};
+
+// Builds a stream of the given configuration seeded with 1234
+static clRAND* createStream(oclStruct* tmpStructPtr, const size_t* config) {
+    clRAND* test = clrand_create_stream();
+    clrand_set_shared_queue(test, (int)(config[1]));
+    cl_int err = clrand_set_num_tmp_buffers(test, config[0]);
+    if (err) {
+        std::cout << "ERROR: unable to set number of temporary buffers!" << std::endl;
+        delete test;
+        return NULL;
+    }
+    clrand_initialize_prng(test, (*tmpStructPtr).target_device, (*tmpStructPtr).ctx, CLRAND_GENERATOR_LCG6432);
+    err = clrand_ready_stream(test);
+    if (err) {
+        std::cout << "ERROR: unable to ready stream!" << std::endl;
+        delete test;
+        return NULL;
+    }
+    clrand_set_prng_seed(test, 1234);
+    return test;
+}
+
+int main(int argc, char **argv) {
+    cl_int            err = -1;
+
+    oclStruct* tmpStructPtr = (oclStruct*) malloc(sizeof(oclStruct));
+    int res = makeOclStruct(argc, argv, tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to create oclStruct!\n");
+        return res;
+    }
+    res = printOclStructInfo(tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to print information about oclStruct!\n");
+        return res;
+    }
+
+    cl_device_id tmpDev = (*tmpStructPtr).target_device;
+    (*tmpStructPtr).ctx = clCreateContext(NULL, 1, &tmpDev, NULL, NULL, &err);
+    if (err) {
+        std::cout << "ERROR: unable to create context to extract random uint!" << std::endl;
+        return -1;
+    }
+
+    // Two streams of each configuration take turns serving requests that
+    // drain the temporary buffers part way, so every few requests span a
+    // refill. Their numbers match those of the first configuration, a
+    // single temporary buffer on queues of its own.
+    uint* reference = NULL;
+    size_t total = 0;
+    for (int c = 0; c < NUM_CONFIGS; c++) {
+        clRAND* streams[2];
+        streams[0] = createStream(tmpStructPtr, configs[c]);
+        streams[1] = createStream(tmpStructPtr, configs[c]);
+        if ((streams[0] == NULL) || (streams[1] == NULL)) {
+            return -1;
+        }
+        clrandStreamStats stats;
+        clrand_get_stream_stats(streams[0], &stats);
+        size_t count = stats.tmp_buffer_entries / 3 + 17;
+        if (reference == NULL) {
+            total = NUM_REQUESTS * count;
+            reference = new uint[total];
+        }
+        uint* numbers[2] = { new uint[total], new uint[total] };
+
+        std::cout << "Attempting to generate random uint with " << configs[c][0] << " temporary buffers"
+                  << (configs[c][1] ? " on shared queues" : "") << "..." << std::endl;
+        for (size_t done = 0; done < total; done += count) {
+            size_t num = (total - done < count) ? (total - done) : count;
+            for (int s = 0; s < 2; s++) {
+                err = clrand_generate_host(streams[s], num, numbers[s] + done);
+                if (err) {
+                    std::cout << "ERROR: unable to generate random uint!" << std::endl;
+                    return err;
+                }
+            }
+        }
+        delete streams[0];
+        delete streams[1];
+
+        uint err_counts = 0;
+        for (size_t idx = 0; idx < total; idx++) {
+            if (numbers[0][idx] != numbers[1][idx]) {
+                err_counts++;
+            }
+            if ((c > 0) && (numbers[0][idx] != reference[idx])) {
+                err_counts++;
+            }
+        }
+        if (c == 0) {
+            memcpy(reference, numbers[0], total * sizeof(uint));
+        }
+        delete [] numbers[0];
+        delete [] numbers[1];
+        if (err_counts == 0) {
+            std::cout << "No errors detected between temporary buffer configurations!" << std::endl;
+        } else {
+            std::cout << err_counts << " errors detected between temporary buffer configurations!" << std::endl;
+            return -2;
+        }
+    }
+    delete [] reference;
+
+    // Completed checks...
+    std::cout << "Checks completed!..." << std::endl;
+    free(tmpStructPtr);
+    return res;
+}
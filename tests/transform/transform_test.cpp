@@ -0,0 +1,121 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <getopt.h>
+#include "../../src/clrand.hpp"
+#include "utils.h"
+
+#define __CL_ENABLE_EXCEPTIONS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+
+#if defined(__APPLE__) || defined(__MACOSX)
+    #include <OpenCL/cl.h>
+#else
+    #include <CL/cl.h>
+#endif
+
+// Mixes the position of each number in the stream into it, and masks it
+// with an extra kernel argument
+static const char* transformSource =
+    "uint clrand_transform(uint x, ulong idx, uint mask){\n"
+    "    return (x ^ (uint)(idx)) & mask;\n"
+    "}\n";
+
+// Builds a stream with or without the transform and generates count
+// numbers into host memory, in requests of varying sizes
+static cl_int generateNumbers(oclStruct* tmpStructPtr, bool transform, uint mask, size_t count, uint* numbers) {
+    clRAND* test = clrand_create_stream();
+    if (transform) {
+        cl_int err = clrand_set_transform(test, transformSource, "uint mask");
+        if (err == 0) {
+            err = clrand_set_transform_arg(test, 0, sizeof(mask), &mask);
+        }
+        if (err) {
+            std::cout << "ERROR: unable to set transform!" << std::endl;
+            delete test;
+            return err;
+        }
+    }
+    cl_int err = clrand_initialize_prng(test, (*tmpStructPtr).target_device, (*tmpStructPtr).ctx, CLRAND_GENERATOR_PHILOX2X32_10);
+    if (err) {
+        std::cout << "ERROR: unable to initialize stream!" << std::endl;
+        delete test;
+        return err;
+    }
+    err = clrand_ready_stream(test);
+    if (err) {
+        std::cout << "ERROR: unable to ready stream!" << std::endl;
+        delete test;
+        return err;
+    }
+    clrand_set_prng_seed(test, 1234);
+    size_t done = 0;
+    for (size_t idx = 0; done < count; idx++) {
+        size_t num = 1000 + (idx * 7919) % 300000;
+        num = (count - done < num) ? (count - done) : num;
+        err = clrand_generate_host(test, num, numbers + done);
+        if (err) {
+            std::cout << "ERROR: unable to generate random uint!" << std::endl;
+            break;
+        }
+        done += num;
+    }
+    delete test;
+    return err;
+}
+
+int main(int argc, char **argv) {
+    cl_int            err = -1;
+
+    oclStruct* tmpStructPtr = (oclStruct*) malloc(sizeof(oclStruct));
+    int res = makeOclStruct(argc, argv, tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to create oclStruct!\n");
+        return res;
+    }
+    res = printOclStructInfo(tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to print information about oclStruct!\n");
+        return res;
+    }
+
+    cl_device_id tmpDev = (*tmpStructPtr).target_device;
+    (*tmpStructPtr).ctx = clCreateContext(NULL, 1, &tmpDev, NULL, NULL, &err);
+    if (err) {
+        std::cout << "ERROR: unable to create context to extract random uint!" << std::endl;
+        return -1;
+    }
+
+    size_t count = 2000000;
+    uint mask = 0x0fffffff;
+    uint* plainNumbers = new uint[count];
+    uint* transformedNumbers = new uint[count];
+    err = generateNumbers(tmpStructPtr, false, mask, count, plainNumbers);
+    if (err) {
+        return err;
+    }
+    err = generateNumbers(tmpStructPtr, true, mask, count, transformedNumbers);
+    if (err) {
+        return err;
+    }
+
+    uint err_counts = 0;
+    for (size_t idx = 0; idx < count; idx++) {
+        if (((plainNumbers[idx] ^ (uint)(idx)) & mask) != transformedNumbers[idx]) {
+            err_counts++;
+        }
+    }
+    delete [] plainNumbers;
+    delete [] transformedNumbers;
+    if (err_counts == 0) {
+        std::cout << "No errors detected in transformed numbers!" << std::endl;
+    } else {
+        std::cout << err_counts << " errors detected in transformed numbers!" << std::endl;
+        return -2;
+    }
+
+    // Completed checks...
+    std::cout << "Checks completed!..." << std::endl;
+    free(tmpStructPtr);
+    return res;
+}
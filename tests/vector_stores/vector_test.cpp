@@ -0,0 +1,112 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <getopt.h>
+#include "../../src/clrand.hpp"
+#include "utils.h"
+
+#define __CL_ENABLE_EXCEPTIONS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+
+#if defined(__APPLE__) || defined(__MACOSX)
+    #include <OpenCL/cl.h>
+#else
+    #include <CL/cl.h>
+#endif
+
+// Builds a stream with or without vector stores
+static clRAND* createStream(oclStruct* tmpStructPtr, bool vector, clrandLayout layout) {
+    clRAND* test = clrand_create_stream();
+    clrand_set_vector_stores(test, vector ? 1 : 0);
+    clrand_set_layout(test, layout);
+    cl_int err = clrand_initialize_prng(test, (*tmpStructPtr).target_device, (*tmpStructPtr).ctx, CLRAND_GENERATOR_LCG6432);
+    if (err) {
+        std::cout << "ERROR: unable to initialize stream!" << std::endl;
+        return NULL;
+    }
+    err = clrand_ready_stream(test);
+    if (err) {
+        std::cout << "ERROR: unable to ready stream!" << std::endl;
+        return NULL;
+    }
+    clrand_set_prng_seed(test, 1234);
+    return test;
+}
+
+int main(int argc, char **argv) {
+    cl_int            err = -1;
+
+    oclStruct* tmpStructPtr = (oclStruct*) malloc(sizeof(oclStruct));
+    int res = makeOclStruct(argc, argv, tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to create oclStruct!\n");
+        return res;
+    }
+    res = printOclStructInfo(tmpStructPtr);
+    if (res != 0) {
+        fprintf(stderr,"Unable to print information about oclStruct!\n");
+        return res;
+    }
+
+    cl_device_id tmpDev = (*tmpStructPtr).target_device;
+    (*tmpStructPtr).ctx = clCreateContext(NULL, 1, &tmpDev, NULL, NULL, &err);
+    if (err) {
+        std::cout << "ERROR: unable to create context to extract random uint!" << std::endl;
+        return -1;
+    }
+
+    // Scalar interleaved stream as reference, against vector stores in the
+    // interleaved layout and the blocked layout
+    clRAND* scalar = createStream(tmpStructPtr, false, CLRAND_LAYOUT_INTERLEAVED);
+    clRAND* tests[2];
+    tests[0] = createStream(tmpStructPtr, true, CLRAND_LAYOUT_INTERLEAVED);
+    tests[1] = createStream(tmpStructPtr, true, CLRAND_LAYOUT_BLOCKED);
+    if ((scalar == NULL) || (tests[0] == NULL) || (tests[1] == NULL)) {
+        return -1;
+    }
+    size_t numPRNGs = scalar->GetNumberOfRNGs();
+
+    // All streams hold the same numbers of each PRNG, in different orders
+    size_t count = numPRNGs * 64;
+    uint* scalarNumbers = new uint[count];
+    uint* testNumbers = new uint[count];
+    err = clrand_generate_host(scalar, count, scalarNumbers);
+    if (err) {
+        std::cout << "ERROR: unable to generate random uint with scalar stores!" << std::endl;
+        return err;
+    }
+    for (int t = 0; t < 2; t++) {
+        size_t run = tests[t]->GetRunLength();
+        std::cout << "Each work-item writes runs of " << run << " numbers" << std::endl;
+        err = clrand_generate_host(tests[t], count, testNumbers);
+        if (err) {
+            std::cout << "ERROR: unable to generate random uint with vector stores!" << std::endl;
+            return err;
+        }
+
+        uint err_counts = 0;
+        for (size_t idx = 0; idx < count; idx++) {
+            // Entry idx is number n of PRNG w
+            size_t w = (idx / run) % numPRNGs;
+            size_t n = (idx / (run * numPRNGs)) * run + idx % run;
+            if (testNumbers[idx] != scalarNumbers[n * numPRNGs + w]) {
+                err_counts++;
+            }
+        }
+        if (err_counts == 0) {
+            std::cout << "No errors detected between scalar stores and runs of " << run << "!" << std::endl;
+        } else {
+            std::cout << err_counts << " errors detected between scalar stores and runs of " << run << "!" << std::endl;
+            return -2;
+        }
+        delete tests[t];
+    }
+    delete [] scalarNumbers;
+    delete [] testNumbers;
+    delete scalar;
+
+    // Completed checks...
+    std::cout << "Checks completed!..." << std::endl;
+    free(tmpStructPtr);
+    return res;
+}